@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+"""
+    Half-band FIRs for the saturator oversampler (source/dsp/nonlinear/Oversampler.h).
+
+    A half-band h of length 2D + 1 (D odd) has h[D] = 1/2 and h[k] = 0 for
+    every other odd k - D, so only the D + 1 even-index taps h[2i] are stored,
+    and by symmetry only the first (D + 1)/2 of those.
+
+    Stage A runs between fs and 2 fs, stage B between 2 fs and 4 fs. Both are
+    specified at their own (high) rate, for fs = 48 kHz and a 20 kHz audio band:
+
+        A: pass 20/96,  stop 28/96   (28 kHz is the first image of 20 kHz)
+        B: pass 20/192, stop 72/192  (72..96 kHz folds onto 0..24 kHz at 2 fs)
+
+    Kaiser-windowed sinc. For each odd D the beta sweep keeps the window with
+    the deepest stopband; the smallest D that meets the target wins. The even
+    taps are rescaled to sum to 1/2, which makes the DC gain exactly 1 and the
+    Nyquist gain exactly 0.
+"""
+from __future__ import annotations
+
+import sys
+
+import numpy as np
+
+STAGES = {
+    # name: (pass edge, stop edge, target dB), normalised to the stage's high rate
+    "A": (20.0 / 96.0, 28.0 / 96.0, 80.0),
+    "B": (20.0 / 192.0, 72.0 / 192.0, 80.0),
+}
+
+HEADER_A: list[float] = [
+    -2.18701534e-05,
+    0.000102136066,
+    -0.000278901513,
+    0.000612418924,
+    -0.00118228735,
+    0.00208969577,
+    -0.00346075906,
+    0.00545329554,
+    -0.00827194564,
+    0.0122022368,
+    -0.0176888704,
+    0.0255271681,
+    -0.0373923816,
+    0.0576482564,
+    -0.102394208,
+    0.31705603,
+]
+
+HEADER_B: list[float] = [
+    -3.85577223e-05,
+    0.00122182141,
+    -0.00728533091,
+    0.0264086667,
+    -0.0781272352,
+    0.307820648,
+]
+
+
+def design(d: int, beta: float) -> np.ndarray:
+    """Full half-band of length 2d + 1."""
+    n = 2 * d + 1
+    k = np.arange(n, dtype=float) - d
+    w = np.i0(beta * np.sqrt(np.maximum(0.0, 1.0 - (k / d) ** 2))) / np.i0(beta)
+    h = 0.5 * np.sinc(k / 2.0) * w
+    h[d] = 0.5
+    even = np.arange(0, n, 2)
+    h[even] *= 0.5 / np.sum(h[even])
+    return h
+
+
+def response(h: np.ndarray, f: np.ndarray) -> np.ndarray:
+    m = np.arange(len(h), dtype=float)
+    return np.abs(np.exp(-2j * np.pi * np.outer(f, m)) @ h)
+
+
+def stop_db(h: np.ndarray, stop: float) -> float:
+    f = np.linspace(stop, 0.5, 4001)
+    return float(-20.0 * np.log10(np.max(response(h, f))))
+
+
+def pass_dev_db(h: np.ndarray, edge: float) -> float:
+    f = np.linspace(0.0, edge, 4001)
+    return float(np.max(np.abs(20.0 * np.log10(response(h, f)))))
+
+
+def fit(stop: float, target: float) -> tuple[int, float, np.ndarray]:
+    betas = np.arange(4.0, 11.0, 0.1)
+    for d in range(3, 201, 2):
+        atten, beta = max((stop_db(design(d, float(b)), stop), float(b)) for b in betas)
+        if atten >= target:
+            return d, beta, design(d, beta)
+    raise RuntimeError("no odd D up to 199 meets the target")
+
+
+def folded(h: np.ndarray, d: int) -> np.ndarray:
+    """h[2i] for i = 0 .. (d - 1)/2, the half the header stores."""
+    return h[0:d + 1:2][: (d + 1) // 2]
+
+
+def main() -> int:
+    ok = True
+    latency = {}
+    for name, header in (("A", HEADER_A), ("B", HEADER_B)):
+        p, s, target = STAGES[name]
+        d, beta, h = fit(s, target)
+        latency[name] = d
+        taps = folded(h, d)
+        print(f"stage {name}: D = {d} (N = {2 * d + 1}), beta = {beta:.1f}")
+        print(f"    stopband from {s:.4f}: {stop_db(h, s):.2f} dB")
+        print(f"    passband to {p:.4f}: {pass_dev_db(h, p):.2e} dB deviation")
+        print(f"    folded taps (C++ for kHalfband{name}):")
+        for v in taps:
+            print(f"        {float(np.float32(v)):.9g}f,")
+
+        if not header:
+            print(f"    HEADER_{name} is empty -- copy the block above in, then re-run.")
+            ok = False
+            continue
+        if len(header) != len(taps):
+            print(f"    LENGTH MISMATCH: HEADER_{name} has {len(header)} taps, expected {len(taps)}")
+            ok = False
+            continue
+        for i, (g, w) in enumerate(zip(taps, header)):
+            if np.float32(g) != np.float32(w):
+                print(f"    MISMATCH h[{2 * i}]: derived {float(np.float32(g)):.9g} != header {w:.9g}")
+                ok = False
+
+    print(f"\nlatency at fs: 2x = {latency['A']}, 4x = {latency['A'] + (latency['B'] + 1) // 2} samples")
+    print("\nheader taps match this derivation." if ok
+          else "\nheader taps DO NOT match; update source/dsp/nonlinear/Oversampler.h.")
+    return 0 if ok else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
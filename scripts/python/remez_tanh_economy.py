@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+"""
+remez_tanh_economy.py -- the float32 ("economy") F1 kernel and the ADAA1
+ill-conditioning threshold that goes with it.
+
+Same regions and factored form as the float64 kernel (f2_regions.py and
+remez_f1_*.py), refit for float32:
+
+    region I   F1 = u*S(u),  u = x^2,  |x| <= a0 = 1
+    region II  F1 = h + t*L(t),  h = |x| - ln2,  t = e^(-2|x|),  a0 < |x| < a1
+    region III the t term is dropped
+
+Degrees: S degree 6, L degree 4 -- the smallest that put the fit error under
+2^-26 (a quarter float ulp) with margin. a1 is re-derived: the dropped term
+must sit below 2^-28 relative (the double kernel uses 1e-17, the same
+fraction of an ulp).
+
+Threshold. ADAA1 runs the difference quotient in float too, so F1's rounding
+is amplified by 1/dx. With e_F the kernel's measured relative error and X the
+design input range (24 dB drive on a full-scale signal, X = 16), kEps
+balances the cancellation error against the midpoint error taken below it,
+with f2max = max|tanh''| = 4/(3*sqrt 3):
+
+    2*e_F*F1(X)/T  vs  f2max*T^2/24
+
+and is transcribed to two significant figures. adaa2_check measures the
+economy error against the double ADAA1 on the same input.
+
+There is no float F2. ADAA2 divides F2 differences by two increments and F2
+grows as x^2/2, so the same balance for its inner threshold sits near 1e-2
+absolute at X = 16; see dsp-notes.md. ADAA2 stays double.
+
+Exit non-zero on drift from the HEADER_* values.
+"""
+from __future__ import annotations
+
+import math
+import sys
+
+import numpy as np
+from mpmath import mp, mpf, exp, fabs
+
+from tanh_anti_common import (F1_exact, L_exact, LN2, S_exact, lin_grid,
+                              log_grid, remez_relative)
+
+mp.dps = 30
+
+A0 = mpf(1)
+T0 = exp(-2 * A0)
+GRID_N = 1201
+DEG_I = 6
+DEG_II = 4
+FIT_GATE = mpf(2) ** -26
+TAIL_GATE = mpf(2) ** -28
+X_DESIGN = 16.0
+ULP_REL = 2.0 ** -23  # relative size of one float ulp, worst case
+
+HEADER_S: list[float] | None = [
+    0.5, -0.0833329707, 0.0222162753, -0.00670901081, 0.0020743066,
+    -0.000553270394, 8.55027611e-05,
+]
+HEADER_L: list[float] | None = [
+    1.0, -0.4999955, 0.333069831, -0.244514644, 0.151864752,
+]
+HEADER_A1 = 9.0
+HEADER_EPS = 0.049
+
+
+def f32(v) -> np.float32:
+    return np.float32(float(v))
+
+
+def fma32(a, b, c):
+    """round-to-float(a*b + c): the float64 product is exact (24+24 bits)."""
+    return np.float32(np.float64(a) * np.float64(b) + np.float64(c))
+
+
+def estrin7(c, u):
+    u2 = np.float32(u * u)
+    u4 = np.float32(u2 * u2)
+    p0 = fma32(c[1], u, c[0])
+    p1 = fma32(c[3], u, c[2])
+    p2 = fma32(c[5], u, c[4])
+    q0 = fma32(p1, u2, p0)
+    q1 = fma32(c[6], u2, p2)
+    return fma32(q1, u4, q0)
+
+
+def estrin5(c, u):
+    u2 = np.float32(u * u)
+    u4 = np.float32(u2 * u2)
+    p0 = fma32(c[1], u, c[0])
+    p1 = fma32(c[3], u, c[2])
+    q0 = fma32(p1, u2, p0)
+    return fma32(c[4], u4, q0)
+
+
+def fit(name, oracle, hi, degree, header):
+    grid = lin_grid(0, hi, GRID_N)
+    f_grid = [oracle(u) for u in grid]
+    coeffs, rep = remez_relative(f_grid, grid, degree,
+                                 constraint=(hi, oracle(hi)), label=name)
+    ok = rep["max_rel"] < FIT_GATE
+    print(f"{name:>6}: degree {degree}, minimax rel err "
+          f"{mp.nstr(rep['max_rel'], 4)} (gate < 2^-26), ripple "
+          f"{mp.nstr(rep['ripple'], 4)}: {'PASS' if ok else 'FAIL'}")
+    c32 = [f32(c) for c in coeffs]
+    ok &= check32(name, c32, header)
+    return c32, ok
+
+
+def check32(name, c32, header):
+    body = ", ".join(f"{float(c):.9g}f" for c in c32)
+    print(f"        {{{body}}}")
+    print("        hex " + " ".join(float(c).hex() for c in c32))
+    if header is None:
+        return True
+    want = [np.float32(w) for w in header]
+    if len(want) != len(c32) or any(g != w for g, w in zip(c32, want)):
+        print(f"        MISMATCH against HEADER_{name.upper()}")
+        return False
+    return True
+
+
+def a1_float():
+    print("\nregion III crossover: dropped term below 2^-28 relative")
+    for a in range(2, 20):
+        am = mpf(a)
+        t = exp(-2 * am)
+        r = t * L_exact(t) / F1_exact(am)
+        if r < TAIL_GATE:
+            print(f"    a = {a}: F1 tail {mp.nstr(r, 3)}  <- a1")
+            return float(a)
+    return float("nan")
+
+
+def assembled(cs, cl, a1):
+    ln2_hi = f32(LN2)
+    ln2_lo = f32(LN2 - mpf(float(ln2_hi)))
+
+    def f1(x):
+        a = np.float32(abs(x))
+        if a <= 1.0:
+            u = np.float32(x * x)
+            return np.float32(u * estrin7(cs, u))
+        h = np.float32(np.float32(a - ln2_hi) - ln2_lo)
+        if a < a1:
+            t = np.exp(np.float32(-2.0) * a)
+            return fma32(t, estrin5(cl, t), h)
+        return h
+
+    xs = ([x for x in log_grid(mpf("1e-6"), mpf(1), 600)]
+          + [x for x in lin_grid(mpf(1), mpf(24), 2400)])
+    w, wx = 0.0, 0.0
+    for x in xs:
+        xf = f32(x)
+        ref = F1_exact(mpf(float(xf)))
+        e = float(fabs((mpf(float(f1(xf))) - ref) / ref))
+        if e > w:
+            w, wx = e, float(xf)
+    print(f"    F1: max rel err {w:.3e} = {w / ULP_REL:.3f} ulp at "
+          f"x = {wx:.6g}   (gate <= 2 ulp)")
+    return w
+
+
+def threshold(e_f):
+    f1x = X_DESIGN - math.log(2.0)
+    f2max = 4.0 / (3.0 * math.sqrt(3.0))
+    eps = (48.0 * e_f * f1x / f2max) ** (1.0 / 3.0)
+    two = float(f"{eps:.2g}")
+    print(f"\nthreshold for X = {X_DESIGN:g}, e_F = {e_f:.3e}:")
+    print(f"    kEpsF = {eps:.4f} -> {two:g}   balanced error "
+          f"{f2max * eps * eps / 24.0:.2e}")
+    if two != HEADER_EPS:
+        print(f"    MISMATCH kEpsF: header {HEADER_EPS}")
+        return False
+    return True
+
+
+def main() -> int:
+    print("=== economy (float32) kernel for F1 ===\n")
+    cs, ok = fit("S", S_exact, A0 * A0, DEG_I, HEADER_S)
+    cl, k = fit("L", L_exact, T0, DEG_II, HEADER_L)
+    ok &= k
+
+    a1 = a1_float()
+    if a1 != HEADER_A1:
+        print(f"    MISMATCH a1: header {HEADER_A1}")
+        ok = False
+
+    print("\nassembled float32 kernel vs oracle (FMA, np.exp for expf):")
+    e_f = assembled(cs, cl, np.float32(a1))
+    ok &= e_f <= 2.0 * ULP_REL
+
+    ok &= threshold(e_f)
+
+    print("\n=== PASS ===" if ok else "\n=== FAIL -- do not transcribe ===")
+    return 0 if ok else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+"""
+tanh_series_bound.py -- the quiet-region bound for the tanh series path of
+ADAA1/ADAA2 (TanhNL::kSeriesBound, Nonlinearities.h).
+
+Below the bound the saturators run tanh's odd Taylor series truncated after
+x^5,
+
+    p(x) = x - x^3/3 + 2 x^5/15,
+
+through ADAA in closed form: the divided differences of a polynomial are
+complete homogeneous symmetric polynomials of the inputs, so neither
+antiderivative is evaluated and nothing cancels.
+
+An ADAA output is an average of f over the span of its inputs (a box kernel
+for ADAA1, a triangle for ADAA2), so if every input in the block and in the
+history is within T, the series path and the exact path differ by at most
+
+    E(T) = max_{|x| <= T} |tanh(x) - p(x)|.
+
+The gate is E(T) <= 2^-24 T: under one float ulp at the block's peak, which
+is where the result is rounded to float anyway. The remainder starts at
+-17 x^7/315, so E is monotone on the range and the gate reduces to one
+equation in T. The bound is rounded down to two significant figures.
+
+Exit non-zero on drift from HEADER_BOUND.
+"""
+from __future__ import annotations
+
+import sys
+
+from mpmath import mp, mpf, tanh, fabs, findroot, floor, log10
+
+mp.dps = 40
+
+GATE = mpf(2) ** -24
+HEADER_BOUND = 0.1
+
+
+def p(x):
+    return x - x ** 3 / 3 + 2 * x ** 5 / 15
+
+
+def err(x):
+    return fabs(tanh(x) - p(x))
+
+
+def main() -> int:
+    # E(T) / T = 2^-24; start from the leading remainder term.
+    guess = (GATE * 315 / 17) ** (mpf(1) / 6)
+    t = findroot(lambda x: err(x) / x - GATE, guess)
+
+    # Monotone check on a grid up to t.
+    worst = max(err(t * k / 2000) / t for k in range(1, 2001))
+
+    digits = int(floor(log10(t)))
+    bound = float(floor(t / mpf(10) ** (digits - 1)) * mpf(10) ** (digits - 1))
+
+    print(f"E(T) = 2^-24 T at T = {float(t):.6f}")
+    print(f"max E(x) / T over (0, T]: {float(worst):.3e} (gate {float(GATE):.3e})")
+    print(f"at the rounded bound {bound}: E / T = {float(err(mpf(bound)) / bound):.3e}")
+    print(f"\nkSeriesBound = {bound}")
+
+    if abs(bound - HEADER_BOUND) > 0.0:
+        print(f"HEADER_BOUND {HEADER_BOUND} != derived {bound}; update Nonlinearities.h.")
+        return 1
+    print("header bound matches this derivation.")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -18,6 +18,7 @@ const ParameterID lpfFreqParamID{"lpfFreq", 1};
 const ParameterID mixParamID{"mix", 1};
 const ParameterID driveParamID{"drive", 1};
 const ParameterID adaaOrderParamID{"adaaOrder", 1};
+const ParameterID oversamplingParamID{"oversampling", 1};
 const ParameterID feedbackParamID{"feedback", 1};
 const ParameterID dampHzParamID{"dampHz", 1};
 const ParameterID loopCutHzParamID{"loopCutHz", 1};
@@ -55,6 +56,7 @@ public:
         castParameter(apvts, mixParamID, mixParam);
         castParameter(apvts, driveParamID, driveParam);
         castParameter(apvts, adaaOrderParamID, adaaOrderParam);
+        castParameter(apvts, oversamplingParamID, oversamplingParam);
         castParameter(apvts, feedbackParamID, feedbackParam);
         castParameter(apvts, dampHzParamID, dampHzParam);
         castParameter(apvts, loopCutHzParamID, loopCutHzParam);
@@ -176,6 +178,10 @@ public:
         layout.add(std::make_unique<AudioParameterChoice>(adaaOrderParamID, "Drive Sat",
             StringArray{"Off", "1st", "2nd"}, 2));
 
+        // Replaces Drive Sat when on; changes the reported latency.
+        layout.add(std::make_unique<AudioParameterChoice>(oversamplingParamID, "Drive Oversampling",
+            StringArray{"Off", "2x", "4x"}, 0));
+
         layout.add(std::make_unique<AudioParameterChoice>(filterModeParamID, "Output Filter",
             StringArray{"Digital", "Analog"}, 0));
 
@@ -241,6 +247,12 @@ public:
         return adaaOrderParam->getIndex();
     }
 
+    /// 1 (off), 2 or 4.
+    [[nodiscard]] int getRawOversampling() const noexcept
+    {
+        return oversamplingParam ? 1 << oversamplingParam->getIndex() : 1;
+    }
+
     [[nodiscard]] float getRawGainLin() const noexcept
     {
         return gainParam ? Decibels::decibelsToGain(gainParam->get()) : 1.0f;
@@ -301,6 +313,7 @@ private:
     AudioParameterChoice *filterModeParam{};
     AudioParameterFloat *driveParam{};
     AudioParameterChoice *adaaOrderParam{};
+    AudioParameterChoice *oversamplingParam{};
     AudioParameterFloat *feedbackParam{};
     AudioParameterFloat *dampHzParam{};
     AudioParameterFloat *loopCutHzParam{};
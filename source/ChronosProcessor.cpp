@@ -13,8 +13,8 @@ namespace {
     constexpr int kMaxTailRepeats = 240;
     // Ring-down margin in samples, added to the delay repeat tail.
     constexpr int kMargin = 32768;
-    // Constant latency budget of the saturator stage.
-    constexpr int kAlignBudget = MarsDSP::Align::SaturatorAlign::kBudget;
+    // Largest latency of the saturator stage, at 4x oversampling.
+    constexpr int kAlignBudget = MarsDSP::ChronosEngine::kMaxLatency;
 }
 //==============================================================================
 ChronosProcessor::ChronosProcessor() : AudioProcessor(BusesProperties()
@@ -114,6 +114,14 @@ void ChronosProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     engine.prepare(sampleRate, samplesPerBlock, numChannels);
     engine.reset();
 
+    lastParams_ = readEngineParams_();
+    engine.resetParams(lastParams_);
+
+    setLatencySamples(MarsDSP::ChronosEngine::latencySamples(lastParams_.oversampling));
+}
+
+MarsDSP::ChronosEngine::Params ChronosProcessor::readEngineParams_() const
+{
     MarsDSP::ChronosEngine::Params p {};
     p.delaySamples = computeDelaySamples_();
     p.driveLin = parameters.getRawDriveLin();
@@ -124,6 +132,7 @@ void ChronosProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     p.filterMode = parameters.getRawFilterMode();
     p.bits = parameters.getRawBits();
     p.adaaOrder = parameters.getADAAOrder();
+    p.oversampling = parameters.getRawOversampling();
     p.feedback = parameters.getRawFeedback();
     p.dampHz = parameters.getRawDampHz();
     p.loopCutHz = parameters.getRawLoopCutHz();
@@ -140,9 +149,7 @@ void ChronosProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     p.delayMode = parameters.getRawDelayMode();
     p.delayModDepth = parameters.getRawDelayModDepth();
     p.delayModRateHz = parameters.getRawDelayModRateHz();
-    engine.resetParams(p);
-
-    setLatencySamples(MarsDSP::Align::SaturatorAlign::kBudget);
+    return p;
 }
 
 float ChronosProcessor::computeDelaySamples_() const
@@ -162,6 +169,8 @@ void ChronosProcessor::releaseResources()
 void ChronosProcessor::reset()
 {
     engine.reset();
+    // Events only carry changes, so re-seed the full set after a reset.
+    engine.resetParams(lastParams_);
     parameters.reset();
 }
 
@@ -207,33 +216,21 @@ void ChronosProcessor::processBlock(AudioBuffer<float> &buffer, [[maybe_unused]]
     const int numSamples = buffer.getNumSamples();
     if (numSamples <= 0) return;
 
-    MarsDSP::ChronosEngine::Params p {};
-    p.delaySamples = computeDelaySamples_();
-    p.driveLin = parameters.getRawDriveLin();
-    p.mix = parameters.getRawMix();
-    p.gainLin = parameters.getRawGainLin();
-    p.hpfHz = parameters.getRawHpfHz();
-    p.lpfHz = parameters.getRawLpfHz();
-    p.filterMode = parameters.getRawFilterMode();
-    p.bits = parameters.getRawBits();
-    p.adaaOrder = parameters.getADAAOrder();
-    p.feedback = parameters.getRawFeedback();
-    p.dampHz = parameters.getRawDampHz();
-    p.loopCutHz = parameters.getRawLoopCutHz();
-    p.crossFeed = parameters.getRawCrossFeed();
-    p.loopDrive = parameters.getRawLoopDrive();
-    p.loopSatOrder = parameters.getRawLoopSatOrder();
-    p.diffusion = parameters.getRawDiffusion();
-    p.diffuserSize = parameters.getRawDiffuserSize();
-    p.diffModDepth = parameters.getRawDiffModDepth();
-    p.diffModRateHz = parameters.getRawDiffModRateHz();
-    p.enableDiffuser = parameters.getRawEnableDiffuser();
-    p.delaySync = parameters.getRawDelaySync();
-    p.delayDivision = parameters.getRawDelayDivision();
-    p.delayMode = parameters.getRawDelayMode();
-    p.delayModDepth = parameters.getRawDelayModDepth();
-    p.delayModRateHz = parameters.getRawDelayModRateHz();
-    engine.setParams(p);
+    // Send only the parameters that moved since the last block. Each event
+    // reaches just the subsystem that owns it. APVTS values are per block,
+    // so every event lands at offset 0.
+    using Engine = MarsDSP::ChronosEngine;
+    const Engine::Params p = readEngineParams_();
+    for (int i = 0; i < Engine::kNumParamIds; ++i)
+    {
+        const auto id = static_cast<Engine::ParamId>(i);
+        const float value = Engine::getParam(p, id);
+        if (value != Engine::getParam(lastParams_, id))
+            engine.pushParamEvent(id, 0, value);
+    }
+    if (p.oversampling != lastParams_.oversampling)
+        setLatencySamples(Engine::latencySamples(p.oversampling));
+    lastParams_ = p;
 
     const std::array<float *, 2> io{
         buffer.getWritePointer(0),
@@ -64,6 +64,12 @@ private:
     // Compute the delay in samples, using tempo sync when enabled.
     float computeDelaySamples_() const;
 
+    // Gather the engine parameters from the current APVTS values.
+    MarsDSP::ChronosEngine::Params readEngineParams_() const;
+
+    // The parameters last sent to the engine. processBlock diffs against it.
+    MarsDSP::ChronosEngine::Params lastParams_ {};
+
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ChronosProcessor)
 };
@@ -6,6 +6,7 @@
 #include "DelayInterpolator.h"
 #include "Pow2RingBuffer.h"
 #include "simd/Config.h"
+#include "simd/Kernels.h"
 
 #include <array>
 
@@ -36,32 +37,15 @@ namespace MarsDSP::Delays {
                  + c.c[3] * w[3] + c.c[4] * w[4] + c.c[5] * w[5];
         }
 
-        static void eval4(const float* oldWin, bool oldAligned,
-                          const float* newWin, bool newAligned,
-                          const std::array<M128, 6>& cbOld,
-                          const std::array<M128, 6>& cbNew,
-                          M128 vAlpha,
-                          float* dst) noexcept
+        /// Blend the 6-tap dots of two windows over n4 samples (a multiple of 4):
+        /// dst[j] = old[j] + alpha[j] * (new[j] - old[j]). Runs on the
+        /// dispatched tier; every tier matches the 4-wide result per lane.
+        static void evalBlock(const Simd::KernelTable& k,
+                              const float* oldWin, const float* newWin,
+                              const Coeffs6& cOld, const Coeffs6& cNew,
+                              const float* alpha, float* dst, int n4) noexcept
         {
-            M128 vOld = MM(setzero_ps)();
-            M128 vNew = MM(setzero_ps)();
-
-            for (int t = 0; t < 6; ++t)
-            {
-                const M128 wOld = (t == 0 && oldAligned)
-                                      ? MM(load_ps)(oldWin)
-                                      : MM(loadu_ps)(oldWin + t);
-                vOld = FMADD(wOld, cbOld[static_cast<std::size_t>(t)], vOld);
-
-                const M128 wNew = (t == 0 && newAligned)
-                                      ? MM(load_ps)(newWin)
-                                      : MM(loadu_ps)(newWin + t);
-                vNew = FMADD(wNew, cbNew[static_cast<std::size_t>(t)], vNew);
-            }
-
-            const M128 vDelta = MM(sub_ps)(vNew, vOld);
-            const M128 vOut = FMADD(vAlpha, vDelta, vOld);
-            MM(storeu_ps)(dst, vOut);
+            k.tapBlend(oldWin, newWin, cOld.c.data(), cNew.c.data(), alpha, dst, n4);
         }
     };
 }
@@ -7,9 +7,9 @@
 #include "OutputFilterStage.h"
 #include "StateVariable.h"
 #include "LinearSmoother.h"
-#include "nonlinear/ADAA1.h"
-#include "nonlinear/ADAA2.h"
 #include "nonlinear/Nonlinearities.h"
+#include "nonlinear/StereoADAA.h"
+#include "nonlinear/Oversampler.h"
 #include "align/SaturatorAlign.h"
 #include "DelayInterpolator.h"
 #include "Diffuser.h"
@@ -17,6 +17,7 @@
 #include "FracDelayTap.h"
 #include "math/SaturatorMakeup.h"
 #include "math/Trigonometry.h"
+#include "simd/Kernels.h"
 #include "utils/memory/BumpArena.h"
 
 #include <algorithm>
@@ -25,6 +26,7 @@
 #include <cmath>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <numbers>
 #include <span>
 #include <vector>
@@ -63,8 +65,114 @@ namespace MarsDSP
             float delayModDepth = 0.0f;
             float delayModRateHz = 0.35f;
             int delayMode = 0; // 0: Digital, 1: BBD
+            // --- output saturator anti-aliasing ---
+            int oversampling = 1; // 1: ADAA at adaaOrder; 2, 4: oversampled tanh
         };
 
+        // One id per Params field. Integer and bool fields travel as float.
+        enum class ParamId : std::uint8_t
+        {
+            DelaySamples, DriveLin, Mix, GainLin, HpfHz, LpfHz, FilterMode, Bits, AdaaOrder,
+            Feedback, DampHz, LoopCutHz, CrossFeed, LoopDrive, LoopSatOrder,
+            Diffusion, DiffuserSize, DiffModDepth, DiffModRateHz, EnableDiffuser,
+            DelaySync, DelayDivision, DelayModDepth, DelayModRateHz, DelayMode,
+            Oversampling,
+            Count
+        };
+        static constexpr int kNumParamIds = static_cast<int>(ParamId::Count);
+
+        // A parameter change at a sample offset into the next process() call.
+        struct ParamEvent
+        {
+            ParamId id = ParamId::DelaySamples;
+            int sampleOffset = 0;
+            float value = 0.0f;
+        };
+
+        static constexpr int kMaxParamEvents = 256;
+
+        // The post-loop stages run in one pass over tiles of this many
+        // samples. A multiple of the output filters' 32-sample coefficient
+        // sub-block and of the 4-lane kernels, so tiling does not change
+        // the output.
+        static constexpr int kTile = 64;
+
+        // The oversampled output saturator, a tile at a time.
+        using Oversampler = Nonlinear::Oversampler<kTile>;
+        static constexpr int kMaxLatency = Oversampler::kMaxLatency;
+        static_assert(Oversampler::latencySamples(2) >= Align::SaturatorAlign::kBudget,
+                      "oversampled latency must cover the alignment budget");
+
+        [[nodiscard]] static float getParam(const Params &p, ParamId id) noexcept
+        {
+            switch (id)
+            {
+                case ParamId::DelaySamples: return p.delaySamples;
+                case ParamId::DriveLin: return p.driveLin;
+                case ParamId::Mix: return p.mix;
+                case ParamId::GainLin: return p.gainLin;
+                case ParamId::HpfHz: return p.hpfHz;
+                case ParamId::LpfHz: return p.lpfHz;
+                case ParamId::FilterMode: return static_cast<float>(p.filterMode);
+                case ParamId::Bits: return static_cast<float>(p.bits);
+                case ParamId::AdaaOrder: return static_cast<float>(p.adaaOrder);
+                case ParamId::Feedback: return p.feedback;
+                case ParamId::DampHz: return p.dampHz;
+                case ParamId::LoopCutHz: return p.loopCutHz;
+                case ParamId::CrossFeed: return p.crossFeed;
+                case ParamId::LoopDrive: return p.loopDrive;
+                case ParamId::LoopSatOrder: return static_cast<float>(p.loopSatOrder);
+                case ParamId::Diffusion: return p.diffusion;
+                case ParamId::DiffuserSize: return p.diffuserSize;
+                case ParamId::DiffModDepth: return p.diffModDepth;
+                case ParamId::DiffModRateHz: return p.diffModRateHz;
+                case ParamId::EnableDiffuser: return p.enableDiffuser ? 1.0f : 0.0f;
+                case ParamId::DelaySync: return p.delaySync ? 1.0f : 0.0f;
+                case ParamId::DelayDivision: return static_cast<float>(p.delayDivision);
+                case ParamId::DelayModDepth: return p.delayModDepth;
+                case ParamId::DelayModRateHz: return p.delayModRateHz;
+                case ParamId::DelayMode: return static_cast<float>(p.delayMode);
+                case ParamId::Oversampling: return static_cast<float>(p.oversampling);
+                case ParamId::Count: break;
+            }
+            return 0.0f;
+        }
+
+        static void setParam(Params &p, ParamId id, float value) noexcept
+        {
+            const auto asInt = static_cast<int>(std::lround(value));
+            switch (id)
+            {
+                case ParamId::DelaySamples: p.delaySamples = value; break;
+                case ParamId::DriveLin: p.driveLin = value; break;
+                case ParamId::Mix: p.mix = value; break;
+                case ParamId::GainLin: p.gainLin = value; break;
+                case ParamId::HpfHz: p.hpfHz = value; break;
+                case ParamId::LpfHz: p.lpfHz = value; break;
+                case ParamId::FilterMode: p.filterMode = asInt; break;
+                case ParamId::Bits: p.bits = asInt; break;
+                case ParamId::AdaaOrder: p.adaaOrder = asInt; break;
+                case ParamId::Feedback: p.feedback = value; break;
+                case ParamId::DampHz: p.dampHz = value; break;
+                case ParamId::LoopCutHz: p.loopCutHz = value; break;
+                case ParamId::CrossFeed: p.crossFeed = value; break;
+                case ParamId::LoopDrive: p.loopDrive = value; break;
+                case ParamId::LoopSatOrder: p.loopSatOrder = asInt; break;
+                case ParamId::Diffusion: p.diffusion = value; break;
+                case ParamId::DiffuserSize: p.diffuserSize = value; break;
+                case ParamId::DiffModDepth: p.diffModDepth = value; break;
+                case ParamId::DiffModRateHz: p.diffModRateHz = value; break;
+                case ParamId::EnableDiffuser: p.enableDiffuser = value >= 0.5f; break;
+                case ParamId::DelaySync: p.delaySync = value >= 0.5f; break;
+                case ParamId::DelayDivision: p.delayDivision = asInt; break;
+                case ParamId::DelayModDepth: p.delayModDepth = value; break;
+                case ParamId::DelayModRateHz: p.delayModRateHz = value; break;
+                case ParamId::DelayMode: p.delayMode = asInt; break;
+                case ParamId::Oversampling: p.oversampling = asInt; break;
+                case ParamId::Count: break;
+            }
+        }
+
         void prepare(double sampleRate, int maxBlockSize, int numChannels) noexcept
         {
             assert(sampleRate > 0.0);
@@ -75,50 +183,53 @@ namespace MarsDSP
             numChannels_ = numChannels;
             wetBufCapacity_ = std::max(1, 2 * maxBlockSize);
 
-            // The feedback line owns the delay and the in-loop diffuser.
-            constexpr int kNumScratch = 15;
+            // The loop output is held for a whole chunk. Everything after
+            // it works on kTile-sized scratch, whatever the block size.
+            constexpr int kNumTileScratch = 13;
             const auto cap = static_cast<std::size_t>(wetBufCapacity_);
             const std::size_t strideFloats = (cap + 15u) & ~static_cast<std::size_t>(15u);
+            constexpr auto tile = static_cast<std::size_t>(kTile);
 
             const int maxDelaySamp =
                     Delays::SimdDelayLine::maxDelaySamplesFor(sampleRate, 5000.0f);
 
             const std::size_t ringFloats =
                     Delays::FeedbackDelay::ringStorageFloats(sampleRate, wetBufCapacity_, maxDelaySamp);
-            arena_.reset(static_cast<std::size_t>(kNumScratch) * strideFloats * sizeof(float)
-                         + ringFloats * sizeof(float));
+            scratchBytes_ = (2u * strideFloats + kNumTileScratch * tile) * sizeof(float);
+            arena_.reset(scratchBytes_ + ringFloats * sizeof(float));
 
+            // The feedback line owns the delay and the in-loop diffuser.
             fbDelay_.prepare(sampleRate, wetBufCapacity_, maxDelaySamp, arena_);
             assert(fbDelay_.getMaxDelay() >= static_cast<float>(maxDelaySamp));
 
-            auto take = [&](std::span<float> &s)
+            auto take = [&](std::span<float> &s, std::size_t n)
             {
-                auto *q = arena_.allocate<float>(strideFloats, Memory::BumpArena::kBaseAlignment);
+                auto *q = arena_.allocate<float>(n, Memory::BumpArena::kBaseAlignment);
                 assert(q != nullptr); // sized by construction; cannot exhaust
-                std::memset(q, 0, cap * sizeof(float));
-                s = {q, cap};
+                std::memset(q, 0, n * sizeof(float));
+                s = {q, n};
             };
-            take(wetBufL_);
-            take(wetBufR_);
-            take(driveRamp_);
-            take(hpfRamp_);
-            take(lpfRamp_);
-            take(thetaRamp_);
-            take(gainRamp_);
-            take(satL_);
-            take(satR_);
-            take(alignedDryL_);
-            take(alignedDryR_);
-            take(wetPostSvfL_);
-            take(wetPostSvfR_);
-            take(bypassDryInL_);
-            take(bypassDryInR_);
+            take(wetBufL_, strideFloats);
+            take(wetBufR_, strideFloats);
+            take(driveRamp_, tile);
+            take(hpfRamp_, tile);
+            take(lpfRamp_, tile);
+            take(thetaRamp_, tile);
+            take(gainRamp_, tile);
+            take(satL_, tile);
+            take(satR_, tile);
+            take(alignedDryL_, tile);
+            take(alignedDryR_, tile);
+            take(wetPostSvfL_, tile);
+            take(wetPostSvfR_, tile);
+            take(bypassDryInL_, tile);
+            take(bypassDryInR_, tile);
 
             bypassSmoother_.reset(sampleRate, 0.01);
             bypassDryL_.reset();
             bypassDryR_.reset();
-            bypassDryL_.setDelay(latencySamples());
-            bypassDryR_.setDelay(latencySamples());
+            bypassDryL_.setDelay(latencySamples(oversampling_));
+            bypassDryR_.setDelay(latencySamples(oversampling_));
 
             constexpr double kRampSeconds = 0.02;
             gainSmoother_.reset(sampleRate, kRampSeconds);
@@ -136,16 +247,13 @@ namespace MarsDSP
         {
             fbDelay_.reset();
             outFilters_.reset();
-            adaa1L_.reset();
-            adaa1R_.reset();
-            adaa2L_.reset();
-            adaa2R_.reset();
-            alignL_.reset();
-            alignR_.reset();
+            resetAdaa_();
+            align_.reset();
+            resetOversampling_();
             bypassDryL_.reset();
             bypassDryR_.reset();
-            bypassDryL_.setDelay(latencySamples());
-            bypassDryR_.setDelay(latencySamples());
+            bypassDryL_.setDelay(latencySamples(oversampling_));
+            bypassDryR_.setDelay(latencySamples(oversampling_));
             bypassSmoother_.setCurrentAndTargetValue(0.0f);
             bypassTarget_ = 0.0f;
 
@@ -155,11 +263,18 @@ namespace MarsDSP
             smoothedLpf_ = 0.0f;
             smoothedMix_ = 0.0f;
             smoothedDrive_ = 0.0f;
+            numEvents_ = 0;
+            asleep_ = false;
+            quietSamples_ = 0;
+            loopElided_ = false;
+            wetElided_ = false;
         }
 
         void resetParams(const Params &p) noexcept
         {
+            params_ = p;
             adaaOrder_ = p.adaaOrder;
+            setOversampling_(p.oversampling);
 
             smoothedHpf_ = p.hpfHz;
             smoothedLpf_ = p.lpfHz;
@@ -180,7 +295,9 @@ namespace MarsDSP
 
         void setParams(const Params &p) noexcept
         {
+            params_ = p;
             adaaOrder_ = p.adaaOrder;
+            setOversampling_(p.oversampling);
 
             gainSmoother_.setTargetValue(p.gainLin);
             smoothedBits_ = p.bits;
@@ -196,308 +313,752 @@ namespace MarsDSP
             applyFeedbackParams_(p, /*snap=*/false);
         }
 
+        // Queue a change for the next process() call. Events are kept in
+        // offset order; equal offsets apply in push order. Offsets at or
+        // past the block end apply after its last sample. Returns false
+        // when the queue is full. Audio thread only.
+        bool pushParamEvent(ParamId id, int sampleOffset, float value) noexcept
+        {
+            if (numEvents_ >= kMaxParamEvents || id == ParamId::Count) return false;
+            const int offset = std::max(0, sampleOffset);
+            int i = numEvents_;
+            while (i > 0 && events_[static_cast<std::size_t>(i - 1)].sampleOffset > offset)
+            {
+                events_[static_cast<std::size_t>(i)] = events_[static_cast<std::size_t>(i - 1)];
+                --i;
+            }
+            events_[static_cast<std::size_t>(i)] = {id, offset, value};
+            ++numEvents_;
+            return true;
+        }
+
+        // With sleep on (the default), the engine stops all DSP once the input
+        // is silent and the feedback tail has decayed, and wakes on the first
+        // first chunk with non-silent input.
+        void setSleepEnabled(bool enabled) noexcept
+        {
+            sleepEnabled_ = enabled;
+            if (!enabled)
+            {
+                asleep_ = false;
+                quietSamples_ = 0;
+            }
+        }
+
+        // Economy runs the ADAA1 drive saturator and the analog output
+        // saturators in float (TanhNLEconomy); ADAA2 stays double. A
+        // change restarts their ADAA history.
+        void setAdaaPrecision(Nonlinear::AdaaPrecision p) noexcept
+        {
+            if (p == adaaPrecision_) return;
+            adaaPrecision_ = p;
+            resetAdaa_();
+            outFilters_.setAdaaPrecision(p);
+        }
+
+        // Quiet tiles, where the driven signal and the ADAA history stay
+        // under TanhNL::kSeriesBound, run the ADAA saturators through tanh's
+        // series a block at a time, here and in the loop. On by default;
+        // off sends every sample through F1/F2.
+        void setSeriesFastPath(bool enabled) noexcept
+        {
+            seriesFastPath_ = enabled;
+            fbDelay_.setSeriesFastPath(enabled);
+        }
+
+        [[nodiscard]] bool isAsleep() const noexcept { return asleep_; }
+
+        [[nodiscard]] int pendingParamEvents() const noexcept { return numEvents_; }
+        [[nodiscard]] const Params &currentParams() const noexcept { return params_; }
+
         void process(float *const*io, int numChannels, int numSamples) noexcept
         {
             assert(io != nullptr);
             assert(io[0] != nullptr);
             assert(numChannels == 1 || numChannels == 2);
-            if (numSamples <= 0) return;
 
-            const double fsSafe = sampleRate_ > 0.0 ? sampleRate_ : 48000.0;
             float *data0 = io[0];
             float *data1 = numChannels > 1 ? io[1] : nullptr;
+
+            // Split the block at each event offset. A block with no events
+            // is one span.
+            int next = 0;
+            for (int pos = 0; pos < numSamples;)
+            {
+                while (next < numEvents_ && events_[static_cast<std::size_t>(next)].sampleOffset <= pos)
+                    applyParamEvent_(events_[static_cast<std::size_t>(next++)]);
+                const int end = next < numEvents_
+                                    ? std::min(numSamples, events_[static_cast<std::size_t>(next)].sampleOffset)
+                                    : numSamples;
+                processSpan_(data0 + pos, data1 != nullptr ? data1 + pos : nullptr, end - pos);
+                pos = end;
+            }
+            while (next < numEvents_)
+                applyParamEvent_(events_[static_cast<std::size_t>(next++)]);
+            numEvents_ = 0;
+        }
+
+        /// Latency at an oversampling factor: kBudget under ADAA, the
+        /// half-band filters' delay when oversampled. Report it again when
+        /// Params::oversampling changes.
+        [[nodiscard]] static constexpr int latencySamples(int oversampling = 1) noexcept
+        {
+            return oversampling > 1 ? Oversampler::latencySamples(oversampling) : Align::SaturatorAlign::kBudget;
+        }
+
+        [[nodiscard]] int getWetBufCapacity() const noexcept { return wetBufCapacity_; }
+
+        /// Bytes of per-block scratch: the loop output plus the post-loop
+        /// tiles. The delay ring is not counted.
+        [[nodiscard]] std::size_t getScratchBytes() const noexcept { return scratchBytes_; }
+
+        void setDitherSeeds(std::uint32_t l, std::uint32_t r) noexcept
+        {
+            xorshiftL_ = l;
+            xorshiftR_ = r;
+
+            std::array<std::uint32_t, 4> seedsL = {l, l * 2654435761u + 1u, l * 40503u + 2u, l * 2246822519u + 3u};
+            std::array<std::uint32_t, 4> seedsR = {r, r * 2654435761u + 1u, r * 40503u + 2u, r * 2246822519u + 3u};
+            for (int i = 0; i < 4; ++i)
+            {
+                if (seedsL[static_cast<std::size_t>(i)] == 0u) seedsL[static_cast<std::size_t>(i)] = 1u;
+                if (seedsR[static_cast<std::size_t>(i)] == 0u) seedsR[static_cast<std::size_t>(i)] = 1u;
+            }
+            xorshiftSimdL_ = seedsL;
+            xorshiftSimdR_ = seedsR;
+        }
+
+        void setBypass(bool bypassed) noexcept
+        {
+            const float newTarget = bypassed ? 1.0f : 0.0f;
+            if (newTarget != bypassTarget_)
+            {
+                bypassTarget_ = newTarget;
+                bypassSmoother_.setTargetValue(newTarget);
+            }
+        }
+
+    private:
+        void processSpan_(float *data0, float *data1, int numSamples) noexcept
+        {
             const bool hasR = data1 != nullptr;
+            const Simd::KernelTable &kernels = Simd::kernels();
+
+            // ADAA order or oversampling, channel count and the quantiser
+            // are fixed for the span, so the chunk body is picked once here.
+            const ChunkFn chunkFn = selectChunk_(adaaOrder_, hasR, smoothedBits_ < 32,
+                                                 adaaPrecision_ == Nonlinear::AdaaPrecision::Economy,
+                                                 oversampling_);
 
             for (int offset = 0; offset < numSamples;)
             {
                 const int chunk = std::min(wetBufCapacity_, numSamples - offset);
+                float *d0 = data0 + offset;
+                float *d1 = hasR ? data1 + offset : nullptr;
 
-                // Wet generation at block rate. The feedback line owns
-                // the delay and the in-loop diffuser.
-                fbDelay_.process(data0 + offset,
-                                 hasR ? data1 + offset : nullptr,
-                                 wetBufL_.data(),
-                                 hasR ? wetBufR_.data() : nullptr,
-                                 chunk);
-
-                const float blockLsb = std::ldexp(1.0f, 1 - smoothedBits_);
-                for (int s = 0; s < chunk; ++s)
+                float inPeak = 0.0f;
+                if (sleepEnabled_)
                 {
-                    smoothen_();
-                    driveRamp_[static_cast<std::size_t>(s)] = smoothedDrive_;
-                    hpfRamp_[static_cast<std::size_t>(s)] = smoothedHpf_;
-                    lpfRamp_[static_cast<std::size_t>(s)] = smoothedLpf_;
-                    thetaRamp_[static_cast<std::size_t>(s)] =
-                            (smoothedMix_ * 0.01f) * (std::numbers::pi_v<float> * 0.5f);
-                    gainRamp_[static_cast<std::size_t>(s)] = smoothedGain_;
+                    inPeak = kernels.peakAbs(d0, chunk);
+                    if (hasR) inPeak = std::max(inPeak, kernels.peakAbs(d1, chunk));
                 }
 
-                // Align the saturator latency, once per chunk.
-                alignL_.setMode(adaaOrder_);
-                alignR_.setMode(adaaOrder_);
-
-                for (int s = 0; s < chunk; ++s)
+                if (asleep_)
                 {
-                    const auto u = static_cast<std::size_t>(s);
+                    if (inPeak <= kSleepThreshold)
+                    {
+                        writeSleep_(kernels, d0, d1, chunk);
+                        offset += chunk;
+                        continue;
+                    }
+                    // Every state left behind sits below the threshold,
+                    // so the chain resumes from it without a step.
+                    asleep_ = false;
+                    quietSamples_ = 0;
+                }
 
-                    bypassDryInL_[u] = data0[offset + s];
-                    if (hasR)
-                        bypassDryInR_[u] = data1[offset + s];
-                    alignedDryL_[u] = alignL_.processDry(data0[offset + s]);
-                    if (hasR)
-                        alignedDryR_[u] = alignR_.processDry(data1[offset + s]);
+                if (bypassSettled_())
+                {
+                    // Fully bypassed: the loop output is discarded, so the
+                    // loop does not run. It restarts empty on un-bypass.
+                    loopElided_ = true;
+                    if (sleepEnabled_) trackTail_(inPeak, 0.0f, chunk);
+                } else
+                {
+                    if (loopElided_) reprimeLoop_();
 
-                    const float wet0 = wetBufL_[u];
-                    const float wet1 = hasR ? wetBufR_[u] : 0.0f;
+                    // Wet generation at block rate. The feedback line owns
+                    // the delay and the in-loop diffuser.
+                    fbDelay_.process(d0, d1, wetBufL_.data(), hasR ? wetBufR_.data() : nullptr, chunk);
 
-                    float sat0;
-                    float sat1 = 0.0f;
-                    switch (adaaOrder_)
+                    if (sleepEnabled_)
                     {
-                        case 0:
-                            sat0 = wet0;
-                            if (hasR) sat1 = wet1;
-                            break;
-                        case 1:
-                            sat0 = static_cast<float>(adaa1L_.process(driveRamp_[u] * wet0));
-                            if (hasR) sat1 = static_cast<float>(adaa1R_.process(driveRamp_[u] * wet1));
-                            break;
-                        default:
-                            sat0 = static_cast<float>(adaa2L_.process(driveRamp_[u] * wet0));
-                            if (hasR) sat1 = static_cast<float>(adaa2R_.process(driveRamp_[u] * wet1));
-                            break;
+                        float wetPeak = kernels.peakAbs(wetBufL_.data(), chunk);
+                        if (hasR) wetPeak = std::max(wetPeak, kernels.peakAbs(wetBufR_.data(), chunk));
+                        trackTail_(inPeak, wetPeak, chunk);
                     }
+                }
+
+                (this->*chunkFn)(kernels, d0, d1, chunk);
+
+                offset += chunk;
+            }
+        }
+
+        [[nodiscard]] bool bypassSettled_() const noexcept
+        {
+            return !bypassSmoother_.isSmoothing() && bypassSmoother_.getCurrentValue() >= 1.0f;
+        }
 
-                    if (adaaOrder_ > 0)
+        [[nodiscard]] bool mixSettledDry_() const noexcept
+        {
+            return !mixSmoother_.isSmoothing() && mixSmoother_.getCurrentValue() <= 0.0f;
+        }
+
+        void resetAdaa_() noexcept
+        {
+            adaa1_.reset();
+            adaa2_.reset();
+            adaa1EcoL_.reset();
+            adaa1EcoR_.reset();
+        }
+
+        void resetOversampling_() noexcept
+        {
+            osL_.reset();
+            osR_.reset();
+            osDry_.reset();
+            osDry_.setDelay(latencySamples(oversampling_) - Align::SaturatorAlign::kBudget);
+        }
+
+        // 1, 2 or 4. A change moves the latency, so the oversampler and the
+        // extra dry delay restart, and the bypass lines, which hold
+        // kMaxLatency of history, re-tap.
+        void setOversampling_(int factor) noexcept
+        {
+            factor = factor >= 4 ? 4 : (factor >= 2 ? 2 : 1);
+            if (factor == oversampling_) return;
+            oversampling_ = factor;
+            if (factor > 1)
+            {
+                osL_.setFactor(factor);
+                osR_.setFactor(factor);
+            }
+            resetOversampling_();
+            bypassDryL_.setDelay(latencySamples(factor));
+            bypassDryR_.setDelay(latencySamples(factor));
+        }
+
+        // An old tail must not resume after a bypass, so the loop restarts
+        // empty with its smoothers snapped to the current parameters.
+        void reprimeLoop_() noexcept
+        {
+            fbDelay_.reset();
+            applyFeedbackParams_(params_, /*snap=*/true);
+            loopElided_ = false;
+        }
+
+        // The wet stages restart from silence. The crossfade brings the wet
+        // path in from zero gain, so the restart is inaudible.
+        void reprimeWetStages_() noexcept
+        {
+            resetAdaa_();
+            align_.resetWet();
+            osL_.reset();
+            osR_.reset();
+            outFilters_.reset();
+            wetElided_ = false;
+        }
+
+        // Sleep once the input and the loop tap have both stayed below
+        // kSleepThreshold for the loop's tail horizon, plus the output
+        // stage's settle time. A loop at or above unity gain never sleeps.
+        void trackTail_(float inPeak, float wetPeak, int chunk) noexcept
+        {
+            if (inPeak > kSleepThreshold || wetPeak > kSleepThreshold || !fbDelay_.tailDecays())
+            {
+                quietSamples_ = 0;
+                return;
+            }
+            quietSamples_ = std::min(quietSamples_ + chunk, std::numeric_limits<int>::max() - wetBufCapacity_);
+            if (quietSamples_ >= fbDelay_.tailHorizonSamples() + kSleepSettle + latencySamples(oversampling_))
+                asleep_ = true;
+        }
+
+        // Asleep: silence, or the quantiser's dither alone when bits < 32.
+        // Nothing else runs and no other state moves.
+        void writeSleep_(const Simd::KernelTable &kernels, float *d0, float *d1, int chunk) noexcept
+        {
+            const auto bytes = static_cast<std::size_t>(chunk) * sizeof(float);
+            if (smoothedBits_ >= 32)
+            {
+                std::memset(d0, 0, bytes);
+                if (d1 != nullptr) std::memset(d1, 0, bytes);
+                return;
+            }
+
+            const float blockLsb = std::ldexp(1.0f, 1 - smoothedBits_);
+            std::memset(satL_.data(), 0, satL_.size() * sizeof(float));
+            std::fill(gainRamp_.begin(), gainRamp_.end(), 1.0f);
+            for (int t = 0; t < chunk; t += kTile)
+            {
+                const int n = std::min(kTile, chunk - t);
+                const int jFull = n & ~3;
+                float *t0 = d0 + t;
+                float *t1 = d1 != nullptr ? d1 + t : nullptr;
+                kernels.quantise(satL_.data(), gainRamp_.data(), t0, jFull, blockLsb, xorshiftSimdL_.data());
+                if (t1 != nullptr)
+                    kernels.quantise(satL_.data(), gainRamp_.data(), t1, jFull, blockLsb, xorshiftSimdR_.data());
+                for (int s = jFull; s < n; ++s)
+                {
+                    const float dither = (nextUniform(xorshiftL_) - nextUniform(xorshiftL_)) * blockLsb;
+                    t0[s] = std::round(dither / blockLsb) * blockLsb;
+                    if (t1 != nullptr)
                     {
-                        const float makeup = Math::outputMakeup(driveRamp_[u])
-                                             * Math::kOutputMakeupUnity;
-                        sat0 *= makeup;
-                        if (hasR) sat1 *= makeup;
+                        const float ditherR = (nextUniform(xorshiftR_) - nextUniform(xorshiftR_)) * blockLsb;
+                        t1[s] = std::round(ditherR / blockLsb) * blockLsb;
                     }
+                }
+            }
+        }
+
+        // Route one event to the subsystem that owns the parameter.
+        // Nothing else is recomputed.
+        void applyParamEvent_(const ParamEvent &e) noexcept
+        {
+            setParam(params_, e.id, e.value);
+            const Params &p = params_;
+            switch (e.id)
+            {
+                case ParamId::DriveLin: driveSmoother_.setTargetValue(p.driveLin); break;
+                case ParamId::Mix: mixSmoother_.setTargetValue(p.mix); break;
+                case ParamId::GainLin: gainSmoother_.setTargetValue(p.gainLin); break;
+                case ParamId::HpfHz:
+                    hpfSmoother_.setTargetValue(p.hpfHz);
+                    outFilters_.setCutoffs(p.hpfHz, p.lpfHz);
+                    break;
+                case ParamId::LpfHz:
+                    lpfSmoother_.setTargetValue(p.lpfHz);
+                    outFilters_.setCutoffs(p.hpfHz, p.lpfHz);
+                    break;
+                case ParamId::FilterMode:
+                    outFilters_.setMode(static_cast<Filters::OutputFilterStage::Mode>(p.filterMode));
+                    break;
+                case ParamId::Bits: smoothedBits_ = p.bits; break;
+                case ParamId::AdaaOrder: adaaOrder_ = p.adaaOrder; break;
+                case ParamId::DelaySamples: fbDelay_.setDelaySamples(p.delaySamples); break;
+                case ParamId::Feedback:
+                    feedback_ = p.feedback;
+                    fbDelay_.setFeedback(p.feedback);
+                    break;
+                case ParamId::DampHz: fbDelay_.setDampHz(p.dampHz); break;
+                case ParamId::LoopCutHz: fbDelay_.setLoopCutHz(p.loopCutHz); break;
+                case ParamId::CrossFeed: fbDelay_.setCrossFeed(p.crossFeed); break;
+                case ParamId::LoopDrive: fbDelay_.setLoopDrive(p.loopDrive); break;
+                case ParamId::LoopSatOrder: fbDelay_.setSatOrder(p.loopSatOrder); break;
+                case ParamId::Diffusion: fbDelay_.setDiffusion(p.diffusion); break;
+                case ParamId::DiffuserSize: fbDelay_.setDiffuserSize(p.diffuserSize); break;
+                case ParamId::DiffModDepth: fbDelay_.setDiffModDepth(p.diffModDepth); break;
+                case ParamId::DiffModRateHz: fbDelay_.setDiffModRateHz(p.diffModRateHz); break;
+                case ParamId::EnableDiffuser:
+                    enableDiffuser_ = p.enableDiffuser;
+                    fbDelay_.setEnableDiffuser(p.enableDiffuser);
+                    break;
+                case ParamId::DelayModDepth:
+                case ParamId::DelayModRateHz:
+                    fbDelay_.setDelayMod(p.delayModDepth, p.delayModRateHz);
+                    break;
+                case ParamId::DelayMode: fbDelay_.setDelayMode(p.delayMode); break;
+                case ParamId::Oversampling: setOversampling_(p.oversampling); break;
+                // Tempo sync is resolved to delaySamples by the caller.
+                case ParamId::DelaySync:
+                case ParamId::DelayDivision:
+                case ParamId::Count: break;
+            }
+        }
+
+        using ChunkFn = void (ChronosEngine::*)(const Simd::KernelTable &, float *, float *, int) noexcept;
 
-                    satL_[u] = alignL_.processWet(sat0);
-                    if (hasR) satR_[u] = alignR_.processWet(sat1);
+        static ChunkFn selectChunk_(int adaaOrder, bool stereo, bool quantise, bool economy,
+                                    int oversampling) noexcept
+        {
+            // Oversampling replaces ADAA, so order and precision drop out.
+            static constexpr ChunkFn kOversampled[2][2][2] = {
+                {
+                    {&ChronosEngine::processChunk_<0, false, false, false, 2>, &ChronosEngine::processChunk_<0, false, true, false, 2>},
+                    {&ChronosEngine::processChunk_<0, true, false, false, 2>, &ChronosEngine::processChunk_<0, true, true, false, 2>}
+                },
+                {
+                    {&ChronosEngine::processChunk_<0, false, false, false, 4>, &ChronosEngine::processChunk_<0, false, true, false, 4>},
+                    {&ChronosEngine::processChunk_<0, true, false, false, 4>, &ChronosEngine::processChunk_<0, true, true, false, 4>}
+                }
+            };
+            // Economy only changes the ADAA1 saturator.
+            static constexpr ChunkFn kEconomy[2][2] = {
+                {&ChronosEngine::processChunk_<1, false, false, true>, &ChronosEngine::processChunk_<1, false, true, true>},
+                {&ChronosEngine::processChunk_<1, true, false, true>, &ChronosEngine::processChunk_<1, true, true, true>}
+            };
+            static constexpr ChunkFn kTable[3][2][2] = {
+                {
+                    {&ChronosEngine::processChunk_<0, false, false>, &ChronosEngine::processChunk_<0, false, true>},
+                    {&ChronosEngine::processChunk_<0, true, false>, &ChronosEngine::processChunk_<0, true, true>}
+                },
+                {
+                    {&ChronosEngine::processChunk_<1, false, false>, &ChronosEngine::processChunk_<1, false, true>},
+                    {&ChronosEngine::processChunk_<1, true, false>, &ChronosEngine::processChunk_<1, true, true>}
+                },
+                {
+                    {&ChronosEngine::processChunk_<2, false, false>, &ChronosEngine::processChunk_<2, false, true>},
+                    {&ChronosEngine::processChunk_<2, true, false>, &ChronosEngine::processChunk_<2, true, true>}
                 }
+            };
+            if (oversampling > 1)
+                return kOversampled[oversampling > 2 ? 1 : 0][stereo ? 1 : 0][quantise ? 1 : 0];
+            const int order = std::clamp(adaaOrder, 0, 2);
+            if (economy && order == 1)
+                return kEconomy[stereo ? 1 : 0][quantise ? 1 : 0];
+            return kTable[order][stereo ? 1 : 0][quantise ? 1 : 0];
+        }
+
+        // Everything after the feedback line for one chunk: saturator,
+        // alignment, output filters, dry/wet crossfade, bypass blend and
+        // gain/quantiser, fused into one pass per kTile samples so the
+        // working set stays in L1. Decisions that were made per chunk
+        // still are. d1 is null for mono. The per-sample loops carry
+        // no mode branches; process() picks the instantiation.
+        template <int AdaaOrder, bool Stereo, bool Quantise, bool Economy = false, int Oversampling = 1>
+        void processChunk_(const Simd::KernelTable &kernels, float *d0, float *d1, int chunk) noexcept
+        {
+            const float blockLsb = std::ldexp(1.0f, 1 - smoothedBits_);
+
+            // Settled at full bypass or fully dry: the wet stages' output
+            // would be multiplied by zero, so they do not run. Decided from
+            // the smoothers before this chunk advances them.
+            const bool dryOnly = bypassSettled_() || mixSettledDry_();
+
+            // The crossfade shortcuts follow the mix smoother at the end
+            // of the chunk, which is known before the chunk runs.
+            const bool mixSettles = mixSmoother_.settlesWithin(chunk);
+            const bool fullDry = mixSettles && mixSmoother_.getTargetValue() <= 0.0f;
+            const bool fullWet = mixSettles && mixSmoother_.getTargetValue() >= 100.0f;
+
+            if (dryOnly)
+                wetElided_ = true;
+            else
+            {
+                if (wetElided_) reprimeWetStages_();
+                // Align the saturator latency, once per chunk.
+                align_.setMode(Oversampling > 1 ? Align::SaturatorAlign::kOversampled : AdaaOrder);
+            }
+
+            for (int t = 0; t < chunk; t += kTile)
+            {
+                const int n = std::min(kTile, chunk - t);
+                float *t0 = d0 + t;
+                float *t1 = Stereo ? d1 + t : nullptr;
 
-                // Output filter stage.
-                outFilters_.setCutoffs(hpfRamp_[0], lpfRamp_[0]);
-                outFilters_.process(satL_.data(),
-                                    hasR ? satR_.data() : nullptr,
-                                    wetPostSvfL_.data(),
-                                    hasR ? wetPostSvfR_.data() : nullptr,
-                                    chunk);
-
-                // Equal-power dry/wet crossfade.
-                const float mixVal = mixSmoother_.getCurrentValue();
-                const bool settled = !mixSmoother_.isSmoothing();
-                const bool fullDry = settled && mixVal <= 0.0f;
-                const bool fullWet = settled && mixVal >= 100.0f;
-
-                if (fullDry)
+                for (int s = 0; s < n; ++s)
                 {
-                    for (int s = 0; s < chunk; ++s)
-                    {
-                        const auto u = static_cast<std::size_t>(s);
-                        data0[offset + s] = alignedDryL_[u];
-                        if (hasR) data1[offset + s] = alignedDryR_[u];
-                    }
-                } else if (fullWet)
+                    smoothen_();
+                    driveRamp_[static_cast<std::size_t>(s)] = smoothedDrive_;
+                    hpfRamp_[static_cast<std::size_t>(s)] = smoothedHpf_;
+                    lpfRamp_[static_cast<std::size_t>(s)] = smoothedLpf_;
+                    thetaRamp_[static_cast<std::size_t>(s)] =
+                            (smoothedMix_ * 0.01f) * (std::numbers::pi_v<float> * 0.5f);
+                    gainRamp_[static_cast<std::size_t>(s)] = smoothedGain_;
+                }
+
+                if (dryOnly)
                 {
-                    for (int s = 0; s < chunk; ++s)
+                    // Only the dry alignment and the bypass input run.
+                    for (int s = 0; s < n; ++s)
                     {
                         const auto u = static_cast<std::size_t>(s);
-                        data0[offset + s] = wetPostSvfL_[u];
-                        if (hasR) data1[offset + s] = wetPostSvfR_[u];
-                    }
-                } else
-                {
-                    // SIMD path
-                    const int jFull = chunk & ~3;
-                    for (int s = 0; s + 4 <= chunk; s += 4)
-                    {
-                        const M128 vTheta = MM(loadu_ps)(thetaRamp_.data() + s);
-                        const M128 vCos = mmCos(vTheta);
-                        const M128 vSin = mmSin(vTheta);
-                        // L: dry*cos + wet*sin
-                        const M128 vDryL = MM(loadu_ps)(alignedDryL_.data() + s);
-                        const M128 vWetL = MM(loadu_ps)(wetPostSvfL_.data() + s);
-                        const M128 vOutL = FMADD(vDryL, vCos, MM(mul_ps)(vWetL, vSin));
-                        MM(storeu_ps)(data0 + offset + s, vOutL);
-                        if (hasR)
+                        if constexpr (Stereo)
+                        {
+                            float l = t0[s];
+                            float r = t1[s];
+                            bypassDryInL_[u] = l;
+                            bypassDryInR_[u] = r;
+                            align_.processDry(l, r);
+                            if constexpr (Oversampling > 1) osDry_.process(l, r);
+                            t0[s] = l;
+                            t1[s] = r;
+                        } else
                         {
-                            const M128 vDryR = MM(loadu_ps)(alignedDryR_.data() + s);
-                            const M128 vWetR = MM(loadu_ps)(wetPostSvfR_.data() + s);
-                            const M128 vOutR = FMADD(vDryR, vCos, MM(mul_ps)(vWetR, vSin));
-                            MM(storeu_ps)(data1 + offset + s, vOutR);
+                            bypassDryInL_[u] = t0[s];
+                            t0[s] = align_.processDry(t0[s]);
+                            if constexpr (Oversampling > 1) t0[s] = osDry_.process(t0[s]);
                         }
                     }
-                    // Scalar tail
-                    for (int s = jFull; s < chunk; ++s)
-                    {
-                        const auto u = static_cast<std::size_t>(s);
-                        const float dryGain = mmCos(thetaRamp_[u]);
-                        const float wetGain = mmSin(thetaRamp_[u]);
-                        data0[offset + s] = alignedDryL_[u] * dryGain + wetPostSvfL_[u] * wetGain;
-                        if (hasR) data1[offset + s] = alignedDryR_[u] * dryGain + wetPostSvfR_[u] * wetGain;
-                    }
+                } else
+                {
+                    // Output filter cutoffs follow the chunk's first sample.
+                    if (t == 0) outFilters_.setCutoffs(hpfRamp_[0], lpfRamp_[0]);
+                    processWetTile_<AdaaOrder, Stereo, Economy, Oversampling>(kernels, t0, t1, t, n, fullDry, fullWet);
                 }
 
-                const bool bypassQuant = (smoothedBits_ >= 32);
-                const int jFull = chunk & ~3;
-                if (bypassQuant)
+                finishTile_<Stereo, Quantise>(kernels, t0, t1, n, blockLsb);
+            }
+        }
+
+        // The output saturator's quiet-tile path: the tile, driven, into
+        // double scratch and through the ADAA's trySeriesBlock. False, with
+        // the ADAA untouched, when the tile is too loud for it.
+        template <int AdaaOrder, bool Stereo>
+        bool trySeriesTile_(const float *wetL, const float *wetR, int n) noexcept
+        {
+            for (int s = 0; s < n; ++s)
+            {
+                const auto u = static_cast<std::size_t>(s);
+                seriesInL_[u] = driveRamp_[u] * wetL[s];
+                if constexpr (Stereo) seriesInR_[u] = driveRamp_[u] * wetR[s];
+            }
+            const double *inR = Stereo ? seriesInR_.data() : nullptr;
+            if constexpr (AdaaOrder == 1)
+                return adaa1_.trySeriesBlock(seriesInL_.data(), inR, seriesOutL_.data(), seriesOutR_.data(), n);
+            else
+                return adaa2_.trySeriesBlock(seriesInL_.data(), inR, seriesOutL_.data(), seriesOutR_.data(), n);
+        }
+
+        // Saturator, alignment, output filters and the dry/wet crossfade
+        // for one tile starting at chunk offset t. Writes the mixed signal
+        // to d0/d1.
+        template <int AdaaOrder, bool Stereo, bool Economy, int Oversampling>
+        void processWetTile_(const Simd::KernelTable &kernels, float *d0, float *d1, int t, int n,
+                             bool fullDry, bool fullWet) noexcept
+        {
+            const float *wetL = wetBufL_.data() + t;
+            const float *wetR = wetBufR_.data() + t;
+
+            // A quiet tile goes through the ADAA's series path up front; the
+            // loop below picks its output up.
+            bool series = false;
+            if constexpr (AdaaOrder > 0 && !Economy && Oversampling == 1)
+                if (seriesFastPath_) series = trySeriesTile_<AdaaOrder, Stereo>(wetL, wetR, n);
+
+            for (int s = 0; s < n; ++s)
+            {
+                const auto u = static_cast<std::size_t>(s);
+
+                float sat0 = wetL[s];
+                float sat1 = Stereo ? wetR[s] : 0.0f;
+
+                // Stereo runs packed: L and R share each stage's call.
+                if constexpr (Stereo)
                 {
-                    // No dither, no quantiser. Apply the bypass blend and the gain.
-                    for (int s = 0; s + 4 <= chunk; s += 4)
+                    float l = d0[s];
+                    float r = d1[s];
+                    bypassDryInL_[u] = l;
+                    bypassDryInR_[u] = r;
+                    align_.processDry(l, r);
+                    if constexpr (Oversampling > 1) osDry_.process(l, r);
+                    alignedDryL_[u] = l;
+                    alignedDryR_[u] = r;
+
+                    if constexpr (Oversampling > 1)
                     {
-                        alignas(16) std::array<float, 4> bl{};
-                        alignas(16) std::array<float, 4> br{};
-                        for (int t = 0; t < 4; ++t)
-                        {
-                            const auto ut = static_cast<std::size_t>(s + t);
-                            const float bypassAmt = bypassSmoother_.getNextValue();
-                            bl[t] = data0[offset + s + t] * (1.0f - bypassAmt) + bypassDryL_.process(bypassDryInL_[ut])
-                                    * bypassAmt;
-                            if (hasR)
-                                br[t] = data1[offset + s + t] * (1.0f - bypassAmt) + bypassDryR_.process(
-                                            bypassDryInR_[ut]) * bypassAmt;
-                        }
-                        const M128 vGain = MM(loadu_ps)(gainRamp_.data() + s);
-                        MM(storeu_ps)(data0 + offset + s, MM(mul_ps)(MM(load_ps)(bl.data()), vGain));
-                        if (hasR)
-                            MM(storeu_ps)(data1 + offset + s, MM(mul_ps)(MM(load_ps)(br.data()), vGain));
-                    }
-                    for (int s = jFull; s < chunk; ++s)
+                        // Driven into the tile buffers; the oversampler
+                        // runs on the whole tile below.
+                        satL_[u] = driveRamp_[u] * sat0;
+                        satR_[u] = driveRamp_[u] * sat1;
+                        continue;
+                    } else if constexpr (Economy)
                     {
-                        const auto u = static_cast<std::size_t>(s);
-                        const float gainLin = gainRamp_[u];
-                        const float bypassAmt = bypassSmoother_.getNextValue();
-                        const float blend = data0[offset + s] * (1.0f - bypassAmt)
-                                            + bypassDryL_.process(bypassDryInL_[u]) * bypassAmt;
-                        data0[offset + s] = blend * gainLin;
-                        if (hasR)
+                        sat0 = adaa1EcoL_.process(driveRamp_[u] * sat0);
+                        sat1 = adaa1EcoR_.process(driveRamp_[u] * sat1);
+                    } else if constexpr (AdaaOrder > 0)
+                    {
+                        double w0 = driveRamp_[u] * sat0;
+                        double w1 = driveRamp_[u] * sat1;
+                        if (series)
                         {
-                            const float blendR = data1[offset + s] * (1.0f - bypassAmt) + bypassDryR_.process(
-                                                     bypassDryInR_[u]) * bypassAmt;
-                            data1[offset + s] = blendR * gainLin;
-                        }
+                            w0 = seriesOutL_[u];
+                            w1 = seriesOutR_[u];
+                        } else if constexpr (AdaaOrder == 1) adaa1_.process(w0, w1);
+                        else adaa2_.process(w0, w1);
+                        sat0 = static_cast<float>(w0);
+                        sat1 = static_cast<float>(w1);
                     }
                 } else
                 {
-                    const M128 vLsb = MM(set1_ps)(blockLsb);
-                    const M128 vInvLsb = MM(set1_ps)(1.0f / blockLsb);
-                    const M128 vHalf = MM(set1_ps)(0.5f);
-                    const M128 vSignMask = MM(set1_ps)(-0.0f);
-                    for (int s = 0; s + 4 <= chunk; s += 4)
-                    {
-                        alignas(16) std::array<float, 4> bl{};
-                        alignas(16) std::array<float, 4> br{};
-                        for (int t = 0; t < 4; ++t)
-                        {
-                            const auto ut = static_cast<std::size_t>(s + t);
-                            const float bypassAmt = bypassSmoother_.getNextValue();
-                            bl[t] = data0[offset + s + t] * (1.0f - bypassAmt)
-                                    + bypassDryL_.process(bypassDryInL_[ut]) * bypassAmt;
-                            if (hasR)
-                                br[t] = data1[offset + s + t] * (1.0f - bypassAmt)
-                                        + bypassDryR_.process(bypassDryInR_[ut]) * bypassAmt;
-                        }
-                        // L
-                        {
-                            const M128 vBlend = MM(load_ps)(bl.data());
-                            const M128 vGain = MM(loadu_ps)(gainRamp_.data() + s);
-                            const M128 vScaled = MM(mul_ps)(vBlend, vGain);
-                            const M128 vD1 = nextUniformSimd_(xorshiftSimdL_);
-                            const M128 vD2 = nextUniformSimd_(xorshiftSimdL_);
-                            const M128 vDither = MM(mul_ps)(MM(sub_ps)(vD1, vD2), vLsb);
-                            const M128 vQ = MM(mul_ps)(MM(add_ps)(vScaled, vDither), vInvLsb);
-
-                            const M128 vSign = MM(and_ps)(vQ, vSignMask);
-                            const M128 vShifted = MM(add_ps)(vQ, MM(or_ps)(vHalf, vSign));
-
-                            const M128I vInt = MM(cvttps_epi32)(vShifted);
-                            const M128 vRounded = MM(cvtepi32_ps)(vInt);
-                            MM(storeu_ps)(data0 + offset + s, MM(mul_ps)(vRounded, vLsb));
-                        }
-                        if (hasR)
-                        {
-                            const M128 vBlend = MM(load_ps)(br.data());
-                            const M128 vGain = MM(loadu_ps)(gainRamp_.data() + s);
-                            const M128 vScaled = MM(mul_ps)(vBlend, vGain);
-                            const M128 vD1 = nextUniformSimd_(xorshiftSimdR_);
-                            const M128 vD2 = nextUniformSimd_(xorshiftSimdR_);
-                            const M128 vDither = MM(mul_ps)(MM(sub_ps)(vD1, vD2), vLsb);
-                            const M128 vQ = MM(mul_ps)(MM(add_ps)(vScaled, vDither), vInvLsb);
-                            const M128 vSign = MM(and_ps)(vQ, vSignMask);
-                            const M128 vShifted = MM(add_ps)(vQ, MM(or_ps)(vHalf, vSign));
-                            const M128I vInt = MM(cvttps_epi32)(vShifted);
-                            const M128 vRounded = MM(cvtepi32_ps)(vInt);
-                            MM(storeu_ps)(data1 + offset + s, MM(mul_ps)(vRounded, vLsb));
-                        }
-                    }
-                    // Scalar tail
-                    for (int s = jFull; s < chunk; ++s)
+                    bypassDryInL_[u] = d0[s];
+                    alignedDryL_[u] = align_.processDry(d0[s]);
+
+                    if constexpr (Oversampling > 1)
                     {
-                        const auto u = static_cast<std::size_t>(s);
-                        const float gainLin = gainRamp_[u];
-                        const float bypassAmt = bypassSmoother_.getNextValue(); {
-                            const float blend = data0[offset + s] * (1.0f - bypassAmt)
-                                                + bypassDryL_.process(bypassDryInL_[u]) * bypassAmt;
-                            const float scaled = blend * gainLin;
-                            const float dither = (nextUniform(xorshiftL_) - nextUniform(xorshiftL_)) * blockLsb;
-                            data0[offset + s] = std::round((scaled + dither) / blockLsb) * blockLsb;
-                        }
-                        if (hasR)
-                        {
-                            const float blend = data1[offset + s] * (1.0f - bypassAmt)
-                                                + bypassDryR_.process(bypassDryInR_[u]) * bypassAmt;
-                            const float scaled = blend * gainLin;
-                            const float dither = (nextUniform(xorshiftR_) - nextUniform(xorshiftR_)) * blockLsb;
-                            data1[offset + s] = std::round((scaled + dither) / blockLsb) * blockLsb;
-                        }
-                    }
+                        alignedDryL_[u] = osDry_.process(alignedDryL_[u]);
+                        satL_[u] = driveRamp_[u] * sat0;
+                        continue;
+                    } else if constexpr (Economy)
+                        sat0 = adaa1EcoL_.process(driveRamp_[u] * sat0);
+                    else if (series)
+                        sat0 = static_cast<float>(seriesOutL_[u]);
+                    else if constexpr (AdaaOrder == 1)
+                        sat0 = static_cast<float>(adaa1_.process(driveRamp_[u] * sat0));
+                    else if constexpr (AdaaOrder == 2)
+                        sat0 = static_cast<float>(adaa2_.process(driveRamp_[u] * sat0));
                 }
 
-                offset += chunk;
+                if constexpr (AdaaOrder > 0)
+                {
+                    const float makeup = Math::outputMakeup(driveRamp_[u])
+                                         * Math::kOutputMakeupUnity;
+                    sat0 *= makeup;
+                    if constexpr (Stereo) sat1 *= makeup;
+                }
+
+                if constexpr (Stereo)
+                {
+                    align_.processWet(sat0, sat1);
+                    satL_[u] = sat0;
+                    satR_[u] = sat1;
+                } else
+                {
+                    satL_[u] = align_.processWet(sat0);
+                }
             }
-        }
 
-        [[nodiscard]] static constexpr int latencySamples() noexcept
-        {
-            return Align::SaturatorAlign::kBudget;
-        }
+            if constexpr (Oversampling > 1)
+            {
+                osL_.process(satL_.data(), n);
+                if constexpr (Stereo) osR_.process(satR_.data(), n);
 
-        [[nodiscard]] int getWetBufCapacity() const noexcept { return wetBufCapacity_; }
+                // The makeup follows the drive ramp undelayed; the ramp
+                // barely moves across the oversampler's latency.
+                for (int s = 0; s < n; ++s)
+                {
+                    const auto u = static_cast<std::size_t>(s);
+                    const float makeup = Math::outputMakeup(driveRamp_[u]) * Math::kOutputMakeupUnity;
+                    if constexpr (Stereo)
+                    {
+                        float l = satL_[u] * makeup;
+                        float r = satR_[u] * makeup;
+                        align_.processWet(l, r);
+                        satL_[u] = l;
+                        satR_[u] = r;
+                    } else
+                    {
+                        satL_[u] = align_.processWet(satL_[u] * makeup);
+                    }
+                }
+            }
 
-        void setDitherSeeds(std::uint32_t l, std::uint32_t r) noexcept
-        {
-            xorshiftL_ = l;
-            xorshiftR_ = r;
+            // Output filter stage.
+            outFilters_.process(satL_.data(),
+                                Stereo ? satR_.data() : nullptr,
+                                wetPostSvfL_.data(),
+                                Stereo ? wetPostSvfR_.data() : nullptr,
+                                n);
 
-            std::array<std::uint32_t, 4> seedsL = {l, l * 2654435761u + 1u, l * 40503u + 2u, l * 2246822519u + 3u};
-            std::array<std::uint32_t, 4> seedsR = {r, r * 2654435761u + 1u, r * 40503u + 2u, r * 2246822519u + 3u};
-            for (int i = 0; i < 4; ++i)
+            // Equal-power dry/wet crossfade.
+            const auto bytes = static_cast<std::size_t>(n) * sizeof(float);
+
+            if (fullDry)
             {
-                if (seedsL[static_cast<std::size_t>(i)] == 0u) seedsL[static_cast<std::size_t>(i)] = 1u;
-                if (seedsR[static_cast<std::size_t>(i)] == 0u) seedsR[static_cast<std::size_t>(i)] = 1u;
+                std::memcpy(d0, alignedDryL_.data(), bytes);
+                if constexpr (Stereo) std::memcpy(d1, alignedDryR_.data(), bytes);
+            } else if (fullWet)
+            {
+                std::memcpy(d0, wetPostSvfL_.data(), bytes);
+                if constexpr (Stereo) std::memcpy(d1, wetPostSvfR_.data(), bytes);
+            } else
+            {
+                // SIMD path on the dispatched tier
+                const int jFull = n & ~3;
+                kernels.crossfade(thetaRamp_.data(),
+                                  alignedDryL_.data(), wetPostSvfL_.data(), d0,
+                                  Stereo ? alignedDryR_.data() : nullptr,
+                                  Stereo ? wetPostSvfR_.data() : nullptr,
+                                  d1,
+                                  jFull);
+                // Scalar tail
+                for (int s = jFull; s < n; ++s)
+                {
+                    const auto u = static_cast<std::size_t>(s);
+                    const float dryGain = mmCos(thetaRamp_[u]);
+                    const float wetGain = mmSin(thetaRamp_[u]);
+                    d0[s] = alignedDryL_[u] * dryGain + wetPostSvfL_[u] * wetGain;
+                    if constexpr (Stereo) d1[s] = alignedDryR_[u] * dryGain + wetPostSvfR_[u] * wetGain;
+                }
             }
-            alignas(16) std::array<std::uint32_t, 4> vL = {seedsL[0], seedsL[1], seedsL[2], seedsL[3]};
-            alignas(16) std::array<std::uint32_t, 4> vR = {seedsR[0], seedsR[1], seedsR[2], seedsR[3]};
-            xorshiftSimdL_ = MM(load_si128)(reinterpret_cast<const M128I *>(vL.data()));
-            xorshiftSimdR_ = MM(load_si128)(reinterpret_cast<const M128I *>(vR.data()));
         }
 
-        void setBypass(bool bypassed) noexcept
+        // Bypass blend, output gain and the optional quantiser for one tile.
+        template <bool Stereo, bool Quantise>
+        void finishTile_(const Simd::KernelTable &kernels, float *d0, float *d1, int n, float blockLsb) noexcept
         {
-            const float newTarget = bypassed ? 1.0f : 0.0f;
-            if (newTarget != bypassTarget_)
+            const int jFull = n & ~3;
+
+            // Bypass blend into satL_/satR_, which are free once the
+            // output filters have run. Both channels read io before
+            // either is written, so aliased L/R buffers stay correct.
+            // The smoother and the dry delays advance per sample, so
+            // this stays scalar.
+            for (int s = 0; s < jFull; ++s)
             {
-                bypassTarget_ = newTarget;
-                bypassSmoother_.setTargetValue(newTarget);
+                const auto u = static_cast<std::size_t>(s);
+                const float bypassAmt = bypassSmoother_.getNextValue();
+                satL_[u] = d0[s] * (1.0f - bypassAmt)
+                           + bypassDryL_.process(bypassDryInL_[u]) * bypassAmt;
+                if constexpr (Stereo)
+                    satR_[u] = d1[s] * (1.0f - bypassAmt)
+                               + bypassDryR_.process(bypassDryInR_[u]) * bypassAmt;
+            }
+
+            if constexpr (!Quantise)
+            {
+                // No dither, no quantiser. Apply the gain.
+                kernels.applyGain(satL_.data(), gainRamp_.data(), d0, jFull);
+                if constexpr (Stereo) kernels.applyGain(satR_.data(), gainRamp_.data(), d1, jFull);
+
+                for (int s = jFull; s < n; ++s)
+                {
+                    const auto u = static_cast<std::size_t>(s);
+                    const float gainLin = gainRamp_[u];
+                    const float bypassAmt = bypassSmoother_.getNextValue();
+                    const float blend = d0[s] * (1.0f - bypassAmt)
+                                        + bypassDryL_.process(bypassDryInL_[u]) * bypassAmt;
+                    d0[s] = blend * gainLin;
+                    if constexpr (Stereo)
+                    {
+                        const float blendR = d1[s] * (1.0f - bypassAmt)
+                                             + bypassDryR_.process(bypassDryInR_[u]) * bypassAmt;
+                        d1[s] = blendR * gainLin;
+                    }
+                }
+            } else
+            {
+                kernels.quantise(satL_.data(), gainRamp_.data(), d0, jFull, blockLsb,
+                                 xorshiftSimdL_.data());
+                if constexpr (Stereo)
+                    kernels.quantise(satR_.data(), gainRamp_.data(), d1, jFull, blockLsb,
+                                     xorshiftSimdR_.data());
+
+                // Scalar tail
+                for (int s = jFull; s < n; ++s)
+                {
+                    const auto u = static_cast<std::size_t>(s);
+                    const float gainLin = gainRamp_[u];
+                    const float bypassAmt = bypassSmoother_.getNextValue(); {
+                        const float blend = d0[s] * (1.0f - bypassAmt)
+                                            + bypassDryL_.process(bypassDryInL_[u]) * bypassAmt;
+                        const float scaled = blend * gainLin;
+                        const float dither = (nextUniform(xorshiftL_) - nextUniform(xorshiftL_)) * blockLsb;
+                        d0[s] = std::round((scaled + dither) / blockLsb) * blockLsb;
+                    }
+                    if constexpr (Stereo)
+                    {
+                        const float blend = d1[s] * (1.0f - bypassAmt)
+                                            + bypassDryR_.process(bypassDryInR_[u]) * bypassAmt;
+                        const float scaled = blend * gainLin;
+                        const float dither = (nextUniform(xorshiftR_) - nextUniform(xorshiftR_)) * blockLsb;
+                        d1[s] = std::round((scaled + dither) / blockLsb) * blockLsb;
+                    }
+                }
             }
         }
 
-    private:
         void smoothen_() noexcept
         {
             smoothedGain_ = gainSmoother_.getNextValue();
@@ -533,16 +1094,30 @@ namespace MarsDSP
         std::span<float> wetBufL_;
         std::span<float> wetBufR_;
         int wetBufCapacity_{0};
+        std::size_t scratchBytes_{0};
 
         Filters::OutputFilterStage outFilters_;
 
-        Nonlinear::ADAA1<Nonlinear::TanhNL> adaa1L_;
-        Nonlinear::ADAA1<Nonlinear::TanhNL> adaa1R_;
-        Nonlinear::ADAA2<Nonlinear::TanhNL> adaa2L_;
-        Nonlinear::ADAA2<Nonlinear::TanhNL> adaa2R_;
-
-        Align::SaturatorAlign alignL_;
-        Align::SaturatorAlign alignR_;
+        // L and R packed; mono runs the left lane.
+        Nonlinear::StereoADAA1<Nonlinear::TanhNL> adaa1_;
+        Nonlinear::StereoADAA2<Nonlinear::TanhNL> adaa2_;
+        // AdaaPrecision::Economy at order 1, one float instance per channel.
+        Nonlinear::ADAA1<Nonlinear::TanhNLEconomy> adaa1EcoL_;
+        Nonlinear::ADAA1<Nonlinear::TanhNLEconomy> adaa1EcoR_;
+        Nonlinear::AdaaPrecision adaaPrecision_{Nonlinear::AdaaPrecision::Standard};
+        // The quiet-tile series path: driven input and output, per tile.
+        bool seriesFastPath_{true};
+        alignas(16) std::array<double, kTile> seriesInL_{};
+        alignas(16) std::array<double, kTile> seriesInR_{};
+        alignas(16) std::array<double, kTile> seriesOutL_{};
+        alignas(16) std::array<double, kTile> seriesOutR_{};
+        Align::StereoSaturatorAlign align_;
+        // Params::oversampling > 1: the output saturator runs here instead
+        // of ADAA, and osDry_ carries the dry path past kBudget to match.
+        Oversampler osL_;
+        Oversampler osR_;
+        Align::StereoShortDelay<kMaxLatency - Align::SaturatorAlign::kBudget> osDry_;
+        int oversampling_{1};
 
         std::uint32_t xorshiftL_{0x12345678u};
         std::uint32_t xorshiftR_{0x9abcdef0u};
@@ -555,21 +1130,9 @@ namespace MarsDSP
             return static_cast<float>(state >> 8) * (1.0f / 16777216.0f);
         }
 
-        M128I xorshiftSimdL_{};
-        M128I xorshiftSimdR_{};
-
-        static M128 nextUniformSimd_(M128I &state) noexcept
-        {
-            // xorshift32 on all 4 lanes: x ^= x<<13; x ^= x>>17; x ^= x<<5
-            state = MM(xor_si128)(state, MM(slli_epi32)(state, 13));
-            state = MM(xor_si128)(state, MM(srli_epi32)(state, 17));
-            state = MM(xor_si128)(state, MM(slli_epi32)(state, 5));
-
-            // top 24 bits -> float in [0, 1)
-            const M128I shifted = MM(srli_epi32)(state, 8);
-            const M128 asFloat = MM(cvtepi32_ps)(shifted);
-            return MM(mul_ps)(asFloat, MM(set1_ps)(1.0f / 16777216.0f));
-        }
+        // 4-lane xorshift32 states for the dispatched quantiser.
+        std::array<std::uint32_t, 4> xorshiftSimdL_{};
+        std::array<std::uint32_t, 4> xorshiftSimdR_{};
 
         Smoothers::LinearSmoother<float> gainSmoother_;
         Smoothers::LinearSmoother<float> hpfSmoother_;
@@ -586,8 +1149,8 @@ namespace MarsDSP
 
         Smoothers::LinearSmoother<float> bypassSmoother_;
         float bypassTarget_{0.0f};
-        Align::ShortDelay<Align::SaturatorAlign::kBudget> bypassDryL_;
-        Align::ShortDelay<Align::SaturatorAlign::kBudget> bypassDryR_;
+        Align::ShortDelay<kMaxLatency> bypassDryL_;
+        Align::ShortDelay<kMaxLatency> bypassDryR_;
 
         Memory::BumpArena arena_;
         std::span<float> driveRamp_;
@@ -604,6 +1167,23 @@ namespace MarsDSP
         std::span<float> bypassDryInL_;
         std::span<float> bypassDryInR_;
 
+        Params params_{};
+        std::array<ParamEvent, kMaxParamEvents> events_{};
+        int numEvents_{0};
+
+        // Work elision: set while the loop or the wet stages are skipped.
+        bool loopElided_{false};
+        bool wetElided_{false};
+
+        // Tail-aware sleep. About -120 dBFS.
+        static constexpr float kSleepThreshold = 1.0e-6f;
+        // Output stage settle after the loop goes quiet: the output filters
+        // and ADAA history, on top of the dry/wet alignment delay.
+        static constexpr int kSleepSettle = 2048;
+        bool sleepEnabled_{true};
+        bool asleep_{false};
+        int quietSamples_{0};
+
         double sampleRate_{0.0};
         int numChannels_{0};
         int adaaOrder_{2};
@@ -0,0 +1,983 @@
+#pragma once
+
+#ifndef CHRONOS_CHRONOS_ENGINE_BANK_H
+#define CHRONOS_CHRONOS_ENGINE_BANK_H
+
+#include "ChronosEngine.h"
+#include "FeedbackDelay.h"
+#include "OutputFilterStage.h"
+#include "StateVariable.h"
+#include "nonlinear/ADAA1.h"
+#include "nonlinear/ADAA2.h"
+#include "nonlinear/Nonlinearities.h"
+#include "align/HalfSampleFir.h"
+#include "align/SaturatorAlign.h"
+#include "math/SaturatorMakeup.h"
+#include "math/Trigonometry.h"
+#include "simd/Config.h"
+#include "utils/memory/BumpArena.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <numbers>
+#include <span>
+
+namespace MarsDSP
+{
+    /**
+     * Batch engine: Lanes independent Chronos instances, one per SIMD lane.
+     * Each lane keeps its own ChronosEngine::Params, feedback line and
+     * saturator state. The feedback lines run per lane; every post-loop
+     * stage runs struct-of-arrays across the lanes, four per M128:
+     * the parameter ramps, the drive and makeup, SaturatorAlign, the
+     * digital output filters, the crossfade, the bypass blend and the
+     * dithered quantiser. The ADAA recurrences stay scalar double per lane.
+     * Analog-mode lanes take a per-lane Sallen-Key path and fade against
+     * the lane's digital output the way OutputFilterStage does.
+     *
+     * Audio is lane-major at the boundary: io[lane][channel][sample].
+     * Internally it is sample-major, index s * Lanes + lane.
+     */
+    template <int Lanes>
+    class ChronosEngineBank
+    {
+    public:
+        static_assert(Lanes == 4 || Lanes == 8, "ChronosEngineBank runs 4 or 8 lanes");
+        static constexpr int kLanes = Lanes;
+        static constexpr int kGroups = Lanes / 4;
+
+        using Params = ChronosEngine::Params;
+
+        void prepare(double sampleRate, int maxBlockSize, int numChannels) noexcept
+        {
+            assert(sampleRate > 0.0);
+            assert(maxBlockSize > 0);
+            assert(numChannels == 1 || numChannels == 2);
+
+            sampleRate_ = sampleRate;
+            numChannels_ = numChannels;
+            wetBufCapacity_ = std::max(1, 2 * maxBlockSize);
+
+            const auto cap = static_cast<std::size_t>(wetBufCapacity_);
+            const std::size_t strideFloats = (cap + 15u) & ~static_cast<std::size_t>(15u);
+            const std::size_t soaFloats = strideFloats * static_cast<std::size_t>(Lanes);
+
+            const int maxDelaySamp =
+                    Delays::SimdDelayLine::maxDelaySamplesFor(sampleRate, 5000.0f);
+            const std::size_t ringFloats =
+                    Delays::FeedbackDelay::ringStorageFloats(sampleRate, wetBufCapacity_, maxDelaySamp);
+
+            // Per lane: the feedback rings and two lane-major wet buffers.
+            // Shared: kNumSoa sample-major scratch spans of Lanes * cap.
+            arena_.reset(static_cast<std::size_t>(Lanes) * (ringFloats + 2u * strideFloats) * sizeof(float)
+                         + static_cast<std::size_t>(kNumSoa) * soaFloats * sizeof(float));
+
+            auto take = [&](std::span<float> &s, std::size_t floats)
+            {
+                auto *q = arena_.allocate<float>(floats, Memory::BumpArena::kBaseAlignment);
+                assert(q != nullptr); // sized by construction; cannot exhaust
+                std::memset(q, 0, floats * sizeof(float));
+                s = {q, floats};
+            };
+
+            for (int l = 0; l < Lanes; ++l)
+            {
+                auto &ln = lanes_[static_cast<std::size_t>(l)];
+                ln.fbDelay.prepare(sampleRate, wetBufCapacity_, maxDelaySamp, arena_);
+                take(ln.wetL, strideFloats);
+                take(ln.wetR, strideFloats);
+                ln.analog.prepare(sampleRate, numChannels);
+                ln.analog.setMode(Filters::OutputFilterStage::Mode::Analog);
+            }
+            take(inL_, soaFloats);
+            take(inR_, soaFloats);
+            take(wetL_, soaFloats);
+            take(wetR_, soaFloats);
+            take(alignedDryL_, soaFloats);
+            take(alignedDryR_, soaFloats);
+            take(bypassDryL_, soaFloats);
+            take(bypassDryR_, soaFloats);
+            take(satL_, soaFloats);
+            take(satR_, soaFloats);
+            take(driveRamp_, soaFloats);
+            take(thetaRamp_, soaFloats);
+            take(gainRamp_, soaFloats);
+
+            constexpr double kRampSeconds = 0.02;
+            gain_.reset(sampleRate, kRampSeconds);
+            hpf_.reset(sampleRate, kRampSeconds);
+            lpf_.reset(sampleRate, kRampSeconds);
+            mix_.reset(sampleRate, kRampSeconds);
+            drive_.reset(sampleRate, kRampSeconds);
+            bypass_.reset(sampleRate, 0.01);
+
+            fadeLengthSamples_ = std::max(1, static_cast<int>(std::round(0.02 * sampleRate)));
+
+            for (int l = 0; l < Lanes; ++l)
+                setDitherSeeds(l, 0x12345678u + 0x9e3779b9u * static_cast<std::uint32_t>(l),
+                               0x9abcdef0u + 0x7f4a7c15u * static_cast<std::uint32_t>(l));
+
+            reset();
+        }
+
+        void reset() noexcept
+        {
+            for (auto &ln: lanes_)
+            {
+                ln.fbDelay.reset();
+                ln.adaa1L.reset();
+                ln.adaa1R.reset();
+                ln.adaa2L.reset();
+                ln.adaa2R.reset();
+                ln.analog.reset();
+                ln.fadeStep = 0;
+                ln.fading = false;
+                ln.currentAnalog = ln.targetAnalog;
+                ln.lastDrive = -1.0f;
+                ln.loopElided = false;
+                ln.wetElided = false;
+            }
+            svfHpfL_.reset();
+            svfHpfR_.reset();
+            svfLpfL_.reset();
+            svfLpfR_.reset();
+
+            dryRingL_.fill(MM(setzero_ps)());
+            dryRingR_.fill(MM(setzero_ps)());
+            rawRingL_.fill(MM(setzero_ps)());
+            rawRingR_.fill(MM(setzero_ps)());
+            wetRingL_.fill({});
+            wetRingR_.fill({});
+            firL_.fill(MM(setzero_ps)());
+            firR_.fill(MM(setzero_ps)());
+            ringPos_ = 0;
+            firPos_ = 0;
+
+            bypass_.snap(0.0f);
+            bypassTarget_.fill(0.0f);
+        }
+
+        void resetParams(int lane, const Params &p) noexcept
+        {
+            applyLaneParams_(lane, p, /*snap=*/true);
+        }
+
+        void setParams(int lane, const Params &p) noexcept
+        {
+            applyLaneParams_(lane, p, /*snap=*/false);
+        }
+
+        void setBypass(int lane, bool bypassed) noexcept
+        {
+            assert(lane >= 0 && lane < Lanes);
+            const float newTarget = bypassed ? 1.0f : 0.0f;
+            if (newTarget != bypassTarget_[static_cast<std::size_t>(lane)])
+            {
+                bypassTarget_[static_cast<std::size_t>(lane)] = newTarget;
+                bypass_.setTarget(lane, newTarget);
+            }
+        }
+
+        void setDitherSeeds(int lane, std::uint32_t l, std::uint32_t r) noexcept
+        {
+            assert(lane >= 0 && lane < Lanes);
+            const auto g = static_cast<std::size_t>(lane / 4);
+            const int k = lane % 4;
+            alignas(16) std::array<std::uint32_t, 4> vL{};
+            alignas(16) std::array<std::uint32_t, 4> vR{};
+            MM(store_si128)(reinterpret_cast<M128I *>(vL.data()), ditherL_[g]);
+            MM(store_si128)(reinterpret_cast<M128I *>(vR.data()), ditherR_[g]);
+            vL[static_cast<std::size_t>(k)] = l != 0u ? l : 1u;
+            vR[static_cast<std::size_t>(k)] = r != 0u ? r : 1u;
+            ditherL_[g] = MM(load_si128)(reinterpret_cast<const M128I *>(vL.data()));
+            ditherR_[g] = MM(load_si128)(reinterpret_cast<const M128I *>(vR.data()));
+        }
+
+        /// io[lane][channel] points at numSamples floats, processed in place.
+        void process(float *const *const *io, int numChannels, int numSamples) noexcept
+        {
+            assert(io != nullptr);
+            assert(numChannels == 1 || numChannels == 2);
+            assert(numChannels <= numChannels_);
+            if (numSamples <= 0) return;
+
+            const bool hasR = numChannels > 1;
+
+            for (int offset = 0; offset < numSamples;)
+            {
+                const int chunk = std::min(wetBufCapacity_, numSamples - offset);
+
+                // Wet generation at block rate, one feedback line per lane.
+                // A lane settled at full bypass skips its loop, and the loop
+                // restarts empty on un-bypass, as in ChronosEngine.
+                for (int l = 0; l < Lanes; ++l)
+                {
+                    auto &ln = lanes_[static_cast<std::size_t>(l)];
+                    if (bypassSettled_(l))
+                    {
+                        // The stale wet span is discarded by the bypass
+                        // blend; it is zeroed once so it stays finite.
+                        if (!ln.loopElided)
+                        {
+                            std::fill(ln.wetL.begin(), ln.wetL.end(), 0.0f);
+                            std::fill(ln.wetR.begin(), ln.wetR.end(), 0.0f);
+                            ln.loopElided = true;
+                        }
+                        continue;
+                    }
+                    if (ln.loopElided) reprimeLoop_(ln);
+                    float *const *ch = io[l];
+                    ln.fbDelay.process(ch[0] + offset,
+                                       hasR ? ch[1] + offset : nullptr,
+                                       ln.wetL.data(),
+                                       hasR ? ln.wetR.data() : nullptr,
+                                       chunk);
+                }
+
+                gatherLanes_(io, 0, offset, chunk, inL_.data(), wetL_.data(), true);
+                if (hasR)
+                    gatherLanes_(io, 1, offset, chunk, inR_.data(), wetR_.data(), false);
+
+                reprimeWetLanes_();
+                rampParams_(chunk);
+                saturateAndAlign_(chunk, hasR);
+                filter_(chunk, hasR);
+                mixAndQuantise_(chunk, hasR);
+
+                scatterLanes_(io, 0, offset, chunk, satL_.data());
+                if (hasR)
+                    scatterLanes_(io, 1, offset, chunk, satR_.data());
+
+                offset += chunk;
+            }
+        }
+
+        [[nodiscard]] static constexpr int latencySamples() noexcept
+        {
+            return ChronosEngine::latencySamples();
+        }
+
+        [[nodiscard]] int getWetBufCapacity() const noexcept { return wetBufCapacity_; }
+
+    private:
+        static constexpr int kNumSoa = 13;
+        static constexpr int kBudget = Align::SaturatorAlign::kBudget;
+        static constexpr int kRing = 16; // >= kBudget + 1, power of two
+        static constexpr int kRingMask = kRing - 1;
+        static constexpr int kTaps = Align::kHalfSampleTaps;
+        static constexpr int kSubBlock = 32; // OutputFilterStage's coefficient sub-block
+        static constexpr double kSvfQ = 0.7071;
+        static_assert(kRing > kBudget, "alignment ring must hold kBudget samples");
+
+        /// LinearSmoother semantics, four lanes per M128. The countdown is a
+        /// float holding a small integer so the lane masks stay in one domain.
+        struct LaneSmoother
+        {
+            std::array<M128, kGroups> current{};
+            std::array<M128, kGroups> target{};
+            std::array<M128, kGroups> step{};
+            std::array<M128, kGroups> countdown{};
+            int stepsToTarget = 0;
+
+            void reset(double sampleRate, double rampLengthSeconds) noexcept
+            {
+                const double fs = sampleRate > 0.0 ? sampleRate : 48000.0;
+                const double dur = rampLengthSeconds > 0.0 ? rampLengthSeconds : 0.0;
+                stepsToTarget = static_cast<int>(std::floor(dur * fs + 0.5));
+            }
+
+            void snap(float v) noexcept
+            {
+                for (int g = 0; g < kGroups; ++g)
+                {
+                    current[static_cast<std::size_t>(g)] = MM(set1_ps)(v);
+                    target[static_cast<std::size_t>(g)] = MM(set1_ps)(v);
+                    step[static_cast<std::size_t>(g)] = MM(setzero_ps)();
+                    countdown[static_cast<std::size_t>(g)] = MM(setzero_ps)();
+                }
+            }
+
+            void snap(int lane, float v) noexcept
+            {
+                setLane_(current, lane, v);
+                setLane_(target, lane, v);
+                setLane_(step, lane, 0.0f);
+                setLane_(countdown, lane, 0.0f);
+            }
+
+            void setTarget(int lane, float v) noexcept
+            {
+                const float cur = getLane_(current, lane);
+                setLane_(target, lane, v);
+                if (stepsToTarget <= 0 || v == cur)
+                {
+                    setLane_(current, lane, v);
+                    setLane_(step, lane, 0.0f);
+                    setLane_(countdown, lane, 0.0f);
+                    return;
+                }
+                setLane_(step, lane, (v - cur) / static_cast<float>(stepsToTarget));
+                setLane_(countdown, lane, static_cast<float>(stepsToTarget));
+            }
+
+            M128 next(int g) noexcept
+            {
+                const auto u = static_cast<std::size_t>(g);
+                const M128 zero = MM(setzero_ps)();
+                const M128 active = MM(cmpgt_ps)(countdown[u], zero);
+                current[u] = MM(add_ps)(current[u], MM(and_ps)(step[u], active));
+                countdown[u] = MM(sub_ps)(countdown[u], MM(and_ps)(MM(set1_ps)(1.0f), active));
+                const M128 done = MM(cmple_ps)(countdown[u], zero);
+                current[u] = MM(or_ps)(MM(and_ps)(done, target[u]), MM(andnot_ps)(done, current[u]));
+                return current[u];
+            }
+
+            [[nodiscard]] float value(int lane) const noexcept { return getLane_(current, lane); }
+            [[nodiscard]] float targetOf(int lane) const noexcept { return getLane_(target, lane); }
+            [[nodiscard]] bool isSmoothing(int lane) const noexcept { return getLane_(countdown, lane) > 0.0f; }
+
+        private:
+            static float getLane_(const std::array<M128, kGroups> &v, int lane) noexcept
+            {
+                alignas(16) std::array<float, 4> t{};
+                MM(store_ps)(t.data(), v[static_cast<std::size_t>(lane / 4)]);
+                return t[static_cast<std::size_t>(lane % 4)];
+            }
+
+            static void setLane_(std::array<M128, kGroups> &v, int lane, float x) noexcept
+            {
+                alignas(16) std::array<float, 4> t{};
+                MM(store_ps)(t.data(), v[static_cast<std::size_t>(lane / 4)]);
+                t[static_cast<std::size_t>(lane % 4)] = x;
+                v[static_cast<std::size_t>(lane / 4)] = MM(load_ps)(t.data());
+            }
+        };
+
+        struct Lane
+        {
+            Delays::FeedbackDelay fbDelay;
+            std::span<float> wetL;
+            std::span<float> wetR;
+
+            Nonlinear::ADAA1<Nonlinear::TanhNL> adaa1L;
+            Nonlinear::ADAA1<Nonlinear::TanhNL> adaa1R;
+            Nonlinear::ADAA2<Nonlinear::TanhNL> adaa2L;
+            Nonlinear::ADAA2<Nonlinear::TanhNL> adaa2R;
+            int adaaOrder = 2;
+            int bits = 32;
+
+            // ChronosEngine's stage elision, tracked per lane. The bank still
+            // runs the wet stages on an elided lane, but restarts them the
+            // way the engine does so the lanes stay in step with it.
+            Delays::FeedbackDelay::Params loopParams{};
+            bool loopElided = false;
+            bool wetElided = false;
+
+            // Drive is usually settled, so the makeup table is read once.
+            float lastDrive = -1.0f;
+            float lastMakeup = 1.0f;
+
+            // Analog output filters run with the stage locked to Analog; the
+            // bank owns the Digital/Analog fade.
+            Filters::OutputFilterStage analog;
+            bool currentAnalog = false;
+            bool targetAnalog = false;
+            bool fading = false;
+            int fadeStep = 0;
+            float hpfHz = 20.0f;
+            float lpfHz = 20000.0f;
+        };
+
+        void applyLaneParams_(int lane, const Params &p, bool snap) noexcept
+        {
+            assert(lane >= 0 && lane < Lanes);
+            auto &ln = lanes_[static_cast<std::size_t>(lane)];
+            ln.adaaOrder = std::clamp(p.adaaOrder, 0, 2);
+            ln.bits = p.bits;
+
+            if (snap)
+            {
+                gain_.snap(lane, p.gainLin);
+                hpf_.snap(lane, p.hpfHz);
+                lpf_.snap(lane, p.lpfHz);
+                mix_.snap(lane, p.mix);
+                drive_.snap(lane, p.driveLin);
+            } else
+            {
+                gain_.setTarget(lane, p.gainLin);
+                hpf_.setTarget(lane, p.hpfHz);
+                lpf_.setTarget(lane, p.lpfHz);
+                mix_.setTarget(lane, p.mix);
+                drive_.setTarget(lane, p.driveLin);
+            }
+
+            // OutputFilterStage::setMode, per lane: a change starts the 20 ms
+            // fade and the incoming analog path starts from rest.
+            const bool wantAnalog = p.filterMode == static_cast<int>(Filters::OutputFilterStage::Mode::Analog);
+            if (wantAnalog != ln.targetAnalog || ln.fading)
+            {
+                ln.targetAnalog = wantAnalog;
+                if (ln.currentAnalog != ln.targetAnalog)
+                {
+                    ln.fading = true;
+                    ln.fadeStep = 0;
+                    if (wantAnalog)
+                        ln.analog.reset();
+                }
+            }
+
+            Delays::FeedbackDelay::Params fp;
+            fp.delaySamples = p.delaySamples;
+            fp.feedback = p.feedback;
+            fp.dampHz = p.dampHz;
+            fp.loopCutHz = p.loopCutHz;
+            fp.crossFeed = p.crossFeed;
+            fp.loopDrive = p.loopDrive;
+            fp.satOrder = p.loopSatOrder;
+            fp.enableDiffuser = p.enableDiffuser;
+            fp.diffusion = p.diffusion;
+            fp.diffuserSize = p.diffuserSize;
+            fp.diffModDepth = p.diffModDepth;
+            fp.diffModRateHz = p.diffModRateHz;
+            fp.delayModDepth = p.delayModDepth;
+            fp.delayModRateHz = p.delayModRateHz;
+            fp.delayMode = p.delayMode;
+            ln.loopParams = fp;
+            if (snap) ln.fbDelay.resetParams(fp);
+            else ln.fbDelay.setParams(fp);
+        }
+
+        [[nodiscard]] bool bypassSettled_(int lane) const noexcept
+        {
+            return !bypass_.isSmoothing(lane) && bypass_.value(lane) >= 1.0f;
+        }
+
+        [[nodiscard]] bool mixSettledDry_(int lane) const noexcept
+        {
+            return !mix_.isSmoothing(lane) && mix_.value(lane) <= 0.0f;
+        }
+
+        static void reprimeLoop_(Lane &ln) noexcept
+        {
+            ln.fbDelay.reset();
+            ln.fbDelay.resetParams(ln.loopParams);
+            ln.loopElided = false;
+        }
+
+        // Decided from the smoothers before the chunk advances them. A lane
+        // leaving a settled dry or bypassed stretch restarts its saturator,
+        // wet alignment and output filters from silence.
+        void reprimeWetLanes_() noexcept
+        {
+            for (int l = 0; l < Lanes; ++l)
+            {
+                auto &ln = lanes_[static_cast<std::size_t>(l)];
+                if (bypassSettled_(l) || mixSettledDry_(l))
+                {
+                    ln.wetElided = true;
+                    continue;
+                }
+                if (!ln.wetElided) continue;
+
+                ln.adaa1L.reset();
+                ln.adaa1R.reset();
+                ln.adaa2L.reset();
+                ln.adaa2R.reset();
+                for (int p = 0; p < kRing; ++p)
+                {
+                    wetRingL_[static_cast<std::size_t>(p * Lanes + l)] = 0.0f;
+                    wetRingR_[static_cast<std::size_t>(p * Lanes + l)] = 0.0f;
+                }
+                for (int p = 0; p < kTaps; ++p)
+                {
+                    clearLane_(firL_[static_cast<std::size_t>(p * kGroups + l / 4)], l % 4);
+                    clearLane_(firR_[static_cast<std::size_t>(p * kGroups + l / 4)], l % 4);
+                }
+                svfHpfL_.resetLane(l);
+                svfHpfR_.resetLane(l);
+                svfLpfL_.resetLane(l);
+                svfLpfR_.resetLane(l);
+                ln.analog.reset();
+                ln.fading = false;
+                ln.fadeStep = 0;
+                ln.currentAnalog = ln.targetAnalog;
+                ln.wetElided = false;
+            }
+        }
+
+        static void clearLane_(M128 &v, int k) noexcept
+        {
+            alignas(16) std::array<float, 4> t{};
+            MM(store_ps)(t.data(), v);
+            t[static_cast<std::size_t>(k)] = 0.0f;
+            v = MM(load_ps)(t.data());
+        }
+
+        void gatherLanes_(float *const *const *io, int ch, int offset, int chunk,
+                          float *dry, float *wet, bool left) const noexcept
+        {
+            for (int l = 0; l < Lanes; ++l)
+            {
+                const float *src = io[l][ch] + offset;
+                const auto &ln = lanes_[static_cast<std::size_t>(l)];
+                const float *w = left ? ln.wetL.data() : ln.wetR.data();
+                for (int s = 0; s < chunk; ++s)
+                {
+                    dry[s * Lanes + l] = src[s];
+                    wet[s * Lanes + l] = w[s];
+                }
+            }
+        }
+
+        static void scatterLanes_(float *const *const *io, int ch, int offset, int chunk,
+                                  const float *soa) noexcept
+        {
+            for (int l = 0; l < Lanes; ++l)
+            {
+                float *dst = io[l][ch] + offset;
+                for (int s = 0; s < chunk; ++s)
+                    dst[s] = soa[s * Lanes + l];
+            }
+        }
+
+        void rampParams_(int chunk) noexcept
+        {
+            // The engine sets the filter cutoffs once per chunk from the first
+            // ramped value, so only row 0 of the cutoff ramps is kept.
+            for (int s = 0; s < chunk; ++s)
+            {
+                for (int g = 0; g < kGroups; ++g)
+                {
+                    const int at = s * Lanes + 4 * g;
+                    const M128 hpf = hpf_.next(g);
+                    const M128 lpf = lpf_.next(g);
+                    if (s == 0)
+                    {
+                        MM(store_ps)(hpfAtChunk_.data() + 4 * g, hpf);
+                        MM(store_ps)(lpfAtChunk_.data() + 4 * g, lpf);
+                    }
+                    MM(store_ps)(driveRamp_.data() + at, drive_.next(g));
+                    MM(store_ps)(thetaRamp_.data() + at,
+                                 MM(mul_ps)(MM(mul_ps)(mix_.next(g), MM(set1_ps)(0.01f)),
+                                            MM(set1_ps)(std::numbers::pi_v<float> * 0.5f)));
+                    MM(store_ps)(gainRamp_.data() + at, gain_.next(g));
+                }
+            }
+        }
+
+        static M128 scrub_(const M128 x) noexcept
+        {
+            const M128 nanMask = MM(cmpunord_ps)(x, x);
+            const M128 infMask = MM(cmpeq_ps)(MM(andnot_ps)(MM(set1_ps)(-0.0f), x),
+                                              MM(set1_ps)(std::numeric_limits<float>::infinity()));
+            return MM(andnot_ps)(MM(or_ps)(nanMask, infMask), x);
+        }
+
+        float makeupFor_(Lane &ln, float drive) noexcept
+        {
+            if (drive != ln.lastDrive)
+            {
+                ln.lastDrive = drive;
+                ln.lastMakeup = Math::outputMakeup(drive) * Math::kOutputMakeupUnity;
+            }
+            return ln.lastMakeup;
+        }
+
+        /// Dry alignment, ADAA and wet alignment. Writes aligned dry, bypass
+        /// dry and aligned wet (sat) spans.
+        void saturateAndAlign_(int chunk, bool hasR) noexcept
+        {
+            // Per-lane integer wet delay, from SaturatorAlign::setMode.
+            std::array<int, Lanes> wetDelay{};
+            alignas(16) std::array<float, Lanes> firSel{};
+            for (int l = 0; l < Lanes; ++l)
+            {
+                const int order = lanes_[static_cast<std::size_t>(l)].adaaOrder;
+                wetDelay[static_cast<std::size_t>(l)] = order == 0 ? kBudget : (order == 1 ? 0 : kBudget - 1);
+                firSel[static_cast<std::size_t>(l)] = order == 1 ? 1.0f : 0.0f;
+            }
+
+            for (int s = 0; s < chunk; ++s)
+            {
+                const int row = s * Lanes;
+
+                // ADAA per lane, scalar double; makeup follows the drive ramp.
+                for (int l = 0; l < Lanes; ++l)
+                {
+                    auto &ln = lanes_[static_cast<std::size_t>(l)];
+                    const float drive = driveRamp_[static_cast<std::size_t>(row + l)];
+                    const float w0 = wetL_[static_cast<std::size_t>(row + l)];
+                    const float w1 = hasR ? wetR_[static_cast<std::size_t>(row + l)] : 0.0f;
+                    float sat0 = w0;
+                    float sat1 = w1;
+                    if (ln.adaaOrder == 1)
+                    {
+                        sat0 = static_cast<float>(ln.adaa1L.process(drive * w0));
+                        if (hasR) sat1 = static_cast<float>(ln.adaa1R.process(drive * w1));
+                    } else if (ln.adaaOrder == 2)
+                    {
+                        sat0 = static_cast<float>(ln.adaa2L.process(drive * w0));
+                        if (hasR) sat1 = static_cast<float>(ln.adaa2R.process(drive * w1));
+                    }
+                    if (ln.adaaOrder > 0)
+                    {
+                        const float makeup = makeupFor_(ln, drive);
+                        sat0 *= makeup;
+                        sat1 *= makeup;
+                    }
+                    satL_[static_cast<std::size_t>(row + l)] = sat0;
+                    if (hasR) satR_[static_cast<std::size_t>(row + l)] = sat1;
+                }
+
+                const int w = ringPos_;
+                for (int g = 0; g < kGroups; ++g)
+                {
+                    const int at = row + 4 * g;
+                    const int rd = (w - kBudget + kRing) & kRingMask;
+
+                    // Dry and bypass paths: kBudget samples for every lane.
+                    {
+                        const M128 x = MM(loadu_ps)(inL_.data() + at);
+                        MM(storeu_ps)(alignedDryL_.data() + at, dryRingL_[rd * kGroups + g]);
+                        MM(storeu_ps)(bypassDryL_.data() + at, rawRingL_[rd * kGroups + g]);
+                        dryRingL_[w * kGroups + g] = scrub_(x);
+                        rawRingL_[w * kGroups + g] = x;
+                    }
+                    if (hasR)
+                    {
+                        const M128 x = MM(loadu_ps)(inR_.data() + at);
+                        MM(storeu_ps)(alignedDryR_.data() + at, dryRingR_[rd * kGroups + g]);
+                        MM(storeu_ps)(bypassDryR_.data() + at, rawRingR_[rd * kGroups + g]);
+                        dryRingR_[w * kGroups + g] = scrub_(x);
+                        rawRingR_[w * kGroups + g] = x;
+                    }
+                }
+
+                alignWet_(satL_.data() + row, wetRingL_, firL_, wetDelay, firSel);
+                if (hasR)
+                    alignWet_(satR_.data() + row, wetRingR_, firR_, wetDelay, firSel);
+
+                ringPos_ = (ringPos_ + 1) & kRingMask;
+                firPos_ = (firPos_ + 1) & (kTaps - 1);
+            }
+        }
+
+        /// SaturatorAlign's wet side for one row: integer delay per lane, then
+        /// the half-sample FIR on the lanes running ADAA1.
+        void alignWet_(float *row, std::array<float, kRing * Lanes> &ring,
+                       std::array<M128, kTaps * kGroups> &fir,
+                       const std::array<int, Lanes> &wetDelay,
+                       const std::array<float, Lanes> &firSel) noexcept
+        {
+            const int w = ringPos_;
+            alignas(16) std::array<float, Lanes> delayed{};
+            for (int l = 0; l < Lanes; ++l)
+            {
+                const float x = row[l];
+                const float xs = std::isfinite(x) ? x : 0.0f;
+                const int d = wetDelay[static_cast<std::size_t>(l)];
+                delayed[static_cast<std::size_t>(l)] =
+                        d == 0 ? xs : ring[static_cast<std::size_t>(((w - d + kRing) & kRingMask) * Lanes + l)];
+                ring[static_cast<std::size_t>(w * Lanes + l)] = xs;
+            }
+
+            const int fw = firPos_;
+            for (int g = 0; g < kGroups; ++g)
+            {
+                const M128 x = MM(load_ps)(delayed.data() + 4 * g);
+                fir[static_cast<std::size_t>(fw * kGroups + g)] = x;
+
+                // Symmetric taps: c[j] pairs x[n-j] with x[n-15+j].
+                M128 acc = MM(setzero_ps)();
+                for (int j = 0; j < kTaps / 2; ++j)
+                {
+                    const int a = (fw - j + kTaps) & (kTaps - 1);
+                    const int b = (fw - (kTaps - 1) + j + kTaps) & (kTaps - 1);
+                    const M128 pair = MM(add_ps)(fir[static_cast<std::size_t>(a * kGroups + g)],
+                                                 fir[static_cast<std::size_t>(b * kGroups + g)]);
+                    acc = FMADD(MM(set1_ps)(Align::kHalfSampleCoeffs[static_cast<std::size_t>(j)]), pair, acc);
+                }
+                const M128 sel = MM(cmpgt_ps)(MM(load_ps)(firSel.data() + 4 * g), MM(setzero_ps)());
+                MM(storeu_ps)(row + 4 * g, MM(or_ps)(MM(and_ps)(sel, acc), MM(andnot_ps)(sel, x)));
+            }
+        }
+
+        /// Digital SVF cascade across the lanes, Analog lanes and fades per lane.
+        void filter_(int chunk, bool hasR) noexcept
+        {
+            const double fs = sampleRate_ > 0.0 ? sampleRate_ : 48000.0;
+            const double nyq = 0.49 * fs;
+            const Simd::KernelTable &kernels = Simd::kernels();
+
+            // Per-lane pre-warped angles at the chunk's first ramped cutoff.
+            alignas(16) std::array<float, Lanes> hpAng{};
+            alignas(16) std::array<float, Lanes> lpAng{};
+            bool anyAnalog = false;
+            for (int l = 0; l < Lanes; ++l)
+            {
+                auto &ln = lanes_[static_cast<std::size_t>(l)];
+                ln.hpfHz = hpfAtChunk_[static_cast<std::size_t>(l)];
+                ln.lpfHz = lpfAtChunk_[static_cast<std::size_t>(l)];
+                const double hp = std::clamp(static_cast<double>(ln.hpfHz), 10.0, nyq);
+                const double lp = std::clamp(static_cast<double>(ln.lpfHz), 10.0, nyq);
+                hpAng[static_cast<std::size_t>(l)] = static_cast<float>(std::numbers::pi * hp / fs);
+                lpAng[static_cast<std::size_t>(l)] = static_cast<float>(std::numbers::pi * lp / fs);
+                anyAnalog = anyAnalog || ln.currentAnalog || ln.fading;
+                if (ln.currentAnalog || ln.fading)
+                    ln.analog.setCutoffs(ln.hpfHz, ln.lpfHz);
+            }
+
+            for (int offset = 0; offset < chunk;)
+            {
+                const int sub = std::min(kSubBlock, chunk - offset);
+
+                using SVFType = Filters::SimdSVF::SVFType;
+                svfHpfL_.setCoeffForBlock(SVFType::HighPass, hpAng.data(), Lanes, kSvfQ, 0.0, sub);
+                svfLpfL_.setCoeffForBlock(SVFType::LowPass, lpAng.data(), Lanes, kSvfQ, 0.0, sub);
+                if (hasR)
+                {
+                    svfHpfR_.setCoeffForBlock(SVFType::HighPass, hpAng.data(), Lanes, kSvfQ, 0.0, sub);
+                    svfLpfR_.setCoeffForBlock(SVFType::LowPass, lpAng.data(), Lanes, kSvfQ, 0.0, sub);
+                }
+
+                // Analog lanes read their saturated input before the digital
+                // cascade overwrites it in place.
+                if (anyAnalog)
+                    runAnalog_(offset, sub, hasR);
+
+                Filters::SimdSVFLanes::processCascade(kernels, svfHpfL_, svfLpfL_,
+                                                      satL_.data() + offset * Lanes, Lanes, sub);
+                if (hasR)
+                    Filters::SimdSVFLanes::processCascade(kernels, svfHpfR_, svfLpfR_,
+                                                          satR_.data() + offset * Lanes, Lanes, sub);
+
+                if (anyAnalog)
+                    blendAnalog_(offset, sub, hasR);
+
+                offset += sub;
+            }
+        }
+
+        void runAnalog_(int offset, int sub, bool hasR) noexcept
+        {
+            for (int l = 0; l < Lanes; ++l)
+            {
+                auto &ln = lanes_[static_cast<std::size_t>(l)];
+                if (!ln.currentAnalog && !ln.fading) continue;
+                auto &bufL = analogL_[static_cast<std::size_t>(l)];
+                auto &bufR = analogR_[static_cast<std::size_t>(l)];
+                for (int s = 0; s < sub; ++s)
+                {
+                    bufL[static_cast<std::size_t>(s)] = satL_[static_cast<std::size_t>((offset + s) * Lanes + l)];
+                    if (hasR)
+                        bufR[static_cast<std::size_t>(s)] = satR_[static_cast<std::size_t>((offset + s) * Lanes + l)];
+                }
+                ln.analog.process(bufL.data(), hasR ? bufR.data() : nullptr,
+                                  bufL.data(), hasR ? bufR.data() : nullptr, sub);
+            }
+        }
+
+        void blendAnalog_(int offset, int sub, bool hasR) noexcept
+        {
+            for (int l = 0; l < Lanes; ++l)
+            {
+                auto &ln = lanes_[static_cast<std::size_t>(l)];
+                if (!ln.currentAnalog && !ln.fading) continue;
+                const auto &bufL = analogL_[static_cast<std::size_t>(l)];
+                const auto &bufR = analogR_[static_cast<std::size_t>(l)];
+                for (int s = 0; s < sub; ++s)
+                {
+                    const auto at = static_cast<std::size_t>((offset + s) * Lanes + l);
+                    const float anaL = bufL[static_cast<std::size_t>(s)];
+                    const float anaR = hasR ? bufR[static_cast<std::size_t>(s)] : 0.0f;
+                    if (!ln.fading)
+                    {
+                        // A fade that ended inside this sub-block leaves the
+                        // digital output in place once the lane is digital.
+                        if (ln.currentAnalog)
+                        {
+                            satL_[at] = anaL;
+                            if (hasR) satR_[at] = anaR;
+                        }
+                        continue;
+                    }
+                    const float alpha = static_cast<float>(ln.fadeStep) / static_cast<float>(fadeLengthSamples_);
+                    const float digL = satL_[at];
+                    const float digR = hasR ? satR_[at] : 0.0f;
+                    const float fromL = ln.currentAnalog ? anaL : digL;
+                    const float fromR = ln.currentAnalog ? anaR : digR;
+                    const float toL = ln.targetAnalog ? anaL : digL;
+                    const float toR = ln.targetAnalog ? anaR : digR;
+                    satL_[at] = (1.0f - alpha) * fromL + alpha * toL;
+                    if (hasR) satR_[at] = (1.0f - alpha) * fromR + alpha * toR;
+                    if (++ln.fadeStep >= fadeLengthSamples_)
+                    {
+                        ln.fading = false;
+                        ln.currentAnalog = ln.targetAnalog;
+                        ln.fadeStep = 0;
+                    }
+                }
+            }
+        }
+
+        static M128 nextUniformSimd_(M128I &state) noexcept
+        {
+            state = MM(xor_si128)(state, MM(slli_epi32)(state, 13));
+            state = MM(xor_si128)(state, MM(srli_epi32)(state, 17));
+            state = MM(xor_si128)(state, MM(slli_epi32)(state, 5));
+            const M128I shifted = MM(srli_epi32)(state, 8);
+            return MM(mul_ps)(MM(cvtepi32_ps)(shifted), MM(set1_ps)(1.0f / 16777216.0f));
+        }
+
+        static M128 quantise_(const M128 scaled, M128I &rng, const M128 lsb, const M128 invLsb) noexcept
+        {
+            const M128 d1 = nextUniformSimd_(rng);
+            const M128 d2 = nextUniformSimd_(rng);
+            const M128 dither = MM(mul_ps)(MM(sub_ps)(d1, d2), lsb);
+            const M128 q = MM(mul_ps)(MM(add_ps)(scaled, dither), invLsb);
+            const M128 sign = MM(and_ps)(q, MM(set1_ps)(-0.0f));
+            const M128 shifted = MM(add_ps)(q, MM(or_ps)(MM(set1_ps)(0.5f), sign));
+            return MM(mul_ps)(MM(cvtepi32_ps)(MM(cvttps_epi32)(shifted)), lsb);
+        }
+
+        /// Crossfade, bypass blend, gain and the dithered quantiser. Writes
+        /// the final output into the sat spans.
+        void mixAndQuantise_(int chunk, bool hasR) noexcept
+        {
+            // Per-lane settled endpoints, as the engine's fullDry/fullWet.
+            alignas(16) std::array<float, Lanes> dryOnly{};
+            alignas(16) std::array<float, Lanes> wetOnly{};
+            alignas(16) std::array<float, Lanes> lsb{};
+            alignas(16) std::array<float, Lanes> quant{};
+            bool anyQuant = false;
+            for (int l = 0; l < Lanes; ++l)
+            {
+                const auto u = static_cast<std::size_t>(l);
+                const bool settled = !mix_.isSmoothing(l);
+                const float m = mix_.value(l);
+                dryOnly[u] = settled && m <= 0.0f ? 1.0f : 0.0f;
+                wetOnly[u] = settled && m >= 100.0f ? 1.0f : 0.0f;
+                const int bits = lanes_[u].bits;
+                lsb[u] = bits < 32 ? std::ldexp(1.0f, 1 - bits) : 1.0f;
+                quant[u] = bits < 32 ? 1.0f : 0.0f;
+                anyQuant = anyQuant || bits < 32;
+            }
+
+            const M128 zero = MM(setzero_ps)();
+            const M128 one = MM(set1_ps)(1.0f);
+            for (int s = 0; s < chunk; ++s)
+            {
+                for (int g = 0; g < kGroups; ++g)
+                {
+                    const auto ug = static_cast<std::size_t>(g);
+                    const int at = s * Lanes + 4 * g;
+                    const M128 mDry = MM(cmpgt_ps)(MM(load_ps)(dryOnly.data() + 4 * g), zero);
+                    const M128 mWet = MM(cmpgt_ps)(MM(load_ps)(wetOnly.data() + 4 * g), zero);
+
+                    const M128 theta = MM(loadu_ps)(thetaRamp_.data() + at);
+                    M128 cosV = mmCos(theta);
+                    M128 sinV = mmSin(theta);
+                    cosV = MM(or_ps)(MM(and_ps)(mDry, one), MM(andnot_ps)(MM(or_ps)(mDry, mWet), cosV));
+                    sinV = MM(or_ps)(MM(and_ps)(mWet, one), MM(andnot_ps)(MM(or_ps)(mDry, mWet), sinV));
+
+                    const M128 bypassAmt = bypass_.next(g);
+                    const M128 keep = MM(sub_ps)(one, bypassAmt);
+                    const M128 gain = MM(loadu_ps)(gainRamp_.data() + at);
+
+                    const M128 mQuant = MM(cmpgt_ps)(MM(load_ps)(quant.data() + 4 * g), zero);
+                    const M128 vLsb = MM(load_ps)(lsb.data() + 4 * g);
+                    const M128 vInvLsb = MM(div_ps)(one, vLsb);
+
+                    {
+                        const M128 mixed = FMADD(MM(loadu_ps)(alignedDryL_.data() + at), cosV,
+                                                 MM(mul_ps)(MM(loadu_ps)(satL_.data() + at), sinV));
+                        const M128 blend = MM(add_ps)(MM(mul_ps)(mixed, keep),
+                                                      MM(mul_ps)(MM(loadu_ps)(bypassDryL_.data() + at), bypassAmt));
+                        M128 out = MM(mul_ps)(blend, gain);
+                        if (anyQuant)
+                        {
+                            const M128 q = quantise_(out, ditherL_[ug], vLsb, vInvLsb);
+                            out = MM(or_ps)(MM(and_ps)(mQuant, q), MM(andnot_ps)(mQuant, out));
+                        }
+                        MM(storeu_ps)(satL_.data() + at, out);
+                    }
+                    if (hasR)
+                    {
+                        const M128 mixed = FMADD(MM(loadu_ps)(alignedDryR_.data() + at), cosV,
+                                                 MM(mul_ps)(MM(loadu_ps)(satR_.data() + at), sinV));
+                        const M128 blend = MM(add_ps)(MM(mul_ps)(mixed, keep),
+                                                      MM(mul_ps)(MM(loadu_ps)(bypassDryR_.data() + at), bypassAmt));
+                        M128 out = MM(mul_ps)(blend, gain);
+                        if (anyQuant)
+                        {
+                            const M128 q = quantise_(out, ditherR_[ug], vLsb, vInvLsb);
+                            out = MM(or_ps)(MM(and_ps)(mQuant, q), MM(andnot_ps)(mQuant, out));
+                        }
+                        MM(storeu_ps)(satR_.data() + at, out);
+                    }
+                }
+            }
+        }
+
+        std::array<Lane, Lanes> lanes_{};
+
+        LaneSmoother gain_;
+        LaneSmoother hpf_;
+        LaneSmoother lpf_;
+        LaneSmoother mix_;
+        LaneSmoother drive_;
+        LaneSmoother bypass_;
+        std::array<float, Lanes> bypassTarget_{};
+        alignas(16) std::array<float, Lanes> hpfAtChunk_{};
+        alignas(16) std::array<float, Lanes> lpfAtChunk_{};
+
+        // Alignment rings: dry (scrubbed) and bypass (raw) at kBudget, wet at
+        // the per-lane SaturatorAlign delay, and the half-sample FIR history.
+        std::array<M128, kRing * kGroups> dryRingL_{};
+        std::array<M128, kRing * kGroups> dryRingR_{};
+        std::array<M128, kRing * kGroups> rawRingL_{};
+        std::array<M128, kRing * kGroups> rawRingR_{};
+        std::array<float, kRing * Lanes> wetRingL_{};
+        std::array<float, kRing * Lanes> wetRingR_{};
+        std::array<M128, kTaps * kGroups> firL_{};
+        std::array<M128, kTaps * kGroups> firR_{};
+        int ringPos_{0};
+        int firPos_{0};
+
+        Filters::SimdSVFLanes svfHpfL_{};
+        Filters::SimdSVFLanes svfHpfR_{};
+        Filters::SimdSVFLanes svfLpfL_{};
+        Filters::SimdSVFLanes svfLpfR_{};
+        std::array<std::array<float, kSubBlock>, Lanes> analogL_{};
+        std::array<std::array<float, kSubBlock>, Lanes> analogR_{};
+        int fadeLengthSamples_{960};
+
+        std::array<M128I, kGroups> ditherL_{};
+        std::array<M128I, kGroups> ditherR_{};
+
+        Memory::BumpArena arena_;
+        std::span<float> inL_;
+        std::span<float> inR_;
+        std::span<float> wetL_;
+        std::span<float> wetR_;
+        std::span<float> alignedDryL_;
+        std::span<float> alignedDryR_;
+        std::span<float> bypassDryL_;
+        std::span<float> bypassDryR_;
+        std::span<float> satL_;
+        std::span<float> satR_;
+        std::span<float> driveRamp_;
+        std::span<float> thetaRamp_;
+        std::span<float> gainRamp_;
+
+        double sampleRate_{0.0};
+        int numChannels_{0};
+        int wetBufCapacity_{0};
+    };
+}
+#endif
@@ -11,6 +11,7 @@
 #include "Pow2RingBuffer.h"
 #include "bbd/BrigadeLine.h"
 #include "bbd/ClockModel.h"
+#include "bbd/StereoBrigadeLine.h"
 #include "math/SaturatorMakeup.h"
 #include "math/Trigonometry.h"
 #include "nonlinear/ADAA1.h"
@@ -23,7 +24,10 @@
 #include <cassert>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <numbers>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 
 namespace MarsDSP::Delays
@@ -56,6 +60,7 @@ namespace MarsDSP::Delays
             float delayModDepth = 0.0f; // cents, 0..50
             float delayModRateHz = 0.35f; // Hz, 0.01..10
             int delayMode = 0; // 0: Digital, 1: BBD
+            int bbdChip = 0; // BBD::kChipStages: 0 MN3005, 1 MN3008, 2 MN3207, 3 MN3204
         };
 
         void prepare(double sampleRate, int maxBlockSize, int maxDelaySamples) noexcept
@@ -73,7 +78,7 @@ namespace MarsDSP::Delays
             const int minCap = maxDelaySamples + maxBlockSize + Pow2RingBuffer::kTail + 8;
             return 2 * Pow2RingBuffer::arenaFloatsFor(minCap)
                  + Diffusion::Diffuser::ringStorageFloats(sampleRate)
-                 + BBD::BrigadeLine::bbdStorageFloats(2);
+                 + BbdLines::bbdStorageFloats();
         }
 
         void reset() noexcept
@@ -81,8 +86,7 @@ namespace MarsDSP::Delays
             ringL_.clear();
             ringR_.clear();
             writeIdx_ = 0;
-            bbdL_.reset();
-            bbdR_.reset();
+            std::apply([](auto &...line) { (line.reset(), ...); }, bbd_);
             adaa1L_.reset();
             adaa1R_.reset();
             adaa2L_.reset();
@@ -130,6 +134,7 @@ namespace MarsDSP::Delays
             delayMode_ = p.delayMode;
             diffState_ = enableDiffuser_ ? DiffuserState::On : DiffuserState::Off;
             diffFade_ = enableDiffuser_ ? 1.0f : 0.0f;
+            applyBbdChip_(p.bbdChip);
             firstBlock_ = false;
         }
 
@@ -148,321 +153,410 @@ namespace MarsDSP::Delays
             applyDiffuserParams_(p);
             enableDiffuser_ = p.enableDiffuser;
             delayMode_ = p.delayMode;
+            applyBbdChip_(p.bbdChip);
+        }
+
+        // Single-parameter setters for event-driven callers. Each one
+        // touches only its own smoother or block-rate coefficient, with the
+        // same clamps as setParams. resetParams must have run once first.
+        void setDelaySamples(float delaySamples) noexcept { retargetDelayGlide_(delaySamples); }
+        void setFeedback(float feedback) noexcept { fbSm_.setTargetValue(std::clamp(feedback, 0.0f, kMaxFeedback)); }
+        void setCrossFeed(float crossFeed) noexcept { crossSm_.setTargetValue(std::clamp(crossFeed, 0.0f, 1.0f)); }
+        void setDampHz(float dampHz) noexcept { applyDamp_(dampHz); }
+        void setLoopCutHz(float loopCutHz) noexcept { applyLoopCut_(loopCutHz); }
+        void setSatOrder(int satOrder) noexcept { applySatOrder_(satOrder); }
+        void setDelayMode(int delayMode) noexcept { delayMode_ = delayMode; }
+        void setBbdChip(int chip) noexcept { applyBbdChip_(chip); }
+        void setEnableDiffuser(bool enable) noexcept { enableDiffuser_ = enable; }
+        void setDiffusion(float diffusion) noexcept { diffuser_.setDiffusion(diffusion); }
+        void setDiffuserSize(float size) noexcept { diffuser_.setSize(size); }
+        void setDiffModRateHz(float rateHz) noexcept { diffuser_.setModRateHz(rateHz); }
+
+        void setLoopDrive(float loopDrive) noexcept
+        {
+            driveSm_.setTargetValue(std::clamp(loopDrive, 0.501f, 15.849f));
+            applyLoopTrim_(loopDrive);
+        }
+
+        void setDiffModDepth(float depthMs) noexcept
+        {
+            diffuser_.setModDepthSamples(depthMs * 0.001f * static_cast<float>(sampleRate_));
+        }
+
+        // Depth and rate both feed the modulation scale.
+        void setDelayMod(float depthCents, float rateHz) noexcept { applyDelayMod_(depthCents, rateHz); }
+
+        // Quiet digital sub-chunks run the ADAA saturator through tanh's
+        // series as a block (ADAA1/ADAA2::trySeriesBlock). On by default.
+        // The per-sample paths (short chunks, processRef) always run F1/F2.
+        void setSeriesFastPath(bool enabled) noexcept { seriesFastPath_ = enabled; }
+
+        // Stereo BBD lines share one event schedule while their clocks agree
+        // (BBD::StereoBrigadeLine). On by default; the output is the same
+        // either way.
+        void setBbdLockstep(bool enabled) noexcept
+        {
+            std::apply([enabled](auto &...line) { (line.setLockstep(enabled), ...); }, bbd_);
+        }
+
+        // Caps the BBD event rate at BrigadeLine::kBoundedEventRatio per
+        // sample, so short BBD delays cost no more than about 8x fs clocks.
+        // Off by default.
+        void setBbdBoundedCost(bool enabled) noexcept
+        {
+            std::apply([enabled](auto &...line) { (line.setBoundedCost(enabled), ...); }, bbd_);
         }
 
         void process(const float *inL, const float *inR, float *wetL, float *wetR, int n) noexcept
         {
             assert(inL != nullptr && wetL != nullptr);
             const bool hasR = (inR != nullptr && wetR != nullptr);
-            const int mask = ringL_.mask();
 
             updateCrossRotation_(); // block-rate equal-power cross-feed coefficients
             diffuserTransition_(); // block-rate enable edge (primes on rising)
 
-            int s = 0;
-            while (s < n)
+            // Delay core, channel count and saturator order hold for the
+            // whole block; the loop body is picked once here.
+            const BlockFn blockFn = selectBlock_(delayMode_, hasR, satOrder_);
+            (this->*blockFn)(inL, hasR ? inR : nullptr, wetL, hasR ? wetR : nullptr, n);
+        }
+
+        // reference only -- do not optimize, do not delete.
+        void processRef(const float *inL, const float *inR, float *wetL, float *wetR, int n) noexcept
+        {
+            assert(inL != nullptr && wetL != nullptr);
+            const bool hasR = (inR != nullptr && wetR != nullptr);
+            const int mask = ringL_.mask();
+
+            updateCrossRotation_(); // block-rate equal-power cross-feed coefficients
+            diffuserTransition_();
+
+            for (int s = 0; s < n; ++s)
             {
-                const int remaining = n - s;
+                const float baseT = (diffState_ != DiffuserState::Off) ? diffuser_.transportSamples() : 0.0f;
+                const float d = delaySm_.getNextValue();
+                const float g = fbSm_.getNextValue();
+                crossSm_.skip();
+                const float drive = driveSm_.getNextValue();
+                const float fade = fadeStep_();
+                dampG_ = dampGSm_.getNextValue();
+                cutG_ = cutGSm_.getNextValue();
+                satLatency_ = satLatencySm_.getNextValue();
+                const float modK = modKSm_.getNextValue();
+                const float modL = modK * ouL_.next(rngL_);
+                const float modR = hasR ? modK * ouR_.next(rngR_) : 0.0f;
+                processSampleScalar_(inL + s, hasR ? inR + s : nullptr,
+                                     wetL + s, hasR ? wetR + s : nullptr,
+                                     d, g, drive, hasR, mask, fade, baseT,
+                                     modL, modR);
+            }
+        }
 
-                const float baseT = (diffState_ != DiffuserState::Off)
-                                        ? diffuser_.transportSamples()
-                                        : 0.0f;
+        [[nodiscard]] static constexpr int latencySamples() noexcept { return 0; }
+        [[nodiscard]] float getMaxDelay() const noexcept { return maxDelay_; }
+        [[nodiscard]] float ouStateMaxSigma() const noexcept { return diffuser_.ouStateMaxSigma(); }
+        [[nodiscard]] float currentDelaySamples() const noexcept { return delaySm_.getCurrentValue(); }
 
-                if (delayMode_ == 1)
-                {
-                    const int Lc = std::min(kMaxChunk, remaining);
-                    const bool runDiff = (diffState_ != DiffuserState::Off);
-                    const float gdBank = static_cast<float>(BBD::BrigadeLine::getBankGroupDelayAtDC(sampleRate_)) - 1.0f;
+        // Small-signal loop gain is the feedback amount: the saturators are
+        // unity-slope at zero and the loop filters never boost. Below one, a
+        // loop whose tap has stayed quiet for tailHorizonSamples() stays quiet.
+        [[nodiscard]] bool tailDecays() const noexcept
+        {
+            return std::max(fbSm_.getCurrentValue(), fbSm_.getTargetValue()) < 1.0f;
+        }
 
-                    for (int i = 0; i < Lc; ++i)
-                    {
-                        const float d = delaySm_.getNextValue();
-                        const float g = fbSm_.getNextValue();
-                        crossSm_.skip();
-                        const float drive = driveSm_.getNextValue();
-                        const float fade = fadeStep_();
-                        dampG_ = dampGSm_.getNextValue();
-                        cutG_ = cutGSm_.getNextValue();
-                        satLatency_ = satLatencySm_.getNextValue();
-                        const float modK = modKSm_.getNextValue();
-                        const float modL = modK * ouL_.next(rngL_);
-                        const float modR = hasR ? modK * ouR_.next(rngR_) : 0.0f;
+        // Samples a value can spend inside the loop before it reaches the
+        // tap: the longest read delay with modulation, plus the full-size
+        // diffuser path. Doubled so allpass state gets a second pass.
+        [[nodiscard]] int tailHorizonSamples() const noexcept
+        {
+            const float modGuard = static_cast<float>(Mod::OrnsteinUhlenbeck::kClamp)
+                                   * std::max(modKSm_.getCurrentValue(), modKSm_.getTargetValue());
+            const float dMax = std::max(delaySm_.getCurrentValue(), delaySm_.getTargetValue()) + modGuard;
+            const auto diff = diffuser_.baseTransportSamplesLR(1.0f);
+            const float span = dMax + std::max(diff[0], diff[1]);
+            return 2 * static_cast<int>(std::ceil(span)) + kMaxChunk;
+        }
+
+        // RMS ratio of tanh(k * x) to x for a 0.5-amplitude sine reference.
+        // The loop output trim is pow(rmsRatio, -0.5). Computed by fixed
+        // quadrature over one sine period.
+        static float rmsRatioForDrive_(float k) noexcept
+        {
+            constexpr int N = 128;
+            constexpr double kPi = 3.14159265358979323846;
+            const double kd = k;
+            double sum = 0.0;
+            for (int i = 0; i < N; ++i)
+            {
+                const double t = kPi * (static_cast<double>(i) + 0.5) / static_cast<double>(N);
+                const double x = kd * 0.5 * std::sin(2.0 * t);
+                const double y = std::tanh(x);
+                sum += y * y;
+            }
+            const double rmsTanh = std::sqrt(sum / static_cast<double>(N));
+            constexpr double rmsRef = 0.5 / 1.41421356237309504880;
+            return static_cast<float>(rmsTanh / rmsRef);
+        }
 
-                        const float dEffL = d + modL - satLatency_ - fade * baseT - gdBank;
-                        bbdL_.setClockHz(BBD::ClockModel::clockFor(dEffL, sampleRate_));
-                        float tapL = bbdL_.readTap();
+    private:
+        enum class DiffuserState { Off, FadingIn, On, FadingOut };
 
-                        float tapR = tapL;
-                        if (hasR)
-                        {
-                            const float dEffR = d + modR - satLatency_ - fade * baseT - gdBank;
-                            bbdR_.setClockHz(BBD::ClockModel::clockFor(dEffR, sampleRate_));
-                            tapR = bbdR_.readTap();
-                        }
+        // Lines of the longest chip (MN3005); the storage block is sized by them.
+        using BbdLines = BBD::StereoBrigadeLine<BBD::kChipStages[0]>;
 
-                        if (runDiff)
-                        {
-                            float diffL = tapL;
-                            float diffR = tapR;
-                            diffuser_.processBlockRef(&diffL, hasR ? &diffR : nullptr, 1);
-                            tapL = tapL * (1.0f - fade) + diffL * fade;
-                            if (hasR)
-                                tapR = tapR * (1.0f - fade) + diffR * fade;
-                            else
-                                tapR = tapL;
-                        }
+        // Per-sample control ramps for one digital sub-chunk.
+        struct ChunkRamps
+        {
+            alignas(16) std::array<float, kMaxChunk> d{};
+            alignas(16) std::array<float, kMaxChunk> g{};
+            alignas(16) std::array<float, kMaxChunk> cross{};
+            alignas(16) std::array<float, kMaxChunk> drive{};
+            alignas(16) std::array<float, kMaxChunk> fade{};
+            alignas(16) std::array<float, kMaxChunk> dampG{};
+            alignas(16) std::array<float, kMaxChunk> satLat{};
+            alignas(16) std::array<float, kMaxChunk> cutG{};
+            alignas(16) std::array<float, kMaxChunk> modL{};
+            alignas(16) std::array<float, kMaxChunk> modR{};
+        };
 
-                        const float mixL = hasR ? (crossCos_ * tapL + crossSin_ * tapR) : tapL;
-                        const float mixR = hasR ? (crossCos_ * tapR + crossSin_ * tapL) : tapL;
-                        const float vL = g * mixL;
-                        const float vR = g * mixR;
-
-                        const float makeup = 1.0f / drive;
-                        const float sL = saturate_(adaa1L_, adaa2L_, drive * vL) * makeup;
-                        const float sR = hasR ? saturate_(adaa1R_, adaa2R_, drive * vR) * makeup : sL;
-
-                        dampL_ += dampG_ * (sL - dampL_);
-                        dampR_ += dampG_ * (sR - dampR_);
-
-                        cutLpL_ += cutG_ * (dampL_ - cutLpL_);
-                        cutLpR_ += cutG_ * (dampR_ - cutLpR_);
-                        const float cutL = dampL_ - cutLpL_;
-                        const float cutR = dampR_ - cutLpR_;
-
-                        const float hL = cutL - dcXL_ + dcR_ * dcYL_;
-                        dcXL_ = cutL;
-                        dcYL_ = hL;
-                        const float hR = cutR - dcXR_ + dcR_ * dcYR_;
-                        dcXR_ = cutR;
-                        dcYR_ = hR;
-
-                        float wL = inL[s + i] + hL;
-                        if (!std::isfinite(wL)) wL = 0.0f;
-                        bbdL_.writeSample(wL);
-                        ringL_.writeBlock(&wL, writeIdx_, 1);
-                        ringL_.refreshMirror(writeIdx_, 1);
-
-                        if (hasR)
-                        {
-                            float wR = inR[s + i] + hR;
-                            if (!std::isfinite(wR)) wR = 0.0f;
-                            bbdR_.writeSample(wR);
-                            ringR_.writeBlock(&wR, writeIdx_, 1);
-                            ringR_.refreshMirror(writeIdx_, 1);
-                        }
-                        writeIdx_ = (writeIdx_ + 1) & mask;
+        using BlockFn = void (FeedbackDelay::*)(const float *, const float *, float *, float *, int) noexcept;
 
-                        wetL[s + i] = tapL * loopTrim_;
-                        if (hasR) wetR[s + i] = tapR * loopTrim_;
-                    }
-                    s += Lc;
-                    continue;
+        static BlockFn selectBlock_(int delayMode, bool stereo, int satOrder) noexcept
+        {
+            static constexpr BlockFn kTable[2][2][3] = {
+                {
+                    {&FeedbackDelay::processBlock_<0, false, 0>, &FeedbackDelay::processBlock_<0, false, 1>,
+                     &FeedbackDelay::processBlock_<0, false, 2>},
+                    {&FeedbackDelay::processBlock_<0, true, 0>, &FeedbackDelay::processBlock_<0, true, 1>,
+                     &FeedbackDelay::processBlock_<0, true, 2>}
+                },
+                {
+                    {&FeedbackDelay::processBlock_<1, false, 0>, &FeedbackDelay::processBlock_<1, false, 1>,
+                     &FeedbackDelay::processBlock_<1, false, 2>},
+                    {&FeedbackDelay::processBlock_<1, true, 0>, &FeedbackDelay::processBlock_<1, true, 1>,
+                     &FeedbackDelay::processBlock_<1, true, 2>}
                 }
+            };
+            return kTable[delayMode == 1 ? 1 : 0][stereo ? 1 : 0][std::clamp(satOrder, 0, 2)];
+        }
 
-                const float dCur = delaySm_.getCurrentValue();
-                const float dTgt = delaySm_.getTargetValue();
-                const float satLatMax = std::max(satLatencySm_.getCurrentValue(), satLatencySm_.getTargetValue());
-                // The OU state stays inside kClamp sigmas. The guard covers
-                // the largest deviation the modulation can apply.
-                const float modGuard = static_cast<float>(Mod::OrnsteinUhlenbeck::kClamp)
-                                       * std::max(modKSm_.getCurrentValue(), modKSm_.getTargetValue());
+        // One block for a fixed (delay core, channels, saturator order).
+        // Core 1 is the BBD line, anything else the digital ring. inR and
+        // wetR are null when Stereo is false. The diffuser can start or
+        // stop inside the block, so that axis is picked per sub-chunk.
+        template <int Core, bool Stereo, int SatOrder>
+        void processBlock_(const float *inL, const float *inR, float *wetL, float *wetR, int n) noexcept
+        {
+            const int mask = ringL_.mask();
 
-                const float dMin = std::max(kMinLoopDelay, std::min(dCur, dTgt) - satLatMax - baseT - modGuard);
+            int s = 0;
+            while (s < n)
+            {
+                const int remaining = n - s;
 
-                int Lc = static_cast<int>(std::floor(dMin)) - kChunkGuard;
-                Lc = std::clamp(Lc, 1, std::min(kMaxChunk, remaining));
+                const float baseT = (diffState_ != DiffuserState::Off)
+                                        ? diffuser_.transportSamples()
+                                        : 0.0f;
 
-                if (Lc < 4)
+                if constexpr (Core == 1)
                 {
-                    // Per-sample scalar path (same code as processRef's body).
-                    const bool runDiff = (diffState_ != DiffuserState::Off);
-                    for (int i = 0; i < Lc; ++i)
+                    const int Lc = std::min(kMaxChunk, remaining);
+                    const bool diffuse = (diffState_ != DiffuserState::Off);
+                    withBbd_([&](auto &bbd)
                     {
-                        const float d = delaySm_.getNextValue();
-                        const float g = fbSm_.getNextValue();
-                        crossSm_.skip();
-                        const float drive = driveSm_.getNextValue();
-                        const float fade = fadeStep_();
-                        dampG_ = dampGSm_.getNextValue();
-                        cutG_ = cutGSm_.getNextValue();
-                        satLatency_ = satLatencySm_.getNextValue();
-                        const float modK = modKSm_.getNextValue();
-                        const float modL = modK * ouL_.next(rngL_);
-                        const float modR = hasR ? modK * ouR_.next(rngR_) : 0.0f;
-                        processSampleScalar_(inL + s + i, hasR ? inR + s + i : nullptr,
-                                             wetL + s + i, hasR ? wetR + s + i : nullptr,
-                                             d, g, drive, hasR, mask,
-                                             fade, runDiff ? baseT : 0.0f, modL, modR);
-                    }
+                        if (diffuse)
+                            processBbdChunk_<Stereo, true, SatOrder>(bbd, inL + s, Stereo ? inR + s : nullptr,
+                                                                      wetL + s, Stereo ? wetR + s : nullptr,
+                                                                      Lc, baseT);
+                        else
+                            processBbdChunk_<Stereo, false, SatOrder>(bbd, inL + s, Stereo ? inR + s : nullptr,
+                                                                       wetL + s, Stereo ? wetR + s : nullptr,
+                                                                       Lc, baseT);
+                    });
                     s += Lc;
                     continue;
-                }
-
-                alignas(16) std::array<float, kMaxChunk> dR{};
-                alignas(16) std::array<float, kMaxChunk> gR{};
-                alignas(16) std::array<float, kMaxChunk> crossR{};
-                alignas(16) std::array<float, kMaxChunk> driveR{};
-                alignas(16) std::array<float, kMaxChunk> fadeR{};
-                alignas(16) std::array<float, kMaxChunk> dampGR{};
-                alignas(16) std::array<float, kMaxChunk> satLatR{};
-                alignas(16) std::array<float, kMaxChunk> cutGR{};
-                alignas(16) std::array<float, kMaxChunk> modLR{};
-                alignas(16) std::array<float, kMaxChunk> modRR{};
-                const bool wasRunning = (diffState_ != DiffuserState::Off);
-                for (int i = 0; i < Lc; ++i)
-                {
-                    dR[i] = delaySm_.getNextValue();
-                    gR[i] = fbSm_.getNextValue();
-                    crossR[i] = crossSm_.getNextValue();
-                    driveR[i] = driveSm_.getNextValue();
-                    fadeR[i] = fadeStep_();
-                    dampGR[i] = dampGSm_.getNextValue();
-                    cutGR[i] = cutGSm_.getNextValue();
-                    satLatR[i] = satLatencySm_.getNextValue();
-                    const float modK = modKSm_.getNextValue();
-                    modLR[i] = modK * ouL_.next(rngL_);
-                    modRR[i] = hasR ? modK * ouR_.next(rngR_) : 0.0f;
-                }
-                const bool runDiff = wasRunning || (diffState_ != DiffuserState::Off);
-
-                alignas(16) std::array<float, kMaxChunk> tapL{};
-                alignas(16) std::array<float, kMaxChunk> tapR{};
-                // The settled bulk read needs a constant tap. It stays off
-                // until the modulation depth reaches zero and stays there.
-                const bool modOff = (modKSm_.getCurrentValue() == 0.0f
-                                     && modKSm_.getTargetValue() == 0.0f);
-                const bool settled = (dR[0] == dR[Lc - 1])
-                                     && (fadeR[0] == fadeR[Lc - 1])
-                                     && (satLatR[0] == satLatR[Lc - 1])
-                                     && modOff;
-
-                if (settled)
+                } else
                 {
-                    const float readDelay = std::max(kMinLoopDelay, dR[0] - satLatR[0] - fadeR[0] * baseT);
-                    const auto iInt = static_cast<int>(readDelay);
-                    const float f = readDelay - static_cast<float>(iInt);
-                    const FracDelayTap::Coeffs4 k = FracDelayTap::lagrange3(f);
-                    const int base = (writeIdx_ - iInt - 3) & mask;
-                    const int winLen = Lc + 6;
-                    const M128 cf = MM(set_ps)(k.c4, k.c3, k.c2, k.c1);
-
-                    const auto wL = BlockTapReader::acquireWindow(ringL_, base, winLen, tapWinL_.data());
-                    const float *winL = wL.ptr;
-                    for (int i = 0; i < Lc; ++i)
-                    {
-                        const M128 taps = MM(loadu_ps)(winL + i + 1);
-                        const M128 prod = MM(mul_ps)(taps, cf);
-                        const M128 sh1 = MM(add_ps)(prod, MM(movehl_ps)(prod, prod));
-                        const M128 sh2 = MM(add_ss)(sh1, MM(shuffle_ps)(sh1, sh1, MM_SHUFFLE(0, 0, 0, 1)));
-                        tapL[i] = MM(cvtss_f32)(sh2);
-                    }
-
-                    if (hasR)
+                    const float dCur = delaySm_.getCurrentValue();
+                    const float dTgt = delaySm_.getTargetValue();
+                    const float satLatMax = std::max(satLatencySm_.getCurrentValue(),
+                                                     satLatencySm_.getTargetValue());
+                    // The OU state stays inside kClamp sigmas. The guard covers
+                    // the largest deviation the modulation can apply.
+                    const float modGuard = static_cast<float>(Mod::OrnsteinUhlenbeck::kClamp)
+                                           * std::max(modKSm_.getCurrentValue(), modKSm_.getTargetValue());
+
+                    const float dMin = std::max(kMinLoopDelay,
+                                                std::min(dCur, dTgt) - satLatMax - baseT - modGuard);
+
+                    int Lc = static_cast<int>(std::floor(dMin)) - kChunkGuard;
+                    Lc = std::clamp(Lc, 1, std::min(kMaxChunk, remaining));
+
+                    if (Lc < 4)
                     {
-                        const auto wR = BlockTapReader::acquireWindow(ringR_, base, winLen, tapWinR_.data());
-                        const float *winR = wR.ptr;
+                        // Per-sample scalar path (same code as processRef's body).
+                        const bool runDiff = (diffState_ != DiffuserState::Off);
                         for (int i = 0; i < Lc; ++i)
                         {
-                            const M128 taps = MM(loadu_ps)(winR + i + 1);
-                            const M128 prod = MM(mul_ps)(taps, cf);
-                            const M128 sh1 = MM(add_ps)(prod, MM(movehl_ps)(prod, prod));
-                            const M128 sh2 = MM(add_ss)(sh1, MM(shuffle_ps)(sh1, sh1, MM_SHUFFLE(0, 0, 0, 1)));
-                            tapR[i] = MM(cvtss_f32)(sh2);
+                            const float d = delaySm_.getNextValue();
+                            const float g = fbSm_.getNextValue();
+                            crossSm_.skip();
+                            const float drive = driveSm_.getNextValue();
+                            const float fade = fadeStep_();
+                            dampG_ = dampGSm_.getNextValue();
+                            cutG_ = cutGSm_.getNextValue();
+                            satLatency_ = satLatencySm_.getNextValue();
+                            const float modK = modKSm_.getNextValue();
+                            const float modL = modK * ouL_.next(rngL_);
+                            const float modR = Stereo ? modK * ouR_.next(rngR_) : 0.0f;
+                            processSampleScalar_(inL + s + i, Stereo ? inR + s + i : nullptr,
+                                                 wetL + s + i, Stereo ? wetR + s + i : nullptr,
+                                                 d, g, drive, Stereo, mask,
+                                                 fade, runDiff ? baseT : 0.0f, modL, modR);
                         }
+                        s += Lc;
+                        continue;
                     }
-                } else
-                {
+
+                    ChunkRamps r;
+                    const bool wasRunning = (diffState_ != DiffuserState::Off);
                     for (int i = 0; i < Lc; ++i)
                     {
-                        const float readDelayL = std::max(kMinLoopDelay,
-                                                          dR[i] + modLR[i] - satLatR[i] - fadeR[i] * baseT);
-                        tapL[i] = FracDelayTap::read(ringL_, writeIdx_ + i, readDelayL);
-                        if (hasR)
-                        {
-                            const float readDelayR = std::max(kMinLoopDelay,
-                                                              dR[i] + modRR[i] - satLatR[i] - fadeR[i] * baseT);
-                            tapR[i] = FracDelayTap::read(ringR_, writeIdx_ + i, readDelayR);
-                        }
+                        r.d[i] = delaySm_.getNextValue();
+                        r.g[i] = fbSm_.getNextValue();
+                        r.cross[i] = crossSm_.getNextValue();
+                        r.drive[i] = driveSm_.getNextValue();
+                        r.fade[i] = fadeStep_();
+                        r.dampG[i] = dampGSm_.getNextValue();
+                        r.cutG[i] = cutGSm_.getNextValue();
+                        r.satLat[i] = satLatencySm_.getNextValue();
+                        const float modK = modKSm_.getNextValue();
+                        r.modL[i] = modK * ouL_.next(rngL_);
+                        r.modR[i] = Stereo ? modK * ouR_.next(rngR_) : 0.0f;
                     }
+
+                    if (wasRunning || (diffState_ != DiffuserState::Off))
+                        processDigitalChunk_<Stereo, true, SatOrder>(inL + s, Stereo ? inR + s : nullptr,
+                                                                      wetL + s, Stereo ? wetR + s : nullptr,
+                                                                      r, Lc, baseT, inR != nullptr);
+                    else
+                        processDigitalChunk_<Stereo, false, SatOrder>(inL + s, Stereo ? inR + s : nullptr,
+                                                                       wetL + s, Stereo ? wetR + s : nullptr,
+                                                                       r, Lc, baseT, inR != nullptr);
+                    s += Lc;
                 }
+            }
+        }
+
+        // BBD sub-chunk on the selected chip's lines. The control ramps and
+        // the clocks for the whole chunk come first, the clocks through
+        // ClockModel::clockForBlock. The lines then hand out runs of taps
+        // ahead of their writes (BrigadeLine::readAhead), each shorter than
+        // the line's delay, so a run goes through the diffuser and the
+        // saturator as a block. Only the writes back go one sample at a time.
+        template <bool Stereo, bool Diffuse, int SatOrder, class StereoLine>
+        void processBbdChunk_(StereoLine &bbd, const float *inL, const float *inR, float *wetL, float *wetR,
+                              int Lc, float baseT) noexcept
+        {
+            static_assert(kMaxChunk <= StereoLine::Line::kMaxAhead);
+            using Clock = BBD::ClockModel<StereoLine::kStages>;
+            const int mask = ringL_.mask();
+            const float gdBank = static_cast<float>(BbdLines::Line::getBankGroupDelayAtDC(sampleRate_)) - 1.0f;
 
-                if (!hasR)
-                    for (int i = 0; i < Lc; ++i) tapR[i] = tapL[i];
+            ChunkRamps r;
+            alignas(16) std::array<float, kMaxChunk> clkL{};
+            alignas(16) std::array<float, kMaxChunk> clkR{};
+            for (int i = 0; i < Lc; ++i)
+            {
+                r.d[i] = delaySm_.getNextValue();
+                r.g[i] = fbSm_.getNextValue();
+                crossSm_.skip();
+                r.drive[i] = driveSm_.getNextValue();
+                r.fade[i] = fadeStep_();
+                r.dampG[i] = dampGSm_.getNextValue();
+                r.cutG[i] = cutGSm_.getNextValue();
+                r.satLat[i] = satLatencySm_.getNextValue();
+                const float modK = modKSm_.getNextValue();
+                const float modL = modK * ouL_.next(rngL_);
+                const float modR = Stereo ? modK * ouR_.next(rngR_) : 0.0f;
 
-                if (runDiff)
+                // Effective delays; clockForBlock turns them into clocks in place.
+                clkL[i] = r.d[i] + modL - r.satLat[i] - r.fade[i] * baseT - gdBank;
+                if constexpr (Stereo)
+                    clkR[i] = r.d[i] + modR - r.satLat[i] - r.fade[i] * baseT - gdBank;
+            }
+            Clock::clockForBlock(clkL.data(), clkL.data(), Lc, sampleRate_);
+            if constexpr (Stereo)
+                Clock::clockForBlock(clkR.data(), clkR.data(), Lc, sampleRate_);
+            dampG_ = r.dampG[Lc - 1];
+            cutG_ = r.cutG[Lc - 1];
+            satLatency_ = r.satLat[Lc - 1];
+
+            alignas(16) std::array<float, kMaxChunk> tapL{};
+            alignas(16) std::array<float, kMaxChunk> tapR{};
+            alignas(16) std::array<float, kMaxChunk> vL{};
+            alignas(16) std::array<float, kMaxChunk> vR{};
+            alignas(16) std::array<float, kMaxChunk> wL{};
+            alignas(16) std::array<float, kMaxChunk> wR{};
+            for (int i0 = 0; i0 < Lc;)
+            {
+                // Equal clocks (no or linked modulation) run both lines on
+                // one event schedule.
+                int m;
+                if constexpr (Stereo)
+                    m = bbd.readAhead(clkL.data() + i0, clkR.data() + i0, tapL.data() + i0, tapR.data() + i0, Lc - i0);
+                else
                 {
-                    alignas(16) std::array<float, kMaxChunk> rawL{};
-                    alignas(16) std::array<float, kMaxChunk> rawR{};
-                    std::memcpy(rawL.data(), tapL.data(), static_cast<std::size_t>(Lc) * sizeof(float));
-                    std::memcpy(rawR.data(), tapR.data(), static_cast<std::size_t>(Lc) * sizeof(float));
-                    diffuser_.processBlock(tapL.data(), hasR ? tapR.data() : nullptr, Lc);
-                    for (int i = 0; i < Lc; ++i)
+                    m = bbd.left().readAhead(clkL.data() + i0, tapL.data() + i0, Lc - i0);
+                    std::memcpy(tapR.data() + i0, tapL.data() + i0, static_cast<std::size_t>(m) * sizeof(float));
+                }
+                const int i1 = i0 + m;
+
+                if constexpr (Diffuse)
+                {
+                    alignas(16) std::array<float, kMaxChunk> diffL{};
+                    alignas(16) std::array<float, kMaxChunk> diffR{};
+                    std::memcpy(diffL.data(), tapL.data() + i0, static_cast<std::size_t>(m) * sizeof(float));
+                    std::memcpy(diffR.data(), tapR.data() + i0, static_cast<std::size_t>(m) * sizeof(float));
+                    diffuser_.processBlock(diffL.data(), Stereo ? diffR.data() : nullptr, m);
+                    for (int i = i0; i < i1; ++i)
                     {
-                        const float a = fadeR[i];
-                        tapL[i] = rawL[i] * (1.0f - a) + tapL[i] * a;
-                        if (hasR)
-                            tapR[i] = rawR[i] * (1.0f - a) + tapR[i] * a;
+                        const float a = r.fade[i];
+                        tapL[i] = tapL[i] * (1.0f - a) + diffL[i - i0] * a;
+                        if constexpr (Stereo)
+                            tapR[i] = tapR[i] * (1.0f - a) + diffR[i - i0] * a;
                         else
                             tapR[i] = tapL[i]; // mono: mirror the blended L
                     }
                 }
 
-                alignas(16) std::array<float, kMaxChunk> vL{};
-                alignas(16) std::array<float, kMaxChunk> vR{};
-                for (int i = 0; i < Lc; ++i)
+                for (int i = i0; i < i1; ++i)
                 {
-                    const float g = gR[i];
-                    if (hasR)
+                    const float g = r.g[i];
+                    if constexpr (Stereo)
                     {
-                        const float mixL = crossCos_ * tapL[i] + crossSin_ * tapR[i];
-                        const float mixR = crossCos_ * tapR[i] + crossSin_ * tapL[i];
-                        vL[i] = g * mixL;
-                        vR[i] = g * mixR;
+                        vL[i] = g * (crossCos_ * tapL[i] + crossSin_ * tapR[i]);
+                        vR[i] = g * (crossCos_ * tapR[i] + crossSin_ * tapL[i]);
                     } else
                     {
                         vL[i] = g * tapL[i];
-                        vR[i] = vL[i];
                     }
                 }
 
-                alignas(16) std::array<float, kMaxChunk> wL{};
-                alignas(16) std::array<float, kMaxChunk> wR{};
-                if (satOrder_ == 0)
-                {
-                    for (int i = 0; i < Lc; ++i)
-                    {
-                        const float makeup = 1.0f / driveR[i];
-                        vL[i] = std::clamp(driveR[i] * vL[i], -1.0f, 1.0f) * makeup;
-                        if (hasR) vR[i] = std::clamp(driveR[i] * vR[i], -1.0f, 1.0f) * makeup;
-                        else vR[i] = vL[i];
-                    }
-                } else if (satOrder_ == 1)
-                {
-                    for (int i = 0; i < Lc; ++i)
-                    {
-                        const float makeup = 1.0f / driveR[i];
-                        vL[i] = static_cast<float>(adaa1L_.process(driveR[i] * vL[i])) * makeup;
-                        if (hasR) vR[i] = static_cast<float>(adaa1R_.process(driveR[i] * vR[i])) * makeup;
-                        else vR[i] = vL[i];
-                    }
-                } else
-                {
-                    for (int i = 0; i < Lc; ++i)
-                    {
-                        const float makeup = 1.0f / driveR[i];
-                        vL[i] = static_cast<float>(adaa2L_.process(driveR[i] * vL[i])) * makeup;
-                        if (hasR) vR[i] = static_cast<float>(adaa2R_.process(driveR[i] * vR[i])) * makeup;
-                        else vR[i] = vL[i];
-                    }
-                }
+                saturateChunk_<SatOrder>(adaa1L_, adaa2L_, vL.data() + i0, r.drive.data() + i0, m);
+                if constexpr (Stereo)
+                    saturateChunk_<SatOrder>(adaa1R_, adaa2R_, vR.data() + i0, r.drive.data() + i0, m);
+                else
+                    std::memcpy(vR.data() + i0, vL.data() + i0, static_cast<std::size_t>(m) * sizeof(float));
 
-                for (int i = 0; i < Lc; ++i)
+                for (int i = i0; i < i1; ++i)
                 {
-                    dampL_ += dampGR[i] * (vL[i] - dampL_);
-                    dampR_ += dampGR[i] * (vR[i] - dampR_);
+                    dampL_ += r.dampG[i] * (vL[i] - dampL_);
+                    dampR_ += r.dampG[i] * (vR[i] - dampR_);
 
-                    cutLpL_ += cutGR[i] * (dampL_ - cutLpL_);
-                    cutLpR_ += cutGR[i] * (dampR_ - cutLpR_);
+                    cutLpL_ += r.cutG[i] * (dampL_ - cutLpL_);
+                    cutLpR_ += r.cutG[i] * (dampR_ - cutLpR_);
                     const float cutL = dampL_ - cutLpL_;
                     const float cutR = dampR_ - cutLpR_;
 
@@ -473,92 +567,199 @@ namespace MarsDSP::Delays
                     dcXR_ = cutR;
                     dcYR_ = hR;
 
-                    wL[i] = inL[s + i] + hL;
+                    wL[i] = inL[i] + hL;
                     if (!std::isfinite(wL[i])) wL[i] = 0.0f;
-                    if (hasR)
+                    if constexpr (Stereo)
                     {
-                        wR[i] = inR[s + i] + hR;
+                        wR[i] = inR[i] + hR;
                         if (!std::isfinite(wR[i])) wR[i] = 0.0f;
+                        bbd.writeAhead(wL[i], wR[i]);
+                    } else
+                    {
+                        bbd.left().writeAhead(wL[i]);
                     }
                 }
+                i0 = i1;
+            }
 
-                ringL_.writeBlock(wL.data(), writeIdx_, Lc);
-                ringL_.refreshMirror(writeIdx_, Lc);
-                if (hasR)
+            // The digital ring follows along, for a switch back.
+            ringL_.writeBlock(wL.data(), writeIdx_, Lc);
+            ringL_.refreshMirror(writeIdx_, Lc);
+            if constexpr (Stereo)
+            {
+                ringR_.writeBlock(wR.data(), writeIdx_, Lc);
+                ringR_.refreshMirror(writeIdx_, Lc);
+            }
+            writeIdx_ = (writeIdx_ + Lc) & mask;
+
+            for (int i = 0; i < Lc; ++i)
+            {
+                wetL[i] = tapL[i] * loopTrim_;
+                if constexpr (Stereo) wetR[i] = tapR[i] * loopTrim_;
+            }
+        }
+
+        // Digital sub-chunk of Lc >= 4 samples, read from the ring as a
+        // block. The ramps were pulled by the caller. hasR is the caller's
+        // runtime view of Stereo, used only by the modulated read.
+        template <bool Stereo, bool Diffuse, int SatOrder>
+        void processDigitalChunk_(const float *inL, const float *inR, float *wetL, float *wetR,
+                                  const ChunkRamps &r, int Lc, float baseT, bool hasR) noexcept
+        {
+            const int mask = ringL_.mask();
+
+            alignas(16) std::array<float, kMaxChunk> tapL{};
+            alignas(16) std::array<float, kMaxChunk> tapR{};
+            // The settled bulk read needs a constant tap. It stays off
+            // until the modulation depth reaches zero and stays there.
+            const bool modOff = (modKSm_.getCurrentValue() == 0.0f
+                                 && modKSm_.getTargetValue() == 0.0f);
+            const bool settled = (r.d[0] == r.d[Lc - 1])
+                                 && (r.fade[0] == r.fade[Lc - 1])
+                                 && (r.satLat[0] == r.satLat[Lc - 1])
+                                 && modOff;
+
+            if (settled)
+            {
+                const float readDelay = std::max(kMinLoopDelay, r.d[0] - r.satLat[0] - r.fade[0] * baseT);
+                const auto iInt = static_cast<int>(readDelay);
+                const float f = readDelay - static_cast<float>(iInt);
+                const FracDelayTap::Coeffs4 k = FracDelayTap::lagrange3(f);
+                const int base = (writeIdx_ - iInt - 3) & mask;
+                const int winLen = Lc + 6;
+                const M128 cf = MM(set_ps)(k.c4, k.c3, k.c2, k.c1);
+
+                const auto wL = BlockTapReader::acquireWindow(ringL_, base, winLen, tapWinL_.data());
+                const float *winL = wL.ptr;
+                for (int i = 0; i < Lc; ++i)
                 {
-                    ringR_.writeBlock(wR.data(), writeIdx_, Lc);
-                    ringR_.refreshMirror(writeIdx_, Lc);
+                    const M128 taps = MM(loadu_ps)(winL + i + 1);
+                    const M128 prod = MM(mul_ps)(taps, cf);
+                    const M128 sh1 = MM(add_ps)(prod, MM(movehl_ps)(prod, prod));
+                    const M128 sh2 = MM(add_ss)(sh1, MM(shuffle_ps)(sh1, sh1, MM_SHUFFLE(0, 0, 0, 1)));
+                    tapL[i] = MM(cvtss_f32)(sh2);
                 }
-                writeIdx_ = (writeIdx_ + Lc) & mask;
 
+                if constexpr (Stereo)
+                {
+                    const auto wR = BlockTapReader::acquireWindow(ringR_, base, winLen, tapWinR_.data());
+                    const float *winR = wR.ptr;
+                    for (int i = 0; i < Lc; ++i)
+                    {
+                        const M128 taps = MM(loadu_ps)(winR + i + 1);
+                        const M128 prod = MM(mul_ps)(taps, cf);
+                        const M128 sh1 = MM(add_ps)(prod, MM(movehl_ps)(prod, prod));
+                        const M128 sh2 = MM(add_ss)(sh1, MM(shuffle_ps)(sh1, sh1, MM_SHUFFLE(0, 0, 0, 1)));
+                        tapR[i] = MM(cvtss_f32)(sh2);
+                    }
+                }
+            } else
+            {
+                // The channel test stays a runtime branch here. It keeps the
+                // read-delay arithmetic shaped like processRef's, so the
+                // compiler fuses (or not) the same multiply-add and the
+                // tap lands on the same ulp.
                 for (int i = 0; i < Lc; ++i)
                 {
-                    wetL[s + i] = tapL[i] * loopTrim_;
-                    if (hasR) wetR[s + i] = tapR[i] * loopTrim_;
+                    const float readDelayL = std::max(kMinLoopDelay,
+                                                      r.d[i] + r.modL[i] - r.satLat[i] - r.fade[i] * baseT);
+                    tapL[i] = FracDelayTap::read(ringL_, writeIdx_ + i, readDelayL);
+                    if (hasR)
+                    {
+                        const float readDelayR = std::max(kMinLoopDelay,
+                                                          r.d[i] + r.modR[i] - r.satLat[i] - r.fade[i] * baseT);
+                        tapR[i] = FracDelayTap::read(ringR_, writeIdx_ + i, readDelayR);
+                    }
                 }
-                s += Lc;
             }
-        }
 
-        // reference only -- do not optimize, do not delete.
-        void processRef(const float *inL, const float *inR, float *wetL, float *wetR, int n) noexcept
-        {
-            assert(inL != nullptr && wetL != nullptr);
-            const bool hasR = (inR != nullptr && wetR != nullptr);
-            const int mask = ringL_.mask();
+            if constexpr (!Stereo)
+                tapR = tapL;
 
-            updateCrossRotation_(); // block-rate equal-power cross-feed coefficients
-            diffuserTransition_();
+            if constexpr (Diffuse)
+            {
+                alignas(16) std::array<float, kMaxChunk> rawL{};
+                alignas(16) std::array<float, kMaxChunk> rawR{};
+                std::memcpy(rawL.data(), tapL.data(), static_cast<std::size_t>(Lc) * sizeof(float));
+                std::memcpy(rawR.data(), tapR.data(), static_cast<std::size_t>(Lc) * sizeof(float));
+                diffuser_.processBlock(tapL.data(), Stereo ? tapR.data() : nullptr, Lc);
+                for (int i = 0; i < Lc; ++i)
+                {
+                    const float a = r.fade[i];
+                    tapL[i] = rawL[i] * (1.0f - a) + tapL[i] * a;
+                    if constexpr (Stereo)
+                        tapR[i] = rawR[i] * (1.0f - a) + tapR[i] * a;
+                    else
+                        tapR[i] = tapL[i]; // mono: mirror the blended L
+                }
+            }
 
-            for (int s = 0; s < n; ++s)
+            alignas(16) std::array<float, kMaxChunk> vL{};
+            alignas(16) std::array<float, kMaxChunk> vR{};
+            for (int i = 0; i < Lc; ++i)
             {
-                const float baseT = (diffState_ != DiffuserState::Off) ? diffuser_.transportSamples() : 0.0f;
-                const float d = delaySm_.getNextValue();
-                const float g = fbSm_.getNextValue();
-                crossSm_.skip();
-                const float drive = driveSm_.getNextValue();
-                const float fade = fadeStep_();
-                dampG_ = dampGSm_.getNextValue();
-                cutG_ = cutGSm_.getNextValue();
-                satLatency_ = satLatencySm_.getNextValue();
-                const float modK = modKSm_.getNextValue();
-                const float modL = modK * ouL_.next(rngL_);
-                const float modR = hasR ? modK * ouR_.next(rngR_) : 0.0f;
-                processSampleScalar_(inL + s, hasR ? inR + s : nullptr,
-                                     wetL + s, hasR ? wetR + s : nullptr,
-                                     d, g, drive, hasR, mask, fade, baseT,
-                                     modL, modR);
+                const float g = r.g[i];
+                if constexpr (Stereo)
+                {
+                    const float mixL = crossCos_ * tapL[i] + crossSin_ * tapR[i];
+                    const float mixR = crossCos_ * tapR[i] + crossSin_ * tapL[i];
+                    vL[i] = g * mixL;
+                    vR[i] = g * mixR;
+                } else
+                {
+                    vL[i] = g * tapL[i];
+                }
             }
-        }
 
-        [[nodiscard]] static constexpr int latencySamples() noexcept { return 0; }
-        [[nodiscard]] float getMaxDelay() const noexcept { return maxDelay_; }
-        [[nodiscard]] float ouStateMaxSigma() const noexcept { return diffuser_.ouStateMaxSigma(); }
-        [[nodiscard]] float currentDelaySamples() const noexcept { return delaySm_.getCurrentValue(); }
+            saturateChunk_<SatOrder>(adaa1L_, adaa2L_, vL.data(), r.drive.data(), Lc);
+            if constexpr (Stereo)
+                saturateChunk_<SatOrder>(adaa1R_, adaa2R_, vR.data(), r.drive.data(), Lc);
+            else
+                vR = vL;
 
-        // RMS ratio of tanh(k * x) to x for a 0.5-amplitude sine reference.
-        // The loop output trim is pow(rmsRatio, -0.5). Computed by fixed
-        // quadrature over one sine period.
-        static float rmsRatioForDrive_(float k) noexcept
-        {
-            constexpr int N = 128;
-            constexpr double kPi = 3.14159265358979323846;
-            const double kd = k;
-            double sum = 0.0;
-            for (int i = 0; i < N; ++i)
+            alignas(16) std::array<float, kMaxChunk> wL{};
+            alignas(16) std::array<float, kMaxChunk> wR{};
+            for (int i = 0; i < Lc; ++i)
             {
-                const double t = kPi * (static_cast<double>(i) + 0.5) / static_cast<double>(N);
-                const double x = kd * 0.5 * std::sin(2.0 * t);
-                const double y = std::tanh(x);
-                sum += y * y;
+                dampL_ += r.dampG[i] * (vL[i] - dampL_);
+                dampR_ += r.dampG[i] * (vR[i] - dampR_);
+
+                cutLpL_ += r.cutG[i] * (dampL_ - cutLpL_);
+                cutLpR_ += r.cutG[i] * (dampR_ - cutLpR_);
+                const float cutL = dampL_ - cutLpL_;
+                const float cutR = dampR_ - cutLpR_;
+
+                const float hL = cutL - dcXL_ + dcR_ * dcYL_;
+                dcXL_ = cutL;
+                dcYL_ = hL;
+                const float hR = cutR - dcXR_ + dcR_ * dcYR_;
+                dcXR_ = cutR;
+                dcYR_ = hR;
+
+                wL[i] = inL[i] + hL;
+                if (!std::isfinite(wL[i])) wL[i] = 0.0f;
+                if constexpr (Stereo)
+                {
+                    wR[i] = inR[i] + hR;
+                    if (!std::isfinite(wR[i])) wR[i] = 0.0f;
+                }
             }
-            const double rmsTanh = std::sqrt(sum / static_cast<double>(N));
-            constexpr double rmsRef = 0.5 / 1.41421356237309504880;
-            return static_cast<float>(rmsTanh / rmsRef);
-        }
 
-    private:
-        enum class DiffuserState { Off, FadingIn, On, FadingOut };
+            ringL_.writeBlock(wL.data(), writeIdx_, Lc);
+            ringL_.refreshMirror(writeIdx_, Lc);
+            if constexpr (Stereo)
+            {
+                ringR_.writeBlock(wR.data(), writeIdx_, Lc);
+                ringR_.refreshMirror(writeIdx_, Lc);
+            }
+            writeIdx_ = (writeIdx_ + Lc) & mask;
+
+            for (int i = 0; i < Lc; ++i)
+            {
+                wetL[i] = tapL[i] * loopTrim_;
+                if constexpr (Stereo) wetR[i] = tapR[i] * loopTrim_;
+            }
+        }
 
         static constexpr int kDiffuserFadeSamples = 480; // ~10 ms @48 kHz
         static constexpr float kDiffuserFadeInc = 1.0f / static_cast<float>(kDiffuserFadeSamples);
@@ -602,12 +803,35 @@ namespace MarsDSP::Delays
             return a;
         }
 
+        // A new chip starts from empty buckets: the previous chip's lines
+        // wrote the same storage.
+        void applyBbdChip_(int chip) noexcept
+        {
+            chip = std::clamp(chip, 0, static_cast<int>(BBD::kChipStages.size()) - 1);
+            if (chip == bbdChip_)
+                return;
+            bbdChip_ = chip;
+            withBbd_([](auto &bbd) { bbd.reset(); });
+        }
+
+        // Calls fn with the selected chip's StereoBrigadeLine.
+        template <class Fn>
+        void withBbd_(Fn &&fn) noexcept
+        {
+            switch (bbdChip_)
+            {
+                case 1: fn(std::get<1>(bbd_)); break;
+                case 2: fn(std::get<2>(bbd_)); break;
+                case 3: fn(std::get<3>(bbd_)); break;
+                default: fn(std::get<0>(bbd_)); break;
+            }
+        }
+
         void applyDiffuserParams_(const Params &p) noexcept
         {
             diffuser_.setDiffusion(p.diffusion);
             diffuser_.setSize(p.diffuserSize);
-            const float diffModSamples = p.diffModDepth * 0.001f * static_cast<float>(sampleRate_);
-            diffuser_.setModDepthSamples(diffModSamples);
+            setDiffModDepth(p.diffModDepth);
             diffuser_.setModRateHz(p.diffModRateHz);
         }
 
@@ -621,7 +845,9 @@ namespace MarsDSP::Delays
             sampleRate_ = sampleRate;
             const int minCap = maxDelaySamples + maxBlockSize
                                + Pow2RingBuffer::kTail + 8;
-            constexpr std::size_t perChan = (static_cast<std::size_t>(BBD::BrigadeLine::kStages + 1) + 15u) & ~static_cast<std::size_t>(15u);
+            // Every chip's lines share one block sized for the longest.
+            // Only the selected chip runs, and switching chips clears it.
+            constexpr std::size_t perChan = BbdLines::Line::bbdStorageFloats(1);
             if (arena != nullptr)
             {
                 ringL_.prepare(minCap, *arena);
@@ -629,16 +855,16 @@ namespace MarsDSP::Delays
                 diffuser_.prepare(sampleRate, *arena);
                 float *bbdMemL = arena->allocate<float>(perChan, Memory::BumpArena::kBaseAlignment);
                 float *bbdMemR = arena->allocate<float>(perChan, Memory::BumpArena::kBaseAlignment);
-                bbdL_.prepare(sampleRate, bbdMemL);
-                bbdR_.prepare(sampleRate, bbdMemR);
+                std::apply([&](auto &...line) { (line.prepare(sampleRate, bbdMemL, bbdMemR), ...); }, bbd_);
             } else
             {
                 ringL_.prepare(minCap);
                 ringR_.prepare(minCap);
                 diffuser_.prepare(sampleRate);
-                bbdHeapStorage_.resize(BBD::BrigadeLine::bbdStorageFloats(2), 0.0f);
-                bbdL_.prepare(sampleRate, bbdHeapStorage_.data());
-                bbdR_.prepare(sampleRate, bbdHeapStorage_.data() + perChan);
+                bbdHeapStorage_.resize(BbdLines::bbdStorageFloats(), 0.0f);
+                float *bbdMemL = bbdHeapStorage_.data();
+                float *bbdMemR = bbdHeapStorage_.data() + perChan;
+                std::apply([&](auto &...line) { (line.prepare(sampleRate, bbdMemL, bbdMemR), ...); }, bbd_);
             }
             maxDelay_ = static_cast<float>(
                 ringL_.getCapacity() - Pow2RingBuffer::kTail - 2);
@@ -679,36 +905,58 @@ namespace MarsDSP::Delays
 
         void applyBlockRate_(const Params &p) noexcept
         {
-            const double fc = std::clamp(static_cast<double>(p.dampHz), 20.0, 0.45 * sampleRate_);
-            const double gw = std::tan(std::numbers::pi * fc / sampleRate_);
-            dampGSm_.setTargetValue(static_cast<float>(gw / (1.0 + gw)));
+            applyDamp_(p.dampHz);
 
             // DC blocker pole: 5 Hz. The blocker sits after the saturator
             // and compounds over more passes. The 5 Hz corner keeps the
             // loss at 40 Hz under 2 dB over 20 passes.
             dcR_ = static_cast<float>(std::exp(-2.0 * std::numbers::pi * 5.0 / sampleRate_));
 
-            // Low cut: one-pole highpass, same topology as the damp filter.
-            const double fcCut = std::clamp(static_cast<double>(p.loopCutHz), 20.0, 0.45 * sampleRate_);
+            applyLoopCut_(p.loopCutHz);
+            applySatOrder_(p.satOrder);
+            applyLoopTrim_(p.loopDrive);
+            applyDelayMod_(p.delayModDepth, p.delayModRateHz);
+        }
+
+        void applyDamp_(float dampHz) noexcept
+        {
+            const double fc = std::clamp(static_cast<double>(dampHz), 20.0, 0.45 * sampleRate_);
+            const double gw = std::tan(std::numbers::pi * fc / sampleRate_);
+            dampGSm_.setTargetValue(static_cast<float>(gw / (1.0 + gw)));
+        }
+
+        // Low cut: one-pole highpass, same topology as the damp filter.
+        void applyLoopCut_(float loopCutHz) noexcept
+        {
+            const double fcCut = std::clamp(static_cast<double>(loopCutHz), 20.0, 0.45 * sampleRate_);
             const double gwCut = std::tan(std::numbers::pi * fcCut / sampleRate_);
             cutGSm_.setTargetValue(static_cast<float>(gwCut / (1.0 + gwCut)));
+        }
 
-            satOrder_ = std::clamp(p.satOrder, 0, 2);
+        void applySatOrder_(int order) noexcept
+        {
+            satOrder_ = std::clamp(order, 0, 2);
             const float newSatLatency = (satOrder_ == 2)
                                             ? 1.0f
                                             : (satOrder_ == 1)
                                                   ? 0.5f
                                                   : 0.0f;
             satLatencySm_.setTargetValue(newSatLatency);
+        }
 
-            const float clampedDrive = std::clamp(p.loopDrive, 0.1f, 16.0f);
+        void applyLoopTrim_(float loopDrive) noexcept
+        {
+            const float clampedDrive = std::clamp(loopDrive, 0.1f, 16.0f);
             loopTrim_ = Math::loopTrim(clampedDrive);
+        }
 
-            const float modRate = std::clamp(p.delayModRateHz, 0.01f, 10.0f);
+        void applyDelayMod_(float depthCents, float rateHz) noexcept
+        {
+            const float modRate = std::clamp(rateHz, 0.01f, 10.0f);
             ouL_.setRate(sampleRate_, modRate);
             ouR_.setRate(sampleRate_, modRate);
 
-            const float cents = std::clamp(p.delayModDepth, 0.0f, 50.0f);
+            const float cents = std::clamp(depthCents, 0.0f, 50.0f);
             // Map the depth in cents to an RMS delay slope. A pitch reading
             // averages the slope over the tone period, so the scale uses the
             // windowed increment RMS of the OU process. The reference window
@@ -729,6 +977,50 @@ namespace MarsDSP::Delays
             crossSin_ = mmSin(theta);
         }
 
+        template <int SatOrder>
+        static float saturateFixed_(Nonlinear::ADAA1<Nonlinear::TanhNL> &a1,
+                                    Nonlinear::ADAA2<Nonlinear::TanhNL> &a2,
+                                    float x) noexcept
+        {
+            if constexpr (SatOrder == 2) return static_cast<float>(a2.process(x));
+            else if constexpr (SatOrder == 1) return static_cast<float>(a1.process(x));
+            else return std::clamp(x, -1.0f, 1.0f);
+        }
+
+        // One channel of a digital sub-chunk through the saturator, in
+        // place, makeup included. A quiet sub-chunk takes the ADAA's series
+        // path in one go; otherwise, or with the fast path off, per sample.
+        template <int SatOrder>
+        void saturateChunk_(Nonlinear::ADAA1<Nonlinear::TanhNL> &a1,
+                            Nonlinear::ADAA2<Nonlinear::TanhNL> &a2,
+                            float *v, const float *drive, int Lc) noexcept
+        {
+            if constexpr (SatOrder > 0)
+            {
+                if (seriesFastPath_)
+                {
+                    alignas(16) std::array<double, kMaxChunk> x{};
+                    alignas(16) std::array<double, kMaxChunk> y{};
+                    for (int i = 0; i < Lc; ++i)
+                        x[static_cast<std::size_t>(i)] = drive[i] * v[i];
+                    const bool quiet = SatOrder == 2
+                                           ? a2.trySeriesBlock(x.data(), y.data(), Lc)
+                                           : a1.trySeriesBlock(x.data(), y.data(), Lc);
+                    if (quiet)
+                    {
+                        for (int i = 0; i < Lc; ++i)
+                            v[i] = static_cast<float>(y[static_cast<std::size_t>(i)]) * (1.0f / drive[i]);
+                        return;
+                    }
+                }
+            }
+            for (int i = 0; i < Lc; ++i)
+            {
+                const float makeup = 1.0f / drive[i];
+                v[i] = saturateFixed_<SatOrder>(a1, a2, drive[i] * v[i]) * makeup;
+            }
+        }
+
         float saturate_(Nonlinear::ADAA1<Nonlinear::TanhNL> &a1,
                         Nonlinear::ADAA2<Nonlinear::TanhNL> &a2,
                         float x) noexcept
@@ -755,20 +1047,25 @@ namespace MarsDSP::Delays
 
             if (delayMode_ == 1)
             {
-                const float gdBank = static_cast<float>(BBD::BrigadeLine::getBankGroupDelayAtDC(sampleRate_)) - 1.0f;
-                const float dEffL = d + modL - satLatency_ - fade * baseT - gdBank;
-                bbdL_.setClockHz(BBD::ClockModel::clockFor(dEffL, sampleRate_));
-                tapL = bbdL_.readTap();
-                if (hasR)
+                withBbd_([&](auto &bbd)
                 {
-                    const float dEffR = d + modR - satLatency_ - fade * baseT - gdBank;
-                    bbdR_.setClockHz(BBD::ClockModel::clockFor(dEffR, sampleRate_));
-                    tapR = bbdR_.readTap();
-                }
-                else
-                {
-                    tapR = tapL;
-                }
+                    using Clock = BBD::ClockModel<std::remove_reference_t<decltype(bbd)>::kStages>;
+                    const float gdBank = static_cast<float>(BbdLines::Line::getBankGroupDelayAtDC(sampleRate_)) - 1.0f;
+                    const float dEffL = d + modL - satLatency_ - fade * baseT - gdBank;
+                    if (hasR)
+                    {
+                        const float dEffR = d + modR - satLatency_ - fade * baseT - gdBank;
+                        bbd.setClockHz(Clock::clockFor(dEffL, sampleRate_),
+                                       Clock::clockFor(dEffR, sampleRate_));
+                        bbd.readTap(tapL, tapR);
+                    }
+                    else
+                    {
+                        bbd.left().setClockHz(Clock::clockFor(dEffL, sampleRate_));
+                        tapL = bbd.left().readTap();
+                        tapR = tapL;
+                    }
+                });
             }
             else
             {
@@ -821,7 +1118,7 @@ namespace MarsDSP::Delays
 
             float wL = *in + hL;
             if (!std::isfinite(wL)) wL = 0.0f;
-            if (delayMode_ == 1) bbdL_.writeSample(wL);
+            if (delayMode_ == 1) withBbd_([wL](auto &bbd) { bbd.left().writeSample(wL); });
             ringL_.writeBlock(&wL, writeIdx_, 1);
             ringL_.refreshMirror(writeIdx_, 1);
 
@@ -829,7 +1126,7 @@ namespace MarsDSP::Delays
             {
                 float wR = *inR + hR;
                 if (!std::isfinite(wR)) wR = 0.0f;
-                if (delayMode_ == 1) bbdR_.writeSample(wR);
+                if (delayMode_ == 1) withBbd_([wR](auto &bbd) { bbd.right().writeSample(wR); });
                 ringR_.writeBlock(&wR, writeIdx_, 1);
                 ringR_.refreshMirror(writeIdx_, 1);
             }
@@ -882,15 +1179,19 @@ namespace MarsDSP::Delays
         Nonlinear::ADAA1<Nonlinear::TanhNL> adaa1R_;
         Nonlinear::ADAA2<Nonlinear::TanhNL> adaa2L_;
         Nonlinear::ADAA2<Nonlinear::TanhNL> adaa2R_;
+        bool seriesFastPath_ = true;
 
         alignas(16) std::array<float, static_cast<std::size_t>(kMaxChunk) + Pow2RingBuffer::kTail> tapWinL_{};
         alignas(16) std::array<float, static_cast<std::size_t>(kMaxChunk) + Pow2RingBuffer::kTail> tapWinR_{};
 
         Diffusion::Diffuser diffuser_;
-        BBD::BrigadeLine bbdL_;
-        BBD::BrigadeLine bbdR_;
+        std::tuple<BbdLines,
+                   BBD::StereoBrigadeLine<BBD::kChipStages[1]>,
+                   BBD::StereoBrigadeLine<BBD::kChipStages[2]>,
+                   BBD::StereoBrigadeLine<BBD::kChipStages[3]>> bbd_;
         std::vector<float> bbdHeapStorage_;
         int delayMode_ = 0;
+        int bbdChip_ = 0;
         bool enableDiffuser_ = false;
         DiffuserState diffState_ = DiffuserState::Off;
         float diffFade_ = 0.0f; // 0 = raw tap, 1 = diffused tap
@@ -56,6 +56,9 @@ namespace MarsDSP::Smoothers {
         [[nodiscard]] T getTargetValue() const noexcept { return target_; }
         [[nodiscard]] bool isSmoothing() const noexcept { return countdown_ > 0; }
 
+        /// True if the ramp reaches its target within the next n samples.
+        [[nodiscard]] bool settlesWithin(int n) const noexcept { return countdown_ <= n; }
+
     private:
         T current_{};
         T target_{};
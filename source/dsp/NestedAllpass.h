@@ -13,6 +13,7 @@
 #include "FracDelayTap.h"
 #include "Pow2RingBuffer.h"
 #include "simd/Config.h"
+#include "simd/Kernels.h"
 #include "utils/memory/BumpArena.h"
 
 #include <algorithm>
@@ -115,7 +116,7 @@ namespace MarsDSP::Diffusion
             }
         }
 
-        // Process samples in four-wide vector chunks.
+        // Process samples in vector chunks on the dispatched SIMD tier.
         void processBlock(float *io, int n) noexcept
         {
             assert(io != nullptr);
@@ -125,101 +126,43 @@ namespace MarsDSP::Diffusion
             const auto iIntOut = static_cast<int>(dOut_);
             const float fOut = dOut_ - static_cast<float>(iIntOut);
             const auto kOut = Delays::FracDelayTap::lagrange3(fOut);
-            const M128 cfOut = MM(set_ps)(kOut.c4, kOut.c3, kOut.c2, kOut.c1);
 
             const auto iIntIn = static_cast<int>(dIn_);
             const float fIn = dIn_ - static_cast<float>(iIntIn);
             const auto kIn = Delays::FracDelayTap::lagrange3(fIn);
-            const M128 cfIn = MM(set_ps)(kIn.c4, kIn.c3, kIn.c2, kIn.c1);
 
-            const M128 vGOut = MM(set1_ps)(gOut_);
-            const M128 vGIn = MM(set1_ps)(gIn_);
+            alignas(16) std::array<float, kChunk> vInArr{};
+            alignas(16) std::array<float, kChunk> wArr{};
+
+            Simd::AllpassTaps taps{};
+            taps.cfOut[0] = kOut.c1;
+            taps.cfOut[1] = kOut.c2;
+            taps.cfOut[2] = kOut.c3;
+            taps.cfOut[3] = kOut.c4;
+            taps.cfIn[0] = kIn.c1;
+            taps.cfIn[1] = kIn.c2;
+            taps.cfIn[2] = kIn.c3;
+            taps.cfIn[3] = kIn.c4;
+            taps.gOut = gOut_;
+            taps.gIn = gIn_;
+            taps.vIn = vInArr.data();
+            taps.w = wArr.data();
+
+            const Simd::KernelTable &kernels = Simd::kernels();
 
             for (int off = 0; off < n; off += kChunk)
             {
                 const int m = std::min(kChunk, n - off);
 
-                // Read the outer delay taps.
+                // Both tap windows, sample i reads taps i+1..i+4.
                 const int baseOut = (wOut_ - iIntOut - 3) & maskOut;
-                const int winLenOut = m + 6;
-                const auto wPtrOut = Delays::BlockTapReader::acquireWindow(ringOut_, baseOut, winLenOut, tapWinOut_.data());
-                const float *winOut = wPtrOut.ptr;
-
-                alignas(16) std::array<float, kChunk> dArr{};
-                for (int i = 0; i < m; ++i)
-                {
-                    const M128 taps = MM(loadu_ps)(winOut + i + 1);
-                    const M128 prod = MM(mul_ps)(taps, cfOut);
-                    const M128 sh1 = MM(add_ps)(prod, MM(movehl_ps)(prod, prod));
-                    const M128 sh2 = MM(add_ss)(sh1, MM(shuffle_ps)(sh1, sh1, MM_SHUFFLE(0, 0, 0, 1)));
-                    dArr[static_cast<std::size_t>(i)] = MM(cvtss_f32)(sh2);
-                }
-
-                // Compute v = x - g_out * d.
-                alignas(16) std::array<float, kChunk> vArr{};
-                const int m4 = m & ~3;
-                for (int i = 0; i < m4; i += 4)
-                {
-                    const M128 xV = MM(loadu_ps)(io + off + i);
-                    const M128 dV = MM(load_ps)(dArr.data() + i);
-                    const M128 vV = MM(sub_ps)(xV, MM(mul_ps)(vGOut, dV));
-                    MM(store_ps)(vArr.data() + i, vV);
-                }
-                for (int i = m4; i < m; ++i)
-                {
-                    vArr[static_cast<std::size_t>(i)] = io[off + i] - gOut_ * dArr[static_cast<std::size_t>(i)];
-                }
-                for (int i = 0; i < m; ++i)
-                {
-                    if (!std::isfinite(vArr[static_cast<std::size_t>(i)])) vArr[static_cast<std::size_t>(i)] = 0.0f;
-                }
-
-                // Read the inner delay taps.
+                taps.winOut = Delays::BlockTapReader::acquireWindow(ringOut_, baseOut, m + 6, tapWinOut_.data()).ptr;
                 const int baseIn = (wIn_ - iIntIn - 3) & maskIn;
-                const int winLenIn = m + 6;
-                const auto wPtrIn = Delays::BlockTapReader::acquireWindow(ringIn_, baseIn, winLenIn, tapWinIn_.data());
-                const float *winIn = wPtrIn.ptr;
-
-                alignas(16) std::array<float, kChunk> dInArr{};
-                for (int i = 0; i < m; ++i)
-                {
-                    const M128 taps = MM(loadu_ps)(winIn + i + 1);
-                    const M128 prod = MM(mul_ps)(taps, cfIn);
-                    const M128 sh1 = MM(add_ps)(prod, MM(movehl_ps)(prod, prod));
-                    const M128 sh2 = MM(add_ss)(sh1, MM(shuffle_ps)(sh1, sh1, MM_SHUFFLE(0, 0, 0, 1)));
-                    dInArr[static_cast<std::size_t>(i)] = MM(cvtss_f32)(sh2);
-                }
-
-                // Compute v_in and w.
-                alignas(16) std::array<float, kChunk> vInArr{};
-                alignas(16) std::array<float, kChunk> wArr{};
-                for (int i = 0; i < m4; i += 4)
-                {
-                    const M128 vV = MM(load_ps)(vArr.data() + i);
-                    const M128 dInV = MM(load_ps)(dInArr.data() + i);
-                    const M128 vInV = MM(sub_ps)(vV, MM(mul_ps)(vGIn, dInV));
-                    MM(store_ps)(vInArr.data() + i, vInV);
-                }
-                for (int i = m4; i < m; ++i)
-                {
-                    vInArr[static_cast<std::size_t>(i)] = vArr[static_cast<std::size_t>(i)] - gIn_ * dInArr[static_cast<std::size_t>(i)];
-                }
-                for (int i = 0; i < m; ++i)
-                {
-                    if (!std::isfinite(vInArr[static_cast<std::size_t>(i)])) vInArr[static_cast<std::size_t>(i)] = 0.0f;
-                }
-
-                for (int i = 0; i < m4; i += 4)
-                {
-                    const M128 dInV = MM(load_ps)(dInArr.data() + i);
-                    const M128 vInV = MM(load_ps)(vInArr.data() + i);
-                    const M128 wV = MM(add_ps)(dInV, MM(mul_ps)(vGIn, vInV));
-                    MM(store_ps)(wArr.data() + i, wV);
-                }
-                for (int i = m4; i < m; ++i)
-                {
-                    wArr[static_cast<std::size_t>(i)] = dInArr[static_cast<std::size_t>(i)] + gIn_ * vInArr[static_cast<std::size_t>(i)];
-                }
+                taps.winIn = Delays::BlockTapReader::acquireWindow(ringIn_, baseIn, m + 6, tapWinIn_.data()).ptr;
+
+                // v = x - g_out d, v_in = v - g_in d_in, w = d_in + g_in v_in,
+                // y = d + g_out v, with non-finite v and v_in scrubbed to 0.
+                kernels.nestedAllpass(taps, io + off, m);
 
                 // Write the inner ring.
                 ringIn_.writeBlock(vInArr.data(), wIn_, m);
@@ -230,19 +173,6 @@ namespace MarsDSP::Diffusion
                 ringOut_.writeBlock(wArr.data(), wOut_, m);
                 ringOut_.refreshMirror(wOut_, m);
                 wOut_ = (wOut_ + m) & maskOut;
-
-                // Compute y = d + g_out * v.
-                for (int i = 0; i < m4; i += 4)
-                {
-                    const M128 dV = MM(load_ps)(dArr.data() + i);
-                    const M128 vV = MM(load_ps)(vArr.data() + i);
-                    const M128 yV = MM(add_ps)(dV, MM(mul_ps)(vGOut, vV));
-                    MM(storeu_ps)(io + off + i, yV);
-                }
-                for (int i = m4; i < m; ++i)
-                {
-                    io[off + i] = dArr[static_cast<std::size_t>(i)] + gOut_ * vArr[static_cast<std::size_t>(i)];
-                }
             }
         }
 
@@ -19,8 +19,9 @@ namespace MarsDSP::Filters
     /** Output filter stage with two topologies.
      *  Digital runs a stereo-pair SIMD state-variable HPF/LPF cascade.
      *  Analog runs scalar wave-digital Sallen-Key sections with an
-     *  out-of-loop ADAA1 tanh saturator per filter output. The mode switch
-     *  is a 20 ms linear crossfade; both modes are zero latency.
+     *  out-of-loop ADAA1 tanh saturator per filter output, in double or,
+     *  at AdaaPrecision::Economy, in float. The mode switch is a 20 ms
+     *  linear crossfade; both modes are zero latency.
      */
     class OutputFilterStage
     {
@@ -119,6 +120,22 @@ namespace MarsDSP::Filters
             }
         }
 
+        /** Economy runs the analog saturators in float. A change restarts
+         *  their ADAA history.
+         */
+        void setAdaaPrecision (Nonlinear::AdaaPrecision p)
+        {
+            const bool economy = p == Nonlinear::AdaaPrecision::Economy;
+            if (economy == economy_)
+                return;
+
+            economy_ = economy;
+            adaaHpfL_.reset();
+            adaaHpfR_.reset();
+            adaaLpfL_.reset();
+            adaaLpfR_.reset();
+        }
+
         void setCutoffs (float hpfHz, float lpfHz)
         {
             hpfHz_ = hpfHz;
@@ -211,12 +228,12 @@ namespace MarsDSP::Filters
                         // High-pass filter
                         float hpOutL = skHpfL_.processSample (xL);
                         if (!std::isfinite (hpOutL)) { hpOutL = 0.0f; skHpfL_.reset(); }
-                        hpOutL = static_cast<float> (adaaHpfL_.process (static_cast<double> (hpOutL * invRail_))) * kRail_;
+                        hpOutL = adaaHpfL_.process (hpOutL, economy_);
 
                         // Low-pass filter
                         float lpOutL = skLpfL_.processSample (hpOutL);
                         if (!std::isfinite (lpOutL)) { lpOutL = 0.0f; skLpfL_.reset(); }
-                        lpOutL = static_cast<float> (adaaLpfL_.process (static_cast<double> (lpOutL * invRail_))) * kRail_;
+                        lpOutL = adaaLpfL_.process (lpOutL, economy_);
 
                         anaL = lpOutL;
 
@@ -224,11 +241,11 @@ namespace MarsDSP::Filters
                         {
                             float hpOutR = skHpfR_.processSample (xR);
                             if (!std::isfinite (hpOutR)) { hpOutR = 0.0f; skHpfR_.reset(); }
-                            hpOutR = static_cast<float> (adaaHpfR_.process (static_cast<double> (hpOutR * invRail_))) * kRail_;
+                            hpOutR = adaaHpfR_.process (hpOutR, economy_);
 
                             float lpOutR = skLpfR_.processSample (hpOutR);
                             if (!std::isfinite (lpOutR)) { lpOutR = 0.0f; skLpfR_.reset(); }
-                            lpOutR = static_cast<float> (adaaLpfR_.process (static_cast<double> (lpOutR * invRail_))) * kRail_;
+                            lpOutR = adaaLpfR_.process (lpOutR, economy_);
 
                             anaR = lpOutR;
                         }
@@ -288,10 +305,31 @@ namespace MarsDSP::Filters
         SallenKeyLPF skLpfL_ {};
         SallenKeyLPF skLpfR_ {};
 
-        Nonlinear::ADAA1<Nonlinear::TanhNL> adaaHpfL_ {};
-        Nonlinear::ADAA1<Nonlinear::TanhNL> adaaHpfR_ {};
-        Nonlinear::ADAA1<Nonlinear::TanhNL> adaaLpfL_ {};
-        Nonlinear::ADAA1<Nonlinear::TanhNL> adaaLpfR_ {};
+        // tanh on the +-kRail_ rail, ADAA1 in the selected precision.
+        struct RailSaturator
+        {
+            Nonlinear::ADAA1<Nonlinear::TanhNL> standard {};
+            Nonlinear::ADAA1<Nonlinear::TanhNLEconomy> economy {};
+
+            void reset() noexcept
+            {
+                standard.reset();
+                economy.reset();
+            }
+
+            float process (float x, bool useEconomy) noexcept
+            {
+                if (useEconomy)
+                    return economy.process (x * invRail_) * kRail_;
+                return static_cast<float> (standard.process (static_cast<double> (x * invRail_))) * kRail_;
+            }
+        };
+
+        RailSaturator adaaHpfL_ {};
+        RailSaturator adaaHpfR_ {};
+        RailSaturator adaaLpfL_ {};
+        RailSaturator adaaLpfR_ {};
+        bool economy_ { false };
 
         Mode currentMode_ { Mode::Digital };
         Mode targetMode_ { Mode::Digital };
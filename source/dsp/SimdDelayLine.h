@@ -8,6 +8,7 @@
 #include "OnePoleSmoother.h"
 #include "Pow2RingBuffer.h"
 #include "simd/Config.h"
+#include "simd/Kernels.h"
 #include "utils/memory/BumpArena.h"
 
 #include <algorithm>
@@ -159,6 +160,8 @@ namespace MarsDSP::Delays
 
             const bool hasR = (wetR != nullptr);
 
+            [[maybe_unused]] const Simd::KernelTable& kernels = Simd::kernels();
+
             // ---- sub-block read loop ----
             int sampleOffset = 0;
             while (sampleOffset < n)
@@ -182,49 +185,35 @@ namespace MarsDSP::Delays
 
                 const int winLen = subN + kTail;
 
-                const auto wOldL = BlockTapReader::acquireWindow(bufL_, bOld, winLen, scratchOldL_.data());
-                const auto wNewL = BlockTapReader::acquireWindow(bufL_, bNew, winLen, scratchNewL_.data());
-                const float* oldL = wOldL.ptr;
-                const float* newL = wNewL.ptr;
-                const bool  oldLAligned = wOldL.aligned;
-                const bool  newLAligned = wNewL.aligned;
+                const float* oldL = BlockTapReader::acquireWindow(bufL_, bOld, winLen, scratchOldL_.data()).ptr;
+                const float* newL = BlockTapReader::acquireWindow(bufL_, bNew, winLen, scratchNewL_.data()).ptr;
 
                 const float* oldR = nullptr;
                 const float* newR = nullptr;
-                bool oldRAligned = false;
-                bool newRAligned = false;
                 if (hasR)
                 {
-                    const auto wOldR = BlockTapReader::acquireWindow(bufR_, bOld, winLen, scratchOldR_.data());
-                    const auto wNewR = BlockTapReader::acquireWindow(bufR_, bNew, winLen, scratchNewR_.data());
-                    oldR = wOldR.ptr;  newR = wNewR.ptr;
-                    oldRAligned = wOldR.aligned; newRAligned = wNewR.aligned;
+                    oldR = BlockTapReader::acquireWindow(bufR_, bOld, winLen, scratchOldR_.data()).ptr;
+                    newR = BlockTapReader::acquireWindow(bufR_, bNew, winLen, scratchNewR_.data()).ptr;
                 }
 
                 const float invSubN = 1.0f / static_cast<float>(subN);
 
                 if constexpr (UseSimd)
                 {
-                    const std::array<M128, 6> cbOld{{
-                        MM(set1_ps)(cOld.c[0]), MM(set1_ps)(cOld.c[1]), MM(set1_ps)(cOld.c[2]),
-                        MM(set1_ps)(cOld.c[3]), MM(set1_ps)(cOld.c[4]), MM(set1_ps)(cOld.c[5])
-                    }};
-                    const std::array<M128, 6> cbNew{{
-                        MM(set1_ps)(cNew.c[0]), MM(set1_ps)(cNew.c[1]), MM(set1_ps)(cNew.c[2]),
-                        MM(set1_ps)(cNew.c[3]), MM(set1_ps)(cNew.c[4]), MM(set1_ps)(cNew.c[5])
-                    }};
-                    const M128 laneOff = MM(mul_ps)(MM(set_ps)(3.0f, 2.0f, 1.0f, 0.0f), MM(set1_ps)(invSubN));
-
+                    // Blend position per sample, formed as lane offset plus
+                    // 4-sample group base (the 4-wide laneOff + j0 form) so
+                    // it does not depend on the dispatched width.
+                    alignas(16) std::array<float, kSubBlock> alphaRamp{};
                     const int jFull = subN & ~3; // largest multiple of 4 ≤ subN
-                    for (int j0 = 0; j0 + 4 <= subN; j0 += 4)
-                    {
-                        const M128 vAlpha = MM(add_ps)(laneOff, MM(set1_ps)(static_cast<float>(j0) * invSubN));
-                        BlockTapReader::eval4(oldL + j0, oldLAligned, newL + j0, newLAligned,
-                                              cbOld, cbNew, vAlpha, wetL + sampleOffset + j0);
-                        if (hasR)
-                            BlockTapReader::eval4(oldR + j0, oldRAligned, newR + j0, newRAligned,
-                                                  cbOld, cbNew, vAlpha, wetR + sampleOffset + j0);
-                    }
+                    for (int j = 0; j < jFull; ++j)
+                        alphaRamp[static_cast<std::size_t>(j)] = static_cast<float>(j & 3) * invSubN
+                                                               + static_cast<float>(j & ~3) * invSubN;
+
+                    BlockTapReader::evalBlock(kernels, oldL, newL, cOld, cNew, alphaRamp.data(),
+                                              wetL + sampleOffset, jFull);
+                    if (hasR)
+                        BlockTapReader::evalBlock(kernels, oldR, newR, cOld, cNew, alphaRamp.data(),
+                                                  wetR + sampleOffset, jFull);
                     // ---- scalar tail for the 0..3 remaining samples ----
                     for (int j = jFull; j < subN; ++j)
                     {
@@ -4,12 +4,14 @@
 #define CHRONOS_SVF_H
 
 #include <array>
+#include <cassert>
 #include <cmath>
 #include <limits>
 #include <numbers>
 #include <algorithm>
 #include "simd/Config.h"
 #include "math/Trigonometry.h"
+#include "simd/Kernels.h"
 
 namespace MarsDSP::Filters::detail {
     inline double mmTanScalar(const double x) noexcept {
@@ -198,6 +200,8 @@ namespace MarsDSP::Filters {
         }
 
     private:
+        friend class SimdSVFLanes;
+
         // Lanes holding NaN (unordered) or ±inf, as an all-ones mask.
         static M128 nonFiniteMask(const M128 x) noexcept
         {
@@ -303,5 +307,82 @@ namespace MarsDSP::Filters {
         M128 dm1{MM(setzero_ps)()};
         M128 dm2{MM(setzero_ps)()};
     };
+
+    /// SimdSVF over up to 16 independent lanes, one signal per lane, in the
+    /// SoA layout of Simd::SvfLanes. Coefficients and per-block ramps are
+    /// SimdSVF's; the per-sample step runs as a two-filter cascade on the
+    /// dispatched tier, so 8 lanes take one AVX2 register instead of two.
+    /// A non-finite lane clears only its own state.
+    class SimdSVFLanes {
+    public:
+        static constexpr int kMaxLanes = Simd::SvfLanes::kMaxLanes;
+
+        void reset() noexcept
+        {
+            s_ = {};
+            snapLane_ = {};
+            firstBlock = true;
+        }
+
+        /// Clears one lane's state; its coefficients snap on the next block.
+        void resetLane(const int lane) noexcept
+        {
+            assert(lane >= 0 && lane < kMaxLanes);
+            const auto u = static_cast<std::size_t>(lane);
+            s_.ic1[u] = 0.0f;
+            s_.ic2[u] = 0.0f;
+            snapLane_[u] = 1.0f;
+        }
+
+        /// angles holds pi * f / fs per lane, clamped by the caller; lanes is a multiple of 4.
+        void setCoeffForBlock(const SimdSVF::SVFType type, const float *angles, const int lanes,
+                              const double Q, const double gainDB, const int numSamples) noexcept
+        {
+            const M128 obs = MM(set1_ps)(1.0f / static_cast<float>(numSamples));
+            for (int l = 0; l < lanes; l += 4)
+            {
+                SimdSVF target;
+                target.setCoeff(type, MM(loadu_ps)(angles + l), Q, gainDB);
+                ramp_(s_.a1, s_.da1, target.a1, l, obs);
+                ramp_(s_.a2, s_.da2, target.a2, l, obs);
+                ramp_(s_.a3, s_.da3, target.a3, l, obs);
+                ramp_(s_.m0, s_.dm0, target.m0, l, obs);
+                ramp_(s_.m1, s_.dm1, target.m1, l, obs);
+                ramp_(s_.m2, s_.dm2, target.m2, l, obs);
+            }
+            snapLane_ = {};
+            firstBlock = false;
+        }
+
+        /// Run first then second on every lane of io (sample-major, stride lanes).
+        static void processCascade(const Simd::KernelTable &k, SimdSVFLanes &first, SimdSVFLanes &second,
+                                   float *io, const int lanes, const int numSamples) noexcept
+        {
+            k.svfCascade(first.s_, second.s_, io, lanes, numSamples);
+        }
+
+    private:
+        // As SimdSVF::setCoeffForBlock: snap on the first block, or on a lane
+        // cleared by resetLane, else ramp from the current coefficient to
+        // target over the block.
+        void ramp_(Simd::SvfLanes::Row &coeff, Simd::SvfLanes::Row &delta, const M128 target,
+                   const int l, const M128 obs) const noexcept
+        {
+            if (firstBlock)
+            {
+                MM(storeu_ps)(coeff.data() + l, target);
+                MM(storeu_ps)(delta.data() + l, MM(setzero_ps)());
+                return;
+            }
+            const M128 snap = MM(cmpgt_ps)(MM(loadu_ps)(snapLane_.data() + l), MM(setzero_ps)());
+            const M128 prior = MM(loadu_ps)(coeff.data() + l);
+            MM(storeu_ps)(coeff.data() + l, MM(or_ps)(MM(and_ps)(snap, target), MM(andnot_ps)(snap, prior)));
+            MM(storeu_ps)(delta.data() + l, MM(andnot_ps)(snap, MM(mul_ps)(MM(sub_ps)(target, prior), obs)));
+        }
+
+        Simd::SvfLanes s_{};
+        Simd::SvfLanes::Row snapLane_{};
+        bool firstBlock{true};
+    };
 }
 #endif
@@ -48,6 +48,11 @@ namespace MarsDSP::Align {
                     (w_ - 1 - j + kHalfSampleTaps) & kMask)] +
                         z_[static_cast<std::size_t>((w_ + j) & kMask)];
 
+            return dot(pairs);
+        }
+
+        /// Folded taps times the coefficients, summed.
+        static float dot(const std::array<float, 8> &pairs) noexcept {
             const M128 vPairs0 = MM(loadu_ps)(pairs.data());
             const M128 vCoeff0 = MM(loadu_ps)(kHalfSampleCoeffs.data());
             M128 vAcc = FMADD(vCoeff0, vPairs0, MM(setzero_ps)());
@@ -68,5 +73,70 @@ namespace MarsDSP::Align {
         std::array<float, kHalfSampleTaps> z_{};
         int w_{0};
     };
+
+    /// HalfSampleFir on interleaved L/R. Each channel's taps are summed in
+    /// the same order as HalfSampleFir, so each matches it bit for bit.
+    /// The one-argument process() runs the left channel alone, for mono.
+    class StereoHalfSampleFir {
+    public:
+        static constexpr double kBulkDelay = HalfSampleFir::kBulkDelay;
+        static constexpr int kMask = HalfSampleFir::kMask;
+
+        void reset() noexcept { z_.fill(0.0f); w_ = 0; }
+
+        void process(float &l, float &r) noexcept {
+            z_[static_cast<std::size_t>(2 * w_)] = l;
+            z_[static_cast<std::size_t>(2 * w_ + 1)] = r;
+            w_ = (w_ + 1) & kMask;
+
+            // Folded taps, interleaved: [L0, R0, L1, R1, ...].
+            alignas(16) std::array<float, 16> pairs{};
+            for (int j = 0; j < 8; ++j)
+            {
+                const auto a = static_cast<std::size_t>(2 * ((w_ - 1 - j + kHalfSampleTaps) & kMask));
+                const auto b = static_cast<std::size_t>(2 * ((w_ + j) & kMask));
+                pairs[static_cast<std::size_t>(2 * j)] = z_[a] + z_[b];
+                pairs[static_cast<std::size_t>(2 * j + 1)] = z_[a + 1] + z_[b + 1];
+            }
+
+            // Lane k of HalfSampleFir's accumulator is c[k]p[k] + c[k+4]p[k+4].
+            // Here accLo holds k = 0, 1 and accHi k = 2, 3, for both channels.
+            const auto coeffs = [](int k) {
+                const float c0 = kHalfSampleCoeffs[static_cast<std::size_t>(k)];
+                const float c1 = kHalfSampleCoeffs[static_cast<std::size_t>(k + 1)];
+                return MM(setr_ps)(c0, c0, c1, c1);
+            };
+            const M128 p0 = MM(load_ps)(pairs.data());
+            const M128 p1 = MM(load_ps)(pairs.data() + 4);
+            const M128 p2 = MM(load_ps)(pairs.data() + 8);
+            const M128 p3 = MM(load_ps)(pairs.data() + 12);
+            const M128 accLo = FMADD(coeffs(4), p2, FMADD(coeffs(0), p0, MM(setzero_ps)()));
+            const M128 accHi = FMADD(coeffs(6), p3, FMADD(coeffs(2), p1, MM(setzero_ps)()));
+
+            const M128 vSum0 = MM(add_ps)(accLo, accHi);            // [a0+a2 (L, R), a1+a3 (L, R)]
+            const M128 vSum1 = MM(add_ps)(vSum0, MM(movehl_ps)(vSum0, vSum0));
+
+            alignas(16) std::array<float, 4> out{};
+            MM(store_ps)(out.data(), vSum1);
+            l = out[0];
+            r = out[1];
+        }
+
+        float process(const float x) noexcept {
+            z_[static_cast<std::size_t>(2 * w_)] = x;
+            w_ = (w_ + 1) & kMask;
+
+            alignas(16) std::array<float, 8> pairs{};
+            for (int j = 0; j < 8; ++j)
+                pairs[static_cast<std::size_t>(j)] =
+                        z_[static_cast<std::size_t>(2 * ((w_ - 1 - j + kHalfSampleTaps) & kMask))]
+                        + z_[static_cast<std::size_t>(2 * ((w_ + j) & kMask))];
+            return HalfSampleFir::dot(pairs);
+        }
+
+    private:
+        std::array<float, 2 * kHalfSampleTaps> z_{};
+        int w_{0};
+    };
 }
 #endif
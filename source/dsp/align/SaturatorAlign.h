@@ -14,6 +14,10 @@ namespace MarsDSP::Align {
     public:
         static constexpr int kBudget = kHalfSampleTaps / 2;
         static_assert(kBudget >= 2, "kBudget must be >= 2 so ADAA2's integer delay (kBudget-1) stays >= 1");
+        // Oversampled saturator: it brings its own latency, at least kBudget,
+        // so the wet path passes straight through and the caller extends
+        // the dry path by the rest.
+        static constexpr int kOversampled = 3;
 
         SaturatorAlign() noexcept { reset(); }
 
@@ -25,8 +29,15 @@ namespace MarsDSP::Align {
             setMode(mode_);
         }
 
+        // Clear the wet path only. The dry line keeps its history.
+        void resetWet() noexcept {
+            wetInt_.reset();
+            wetFir_.reset();
+            setMode(mode_);
+        }
+
         void setMode(int adaaOrder) noexcept {
-            assert(adaaOrder >= 0 && adaaOrder <= 2);
+            assert((adaaOrder >= 0 && adaaOrder <= 2) || adaaOrder == kOversampled);
             mode_ = adaaOrder;
             switch (mode_)
             {
@@ -36,6 +47,8 @@ namespace MarsDSP::Align {
                     break;
                 case 2: wetInt_.setDelay(kBudget - 1);
                     break;
+                case kOversampled: wetInt_.setDelay(0);
+                    break;
             }
         }
 
@@ -55,5 +68,76 @@ namespace MarsDSP::Align {
         HalfSampleFir wetFir_;
         int mode_{2};
     };
+
+    /// SaturatorAlign on interleaved L/R, bit-identical to a pair of
+    /// SaturatorAligns. The one-argument forms run the left channel
+    /// alone, for mono.
+    class StereoSaturatorAlign {
+    public:
+        static constexpr int kBudget = SaturatorAlign::kBudget;
+        static constexpr int kOversampled = SaturatorAlign::kOversampled;
+
+        StereoSaturatorAlign() noexcept { reset(); }
+
+        void reset() noexcept {
+            dry_.reset();
+            dry_.setDelay(kBudget);
+            wetInt_.reset();
+            wetFir_.reset();
+            setMode(mode_);
+        }
+
+        // Clear the wet path only. The dry line keeps its history.
+        void resetWet() noexcept {
+            wetInt_.reset();
+            wetFir_.reset();
+            setMode(mode_);
+        }
+
+        void setMode(int adaaOrder) noexcept {
+            assert((adaaOrder >= 0 && adaaOrder <= 2) || adaaOrder == kOversampled);
+            mode_ = adaaOrder;
+            switch (mode_)
+            {
+                case 0: wetInt_.setDelay(kBudget);
+                    break;
+                case 1: wetInt_.setDelay(0);
+                    break;
+                case 2: wetInt_.setDelay(kBudget - 1);
+                    break;
+                case kOversampled: wetInt_.setDelay(0);
+                    break;
+            }
+        }
+
+        void processDry(float &l, float &r) noexcept {
+            l = SaturatorAlign::scrub(l);
+            r = SaturatorAlign::scrub(r);
+            dry_.process(l, r);
+        }
+
+        void processWet(float &l, float &r) noexcept {
+            l = SaturatorAlign::scrub(l);
+            r = SaturatorAlign::scrub(r);
+            wetInt_.process(l, r);
+            if (mode_ == 1)
+                wetFir_.process(l, r);
+        }
+
+        float processDry(const float x) noexcept { return dry_.process(SaturatorAlign::scrub(x)); }
+
+        float processWet(const float x) noexcept {
+            const float w = wetInt_.process(SaturatorAlign::scrub(x));
+            if (mode_ == 1)
+                return wetFir_.process(w);
+            return w;
+        }
+
+    private:
+        StereoShortDelay<kBudget> dry_;
+        StereoShortDelay<kBudget> wetInt_;
+        StereoHalfSampleFir wetFir_;
+        int mode_{2};
+    };
 }
 #endif
@@ -42,5 +42,57 @@ namespace MarsDSP::Align {
         int w_{0};
         int d_{0};
     };
+
+    /// ShortDelay on interleaved L/R: one index update per stereo sample.
+    /// The one-argument process() runs the left channel alone, for mono.
+    template <int MaxDelay>
+    class StereoShortDelay {
+    public:
+        static constexpr int kCapacity = ShortDelay<MaxDelay>::kCapacity;
+        static constexpr int kMask = kCapacity - 1;
+
+        void reset() noexcept
+        {
+            z_.fill(0.0f);
+            w_ = 0;
+            d_ = 0;
+        }
+
+        void setDelay(int d) noexcept
+        {
+            assert(d >= 0 && d <= MaxDelay);
+            d_ = d;
+        }
+
+        void process(float &l, float &r) noexcept
+        {
+            if (d_ == 0) return;
+
+            const auto rd = static_cast<std::size_t>(2 * ((w_ - d_ + kCapacity) & kMask));
+            const auto wr = static_cast<std::size_t>(2 * w_);
+            const float yl = z_[rd];
+            const float yr = z_[rd + 1];
+            z_[wr] = l;
+            z_[wr + 1] = r;
+            w_ = (w_ + 1) & kMask;
+            l = yl;
+            r = yr;
+        }
+
+        float process(const float x) noexcept
+        {
+            if (d_ == 0) return x;
+
+            const float y = z_[static_cast<std::size_t>(2 * ((w_ - d_ + kCapacity) & kMask))];
+            z_[static_cast<std::size_t>(2 * w_)] = x;
+            w_ = (w_ + 1) & kMask;
+            return y;
+        }
+
+    private:
+        std::array<float, 2 * kCapacity> z_ {};
+        int w_{0};
+        int d_{0};
+    };
 }
 #endif
@@ -14,14 +14,56 @@
 
 namespace MarsDSP::BBD
 {
+    /// Stage counts of the Panasonic parts, indexed by
+    /// FeedbackDelay::Params::bbdChip: MN3005, MN3008, MN3207, MN3204.
+    inline constexpr std::array<int, 4> kChipStages { 4096, 2048, 1024, 512 };
+
+    template <int Stages>
+    class StereoBrigadeLine;
+
     /** Clocked bucket-brigade delay line.
      *  The analog pole banks run at the audio rate. A shift register of
-     *  kStages buckets moves the charge in a two-phase event loop.
+     *  Stages buckets moves the charge in a two-phase event loop. The
+     *  delay is 2 Stages clock periods, so a shorter chip reaches a delay
+     *  at a lower clock, with fewer events per sample and less storage.
+     *
+     *  Each bank's events are one clock period apart, so its pole rotation
+     *  is evaluated exactly at its first event in a sample and advanced by
+     *  the set_delta step after that. Drift therefore never outlives one
+     *  audio sample. A new clock only recomputes that step once it moves by
+     *  more than kRetuneTolerance from the clock the step was taken for.
+     *
+     *  Bounded-cost mode caps the event rate at kBoundedEventRatio events per
+     *  audio sample. Above that rate, each run of stride consecutive events
+     *  per bank collapses into one, with stride a power of two. The rotation
+     *  steps over the whole run at once (pole_corr^(stride delta)). The
+     *  run's one charge fills all stride buckets it spans. Only the schedule
+     *  coarsens: the bucket count and the delay stay as they are.
+     *
+     *  readAhead and writeAhead split a run of samples into its output
+     *  half and its input half. The input events of a sample need the
+     *  sample written before it, but the output events only pop buckets
+     *  filled a whole line earlier. So a caller with a feedback path can
+     *  take a run of taps, process them as a block, and write them back
+     *  one by one. The event times and rotations are the ones process
+     *  would use, so the result is bit-identical.
      */
+    template <int Stages = 4096>
     class BrigadeLine
     {
     public:
-        static constexpr int kStages = 4096;
+        static_assert (Stages >= 16, "a BBD line needs at least 16 stages");
+        static constexpr int kStages = Stages;
+
+        /// Bounded-cost mode: at most this many events per audio sample.
+        static constexpr float kBoundedEventRatio = 8.0f;
+
+        /// Relative clock change below which setClockHz keeps the rotation
+        /// step. The event times always follow the new clock.
+        static constexpr float kRetuneTolerance = 1.0e-5f;
+
+        /// Longest run one readAhead takes.
+        static constexpr int kMaxAhead = 64;
 
         static constexpr std::size_t bbdStorageFloats (int numChannels) noexcept
         {
@@ -41,7 +83,10 @@ namespace MarsDSP::BBD
 
             inputBank_ = InputPoleBank (Ts_);
             outputBank_ = OutputPoleBank (Ts_);
+            inputCutoffHz_ = kInputCutoffHz;
+            outputCutoffHz_ = kOutputCutoffHz;
             H0_ = outputBank_.calcH0();
+            stepClockHz_ = 0.0f;
 
             storage_ = storage;
             setDelaySeconds (0.375f);
@@ -66,28 +111,36 @@ namespace MarsDSP::BBD
             inputBank_.reset();
             outputBank_.reset();
             H0_ = outputBank_.calcH0();
+            stepClockHz_ = 0.0f; // the next setClockHz takes an exact step
+
+            // Samples read ahead keep their writes, but their input events
+            // belonged to the old state.
+            for (int k = aheadNext_; k < aheadCount_; ++k)
+                ahead_[static_cast<std::size_t> (k)] = {};
+            popPtr_ = bufferPtr_;
         }
 
         void setInputFilterFreq (float freqHz = kInputCutoffHz) noexcept
         {
+            inputCutoffHz_ = freqHz;
             inputBank_.set_freq (freqHz);
             inputBank_.set_time (tn_);
+            retune_();
         }
 
         void setOutputFilterFreq (float freqHz = kOutputCutoffHz) noexcept
         {
+            outputCutoffHz_ = freqHz;
             outputBank_.set_freq (freqHz);
             outputBank_.set_time (tn_);
+            retune_();
             H0_ = outputBank_.calcH0();
         }
 
         void setClockHz (float clkHz) noexcept
         {
-            const float clkClamped = std::clamp (clkHz, kMinClockHz_, kMaxClockHz_);
-            Ts_bbd_ = 1.0f / clkClamped;
-            const float deltaNorm = 2.0f * Ts_bbd_ * fs_;
-            inputBank_.set_delta (deltaNorm);
-            outputBank_.set_delta (deltaNorm);
+            if (applyClock_ (clkHz))
+                retune_();
         }
 
         void setDelaySeconds (float delaySec) noexcept
@@ -97,6 +150,19 @@ namespace MarsDSP::BBD
             setClockHz (clockRateHz);
         }
 
+        /// Off evaluates every event's rotation with std::pow, as a reference.
+        void setIncrementalPoles (bool on) noexcept { incrementalPoles_ = on; }
+
+        /// Caps the event rate at kBoundedEventRatio per sample. Off by default.
+        void setBoundedCost (bool on) noexcept
+        {
+            boundedCost_ = on;
+            setClockHz (getClockHz());
+        }
+
+        /// Events folded into one; 1 unless bounded-cost mode is on.
+        [[nodiscard]] int getStride() const noexcept { return stride_; }
+
         [[nodiscard]] float getClockHz() const noexcept
         {
             return Ts_bbd_ > 0.0f ? (1.0f / Ts_bbd_) : kMinClockHz_;
@@ -116,15 +182,12 @@ namespace MarsDSP::BBD
             if (storage_ == nullptr)
                 return 0.0f;
 
-            inputBank_.set_time (tn_);
-            outputBank_.set_time (tn_);
-
-            std::array<std::complex<float>, 4> xOutAccum {};
-            float yBBD = 0.0f;
-            float delta = 0.0f;
+            PoleVec xOutAccum {};
             int iterations = 0;
+            bool inFresh = true;
+            bool outFresh = true;
 
-            const float stepNorm = Ts_bbd_ * fs_;
+            const float stepNorm = Ts_bbd_ * fs_ * static_cast<float> (stride_);
             while (tn_ < 1.0f)
             {
                 if (++iterations > 10000)
@@ -132,30 +195,14 @@ namespace MarsDSP::BBD
 
                 if (evenOn_)
                 {
-                    inputBank_.calcG (tn_);
-                    float val = 0.0f;
-                    for (int m = 0; m < 4; ++m)
-                    {
-                        const auto term = inputBank_.Gcalc[static_cast<std::size_t>(m)] * inputBank_.x[static_cast<std::size_t>(m)]
-                                        + ((inputBank_.Gcalc[static_cast<std::size_t>(m)] - inputBank_.getG0(m)) / inputBank_.getPole(m)) * lastIn_;
-                        val += term.real();
-                    }
-
-                    if (!std::isfinite (val))
-                        val = 0.0f;
-
-                    storage_[bufferPtr_++] = val;
-                    if (bufferPtr_ >= kStages)
-                        bufferPtr_ = 0;
+                    rotate_ (inputBank_, inFresh, tn_);
+                    pushBucket_ (inputBank_.bucketCharge (lastIn_), stride_);
                 }
                 else
                 {
-                    yBBD = storage_[bufferPtr_];
-                    delta = yBBD - yBBD_old_;
-                    yBBD_old_ = yBBD;
-                    outputBank_.calcG (tn_);
-                    for (int m = 0; m < 4; ++m)
-                        xOutAccum[m] += outputBank_.Gcalc[m] * delta;
+                    const float delta = popDelta_ (bufferPtr_);
+                    rotate_ (outputBank_, outFresh, tn_);
+                    outputBank_.accumulate (xOutAccum, delta);
                 }
 
                 evenOn_ = !evenOn_;
@@ -163,19 +210,7 @@ namespace MarsDSP::BBD
             }
             tn_ -= 1.0f;
 
-            outputBank_.process (xOutAccum);
-
-            float sumOut = 0.0f;
-            for (int m = 0; m < 4; ++m)
-                sumOut += outputBank_.x[m].real();
-
-            const float out = H0_ * yBBD_old_ + sumOut;
-            if (!std::isfinite (out))
-            {
-                reset();
-                return 0.0f;
-            }
-            return out;
+            return finishTap_ (xOutAccum);
         }
 
         /// Push one sample into the input bank.
@@ -195,16 +230,286 @@ namespace MarsDSP::BBD
             return out;
         }
 
+        /// n samples, each at its own clock: setClockHz and process per
+        /// sample, without a call per sample at the caller.
+        void processBlock (const float* in, const float* clockHz, float* out, int n) noexcept
+        {
+            for (int i = 0; i < n; ++i)
+            {
+                setClockHz (clockHz[i]);
+                out[i] = process (in[i]);
+            }
+        }
+
+        /** Output half of up to n samples, sample i at clockHz[i]. Every
+         *  tap must be followed, in order, by one writeAhead with the
+         *  sample that goes in after it. The run stays shorter than the
+         *  line's delay (aheadLimit), so no pending write reaches a bucket
+         *  the run pops. Returns the number of taps, at least one. Call it
+         *  only once the previous run is written, and leave the clock and
+         *  filters alone until then.
+         */
+        int readAhead (const float* clockHz, float* out, int n) noexcept
+        {
+            n = aheadLimit (clockHz, n);
+            beginAhead_();
+            for (int i = 0; i < n; ++i)
+                out[i] = readAheadTap_ (clockHz[i]);
+            return n;
+        }
+
+        /// Input half of the oldest sample read ahead, then u.
+        inline void writeAhead (float u) noexcept
+        {
+            if (aheadNext_ < aheadCount_)
+            {
+                inputEvents_ (ahead_[static_cast<std::size_t> (aheadNext_++)]);
+            }
+            writeSample (u);
+        }
+
+        /// Samples of clockHz that one readAhead takes: at most kMaxAhead,
+        /// and no more buckets filled than the line has stages. At least one.
+        [[nodiscard]] int aheadLimit (const float* clockHz, int n) const noexcept
+        {
+            n = std::min (n, kMaxAhead);
+            int slots = 0;
+            for (int i = 0; i < n; ++i)
+            {
+                slots += slotsFor_ (clockHz[i]);
+                if (slots >= kStages)
+                    return std::max (i, 1);
+            }
+            return n;
+        }
+
     private:
+        template <int>
+        friend class StereoBrigadeLine;
+
+        // What the deferred input half of a sample read ahead needs: its
+        // pushes, the time of the first one and a pending retune. An empty
+        // one means its input events already ran, or a reset dropped them.
+        struct AheadStep
+        {
+            float step { 0.0f };    // event spacing in samples, stride included
+            float firstTn { 0.0f }; // time of the first push
+            float delta { 0.0f };   // the input bank's set_delta, 0 if no retune
+            int stride { 1 };
+            int pushes { 0 };
+
+            bool operator== (const AheadStep&) const = default;
+        };
+
+        // The bank's rotation at tn: exact on its first event of the
+        // sample (fresh), stepped by Aplus after that.
+        template <class Bank>
+        void rotate_ (Bank& bank, bool& fresh, float tn) noexcept
+        {
+            if (fresh || !incrementalPoles_)
+                bank.calcG (tn);
+            else
+                bank.advanceG();
+            fresh = false;
+        }
+
+        // Event period and stride for clkHz. True when the rotation step
+        // is due for a retune.
+        bool applyClock_ (float clkHz) noexcept
+        {
+            const float clkClamped = std::clamp (clkHz, kMinClockHz_, kMaxClockHz_);
+            Ts_bbd_ = 1.0f / clkClamped;
+            const int stride = boundedCost_ ? strideFor_ (clkClamped) : 1;
+            if (stride != stride_ || std::abs (clkClamped - stepClockHz_) > kRetuneTolerance * stepClockHz_)
+            {
+                stride_ = stride;
+                return true;
+            }
+            return false;
+        }
+
+        [[nodiscard]] float deltaNorm_() const noexcept
+        {
+            return 2.0f * Ts_bbd_ * fs_ * static_cast<float> (stride_);
+        }
+
+        // Both banks' rotation step for the current clock and stride.
+        void retune_() noexcept
+        {
+            stepClockHz_ = getClockHz();
+            const float deltaNorm = deltaNorm_();
+            inputBank_.set_delta (deltaNorm);
+            outputBank_.set_delta (deltaNorm);
+        }
+
+        // Upper bound on the buckets one sample at clkHz fills: at most
+        // 1/step + 1 events, half of them pushes of stride buckets each.
+        [[nodiscard]] int slotsFor_ (float clkHz) const noexcept
+        {
+            const float clkClamped = std::clamp (clkHz, kMinClockHz_, kMaxClockHz_);
+            const int stride = boundedCost_ ? strideFor_ (clkClamped) : 1;
+            const float step = (1.0f / clkClamped) * fs_ * static_cast<float> (stride);
+            return (static_cast<int> (1.0f / step) / 2 + 2) * stride;
+        }
+
+        // A run's first sample can fill the whole line on its own only on
+        // a very short chip; that one runs its input events right away.
+        [[nodiscard]] bool readsInPlace_ (float clkHz) const noexcept
+        {
+            return aheadCount_ == 0 && slotsFor_ (clkHz) >= kStages;
+        }
+
+        void beginAhead_() noexcept
+        {
+            assert (aheadNext_ == aheadCount_);
+            aheadCount_ = 0;
+            aheadNext_ = 0;
+            popPtr_ = bufferPtr_;
+        }
+
+        // One sample's output events. The pushes only move the read
+        // pointer; writeAhead fills the buckets later.
+        float readAheadTap_ (float clkHz) noexcept
+        {
+            if (storage_ == nullptr || readsInPlace_ (clkHz))
+            {
+                ahead_[static_cast<std::size_t> (aheadCount_++)] = {};
+                setClockHz (clkHz);
+                const float out = readTap();
+                popPtr_ = bufferPtr_;
+                return out;
+            }
+
+            AheadStep& step = ahead_[static_cast<std::size_t> (aheadCount_++)];
+            step.delta = 0.0f;
+            if (applyClock_ (clkHz))
+            {
+                stepClockHz_ = getClockHz();
+                step.delta = deltaNorm_();
+                outputBank_.set_delta (step.delta);
+            }
+            step.stride = stride_;
+            step.step = Ts_bbd_ * fs_ * static_cast<float> (stride_);
+            step.pushes = 0;
+
+            PoleVec xOutAccum {};
+            int iterations = 0;
+            bool outFresh = true;
+            while (tn_ < 1.0f)
+            {
+                if (++iterations > 10000)
+                    break;
+
+                if (evenOn_)
+                {
+                    if (step.pushes++ == 0)
+                        step.firstTn = tn_;
+                    skipPush_ (step.stride);
+                }
+                else
+                {
+                    const float delta = popDelta_ (popPtr_);
+                    rotate_ (outputBank_, outFresh, tn_);
+                    outputBank_.accumulate (xOutAccum, delta);
+                }
+
+                evenOn_ = !evenOn_;
+                tn_ += step.step;
+            }
+            tn_ -= 1.0f;
+
+            return finishTap_ (xOutAccum);
+        }
+
+        // The pushes readAheadTap_ left for one sample. Push times are two
+        // steps apart, added one step at a time as the event walk does.
+        void inputEvents_ (const AheadStep& step) noexcept
+        {
+            if (step.delta > 0.0f)
+                inputBank_.set_delta (step.delta);
+
+            bool inFresh = true;
+            float tn = step.firstTn;
+            for (int k = 0; k < step.pushes; ++k)
+            {
+                rotate_ (inputBank_, inFresh, tn);
+                pushBucket_ (inputBank_.bucketCharge (lastIn_), step.stride);
+                tn += step.step;
+                tn += step.step;
+            }
+        }
+
+        void skipPush_ (int stride) noexcept
+        {
+            popPtr_ += stride;
+            if (popPtr_ >= kStages)
+                popPtr_ -= kStages;
+        }
+
+        // Powers of two up to the one that brings the clock under
+        // kBoundedEventRatio * fs.
+        [[nodiscard]] int strideFor_ (float clkHz) const noexcept
+        {
+            int stride = 1;
+            while (stride < kStages && clkHz > kBoundedEventRatio * fs_ * static_cast<float> (stride))
+                stride *= 2;
+            return stride;
+        }
+
+        void pushBucket_ (float val, int stride) noexcept
+        {
+            if (!std::isfinite (val))
+                val = 0.0f;
+
+            if (stride == 1)
+            {
+                storage_[bufferPtr_++] = val;
+                if (bufferPtr_ >= kStages)
+                    bufferPtr_ = 0;
+                return;
+            }
+
+            for (int i = 0; i < stride; ++i)
+            {
+                storage_[bufferPtr_++] = val;
+                if (bufferPtr_ >= kStages)
+                    bufferPtr_ = 0;
+            }
+        }
+
+        float popDelta_ (int ptr) noexcept
+        {
+            const float yBBD = storage_[ptr];
+            const float delta = yBBD - yBBD_old_;
+            yBBD_old_ = yBBD;
+            return delta;
+        }
+
+        float finishTap_ (const PoleVec& xOutAccum) noexcept
+        {
+            outputBank_.process (xOutAccum);
+
+            const float out = H0_ * yBBD_old_ + outputBank_.output();
+            if (!std::isfinite (out))
+            {
+                reset();
+                return 0.0f;
+            }
+            return out;
+        }
+
         float fs_ { 48000.0f };
         float Ts_ { 1.0f / 48000.0f };
         float Ts_bbd_ { 1.0f / 48000.0f };
+        float stepClockHz_ { 0.0f };
         float kMinClockHz_ { 1600.0f };
         float kMaxClockHz_ { 4800000.0f };
         float lastIn_ { 0.0f };
 
         InputPoleBank inputBank_ {};
         OutputPoleBank outputBank_ {};
+        float inputCutoffHz_ { kInputCutoffHz };
+        float outputCutoffHz_ { kOutputCutoffHz };
         float H0_ { 1.0f };
 
         float* storage_ { nullptr };
@@ -213,6 +518,16 @@ namespace MarsDSP::BBD
         float yBBD_old_ { 0.0f };
         float tn_ { 0.0f };
         bool evenOn_ { true };
+        bool incrementalPoles_ { true };
+        bool boundedCost_ { false };
+        int stride_ { 1 };
+
+        // Read-ahead run: the pending input halves. popPtr_ runs ahead of
+        // bufferPtr_ by the buckets the pending writes will fill.
+        std::array<AheadStep, kMaxAhead> ahead_ {};
+        int aheadCount_ { 0 };
+        int aheadNext_ { 0 };
+        int popPtr_ { 0 };
     };
 }
 #endif
@@ -4,6 +4,7 @@
 #define CHRONOS_BBD_CLOCK_MODEL_H
 
 #include "BrigadeLine.h"
+#include "simd/Config.h"
 #include <algorithm>
 
 namespace MarsDSP::BBD
@@ -12,7 +13,9 @@ namespace MarsDSP::BBD
      *  Maps the effective loop delay to the bucket-brigade clock frequency.
      *  The half-sample term accounts for the zero-order-hold midpoint of the
      *  bucket stage, so clockFor and achievedDelaySamples are exact inverses.
+     *  Stages matches the BrigadeLine the clock drives.
      */
+    template <int Stages = 4096>
     class ClockModel
     {
     public:
@@ -31,19 +34,51 @@ namespace MarsDSP::BBD
             const float minClk = minClockHz (sampleRate);
             const float maxClk = maxClockHz (sampleRate);
 
-            const double kStages = static_cast<double> (BrigadeLine::kStages);
+            const double kStages = static_cast<double> (BrigadeLine<Stages>::kStages);
             const double minDelay = (2.0 * kStages + 0.5) * sampleRate / static_cast<double> (maxClk);
             const double safeDelay = std::max (minDelay, static_cast<double> (dEffSamples));
             const double fClk = (2.0 * kStages + 0.5) * sampleRate / safeDelay;
             return std::clamp (static_cast<float> (fClk), minClk, maxClk);
         }
 
+        /// clockFor over n delays. The divisions run two to a double lane
+        /// pair, in the same order as clockFor, so the clocks match it bit
+        /// for bit. In place (clockHz == dEffSamples) is allowed.
+        static void clockForBlock (const float* dEffSamples, float* clockHz, int n, double sampleRate) noexcept
+        {
+            const float minClk = minClockHz (sampleRate);
+            const float maxClk = maxClockHz (sampleRate);
+
+            const double kStages = static_cast<double> (BrigadeLine<Stages>::kStages);
+            const double num = (2.0 * kStages + 0.5) * sampleRate;
+            const double minDelay = num / static_cast<double> (maxClk);
+
+            const M128D vNum = MM(set1_pd) (num);
+            const M128D vMinDelay = MM(set1_pd) (minDelay);
+            const M128 vMinClk = MM(set1_ps) (minClk);
+            const M128 vMaxClk = MM(set1_ps) (maxClk);
+
+            int i = 0;
+            for (; i + 4 <= n; i += 4)
+            {
+                const M128 d = MM(loadu_ps) (dEffSamples + i);
+                const M128D lo = MM(max_pd) (MM(cvtps_pd) (d), vMinDelay);
+                const M128D hi = MM(max_pd) (MM(cvtps_pd) (MM(movehl_ps) (d, d)), vMinDelay);
+                const M128 fLo = MM(cvtpd_ps) (MM(div_pd) (vNum, lo));
+                const M128 fHi = MM(cvtpd_ps) (MM(div_pd) (vNum, hi));
+                const M128 f = MM(movelh_ps) (fLo, fHi);
+                MM(storeu_ps) (clockHz + i, MM(max_ps) (vMinClk, MM(min_ps) (f, vMaxClk)));
+            }
+            for (; i < n; ++i)
+                clockHz[i] = clockFor (dEffSamples[i], sampleRate);
+        }
+
         [[nodiscard]] static float achievedDelaySamples (float clockHz, double sampleRate) noexcept
         {
             if (clockHz <= 0.0f)
                 return 0.0f;
 
-            const double kStages = static_cast<double> (BrigadeLine::kStages);
+            const double kStages = static_cast<double> (BrigadeLine<Stages>::kStages);
             return static_cast<float> ((2.0 * kStages + 0.5) * sampleRate / static_cast<double> (clockHz));
         }
 
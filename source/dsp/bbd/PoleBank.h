@@ -7,7 +7,9 @@
 #include <array>
 #include <cmath>
 #include <complex>
+#include <cstddef>
 #include <numbers>
+#include "simd/Config.h"
 
 namespace MarsDSP::BBD
 {
@@ -15,6 +17,15 @@ namespace MarsDSP::BBD
      *  Fourth-order Butterworth low-pass banks for BBD antialiasing and reconstruction.
      *  Poles and residues come in closed form from two cascaded Sallen-Key
      *  stages with Q1 and Q2, discretized by the matched-Z transform.
+     *
+     *  Gcalc is the pole rotation at the fractional event time tn. calcG
+     *  evaluates it exactly; advanceG steps it by the set_delta interval,
+     *  which is how BrigadeLine walks the events inside one audio sample.
+     *
+     *  The four poles sit in the four lanes of split real/imaginary M128
+     *  pairs, so every per-event and per-sample update is one complex
+     *  vector operation. Only calcG and set_delta go through std::complex,
+     *  for std::pow, and load the result.
      */
     constexpr float kInputCutoffHz = 9900.0f;
     constexpr float kOutputCutoffHz = 9500.0f;
@@ -60,6 +71,56 @@ namespace MarsDSP::BBD
         return res;
     }
 
+    /// Four complex values, one per pole, as split real/imaginary lanes.
+    struct PoleVec
+    {
+        M128 re { MM(setzero_ps)() };
+        M128 im { MM(setzero_ps)() };
+
+        static PoleVec load (const std::array<std::complex<float>, 4>& c) noexcept
+        {
+            alignas (16) std::array<float, 4> r {};
+            alignas (16) std::array<float, 4> i {};
+            for (std::size_t m = 0; m < 4; ++m)
+            {
+                r[m] = c[m].real();
+                i[m] = c[m].imag();
+            }
+            return { MM(load_ps) (r.data()), MM(load_ps) (i.data()) };
+        }
+
+        [[nodiscard]] std::complex<float> lane (int m) const noexcept
+        {
+            alignas (16) std::array<float, 4> r {};
+            alignas (16) std::array<float, 4> i {};
+            MM(store_ps) (r.data(), re);
+            MM(store_ps) (i.data(), im);
+            return { r[static_cast<std::size_t>(m)], i[static_cast<std::size_t>(m)] };
+        }
+    };
+
+    namespace detail
+    {
+        inline PoleVec cmul (const PoleVec& a, const PoleVec& b) noexcept
+        {
+            return { MM(sub_ps) (MM(mul_ps) (a.re, b.re), MM(mul_ps) (a.im, b.im)),
+                     FMADD (a.re, b.im, MM(mul_ps) (a.im, b.re)) };
+        }
+
+        /// Re (a * b), per lane.
+        inline M128 cmulRe (const PoleVec& a, const PoleVec& b) noexcept
+        {
+            return MM(sub_ps) (MM(mul_ps) (a.re, b.re), MM(mul_ps) (a.im, b.im));
+        }
+
+        inline float hsum (M128 v) noexcept
+        {
+            const M128 sh1 = MM(add_ps) (v, MM(movehl_ps) (v, v));
+            const M128 sh2 = MM(add_ss) (sh1, MM(shuffle_ps) (sh1, sh1, MM_SHUFFLE (0, 0, 0, 1)));
+            return MM(cvtss_f32) (sh2);
+        }
+    }
+
     class InputPoleBank
     {
     public:
@@ -71,67 +132,89 @@ namespace MarsDSP::BBD
 
         void reset() noexcept
         {
-            for (int i = 0; i < 4; ++i)
-            {
-                x[i] = std::complex<float> (0.0f, 0.0f);
-                Gcalc[i] = gCoef[i];
-            }
+            x = {};
+            Gcalc = g0_;
         }
 
         void set_freq (float freqHz) noexcept
         {
             const auto pr = computeButterworthPolesAndResidues (static_cast<double> (freqHz));
+            std::array<std::complex<float>, 4> b {};
+            std::array<std::complex<float>, 4> v {};
             for (int m = 0; m < 4; ++m)
             {
                 const std::complex<double> pCorr = std::exp (pr.poles[m] * static_cast<double> (Ts_));
                 pole_corr[m] = static_cast<std::complex<float>> (pCorr);
-                pole_corr_angle[m] = static_cast<float> (std::arg (pCorr));
                 pole[m] = static_cast<std::complex<float>> (pr.poles[m]);
                 gCoef[m] = static_cast<std::complex<float>> (pr.residues[m]);
-                bCoef[m] = static_cast<std::complex<float>> ((pCorr - 1.0) / pr.poles[m]);
+                b[m] = static_cast<std::complex<float>> ((pCorr - 1.0) / pr.poles[m]);
+                v[m] = static_cast<std::complex<float>> (1.0 / pr.poles[m]);
             }
+            p_ = PoleVec::load (pole_corr);
+            b_ = PoleVec::load (b);
+            g0_ = PoleVec::load (gCoef);
+            poleInv_ = PoleVec::load (v);
         }
 
-        void set_time (float tn) noexcept
-        {
-            for (int m = 0; m < 4; ++m)
-                Gcalc[m] = gCoef[m] * std::pow (pole_corr[m], tn);
-        }
+        void set_time (float tn) noexcept { calcG (tn); }
 
         void set_delta (float delta) noexcept
         {
+            std::array<std::complex<float>, 4> a {};
             for (int m = 0; m < 4; ++m)
-            {
-                Aplus[m] = std::pow (pole_corr[m], delta);
-            }
+                a[m] = std::pow (pole_corr[m], delta);
+            Aplus = PoleVec::load (a);
         }
 
+        /// The set_delta step of a bank with the same cutoff, without the pow.
+        void copyStep (const InputPoleBank& other) noexcept { Aplus = other.Aplus; }
+
         void calcG (float tn) noexcept
         {
+            std::array<std::complex<float>, 4> g {};
             for (int m = 0; m < 4; ++m)
-                Gcalc[m] = gCoef[m] * std::pow (pole_corr[m], tn);
+                g[m] = gCoef[m] * std::pow (pole_corr[m], tn);
+            Gcalc = PoleVec::load (g);
         }
 
+        /// Gcalc at tn + delta from Gcalc at tn: one multiply by Aplus per pole.
+        void advanceG() noexcept { Gcalc = detail::cmul (Gcalc, Aplus); }
+
         void process (float u) noexcept
         {
-            for (int m = 0; m < 4; ++m)
-                x[m] = pole_corr[m] * x[m] + bCoef[m] * u;
+            const M128 vu = MM(set1_ps) (u);
+            const PoleVec px = detail::cmul (p_, x);
+            x = { FMADD (b_.re, vu, px.re), FMADD (b_.im, vu, px.im) };
+        }
+
+        /// The charge sampled into a bucket at the current Gcalc, with u the
+        /// input held since the last audio sample:
+        /// sum Re (G x + (G - g0) / pole * u).
+        [[nodiscard]] float bucketCharge (float u) const noexcept
+        {
+            const PoleVec dg { MM(sub_ps) (Gcalc.re, g0_.re), MM(sub_ps) (Gcalc.im, g0_.im) };
+            const M128 held = detail::cmulRe (dg, poleInv_);
+            return detail::hsum (FMADD (held, MM(set1_ps) (u), detail::cmulRe (Gcalc, x)));
         }
 
         [[nodiscard]] std::complex<float> getG0 (int m) const noexcept { return gCoef[static_cast<std::size_t>(m)]; }
         [[nodiscard]] std::complex<float> getPole (int m) const noexcept { return pole[static_cast<std::size_t>(m)]; }
+        [[nodiscard]] std::complex<float> getX (int m) const noexcept { return x.lane (m); }
+        [[nodiscard]] std::complex<float> getG (int m) const noexcept { return Gcalc.lane (m); }
 
-        std::array<std::complex<float>, 4> x {};
-        std::array<std::complex<float>, 4> Gcalc {};
+        PoleVec x {};
+        PoleVec Gcalc {};
 
     private:
         float Ts_ { 1.0f / 48000.0f };
         std::array<std::complex<float>, 4> pole_corr {};
-        std::array<float, 4> pole_corr_angle {};
         std::array<std::complex<float>, 4> pole {};
         std::array<std::complex<float>, 4> gCoef {};
-        std::array<std::complex<float>, 4> bCoef {};
-        std::array<std::complex<float>, 4> Aplus {};
+        PoleVec p_ {};
+        PoleVec b_ {};
+        PoleVec g0_ {};
+        PoleVec poleInv_ {};
+        PoleVec Aplus {};
     };
 
     class OutputPoleBank
@@ -145,11 +228,8 @@ namespace MarsDSP::BBD
 
         void reset() noexcept
         {
-            for (int i = 0; i < 4; ++i)
-            {
-                x[i] = std::complex<float> (0.0f, 0.0f);
-                Gcalc[i] = Amult[i];
-            }
+            x = {};
+            Gcalc = Amult_;
         }
 
         [[nodiscard]] float calcH0() const noexcept
@@ -167,48 +247,69 @@ namespace MarsDSP::BBD
             {
                 const std::complex<double> pCorr = std::exp (pr.poles[m] * static_cast<double> (Ts_));
                 pole_corr[m] = static_cast<std::complex<float>> (pCorr);
-                pole_corr_angle[m] = static_cast<float> (std::arg (pCorr));
                 gCoef[m] = static_cast<std::complex<float>> (pr.residues[m] / pr.poles[m]);
                 Amult[m] = gCoef[m] * pole_corr[m];
             }
+            p_ = PoleVec::load (pole_corr);
+            Amult_ = PoleVec::load (Amult);
         }
 
-        void set_time (float tn) noexcept
-        {
-            for (int m = 0; m < 4; ++m)
-                Gcalc[m] = Amult[m] * std::pow (pole_corr[m], 1.0f - tn);
-        }
+        void set_time (float tn) noexcept { calcG (tn); }
 
         void set_delta (float delta) noexcept
         {
+            std::array<std::complex<float>, 4> a {};
             for (int m = 0; m < 4; ++m)
-            {
-                Aplus[m] = std::pow (pole_corr[m], -delta);
-            }
+                a[m] = std::pow (pole_corr[m], -delta);
+            Aplus = PoleVec::load (a);
         }
 
+        /// The set_delta step of a bank with the same cutoff, without the pow.
+        void copyStep (const OutputPoleBank& other) noexcept { Aplus = other.Aplus; }
+
         void calcG (float tn) noexcept
         {
+            std::array<std::complex<float>, 4> g {};
             for (int m = 0; m < 4; ++m)
-                Gcalc[m] = Amult[m] * std::pow (pole_corr[m], 1.0f - tn);
+                g[m] = Amult[m] * std::pow (pole_corr[m], 1.0f - tn);
+            Gcalc = PoleVec::load (g);
+        }
+
+        /// Gcalc at tn + delta from Gcalc at tn. Aplus carries the negative
+        /// exponent, since Gcalc follows pole_corr^(1 - tn) here.
+        void advanceG() noexcept { Gcalc = detail::cmul (Gcalc, Aplus); }
+
+        /// acc += Gcalc * delta, one fused multiply-add per component.
+        void accumulate (PoleVec& acc, float delta) const noexcept
+        {
+            const M128 vd = MM(set1_ps) (delta);
+            acc.re = FMADD (Gcalc.re, vd, acc.re);
+            acc.im = FMADD (Gcalc.im, vd, acc.im);
         }
 
-        void process (const std::array<std::complex<float>, 4>& u) noexcept
+        void process (const PoleVec& u) noexcept
         {
-            for (int m = 0; m < 4; ++m)
-                x[m] = pole_corr[m] * x[m] + u[m];
+            const PoleVec px = detail::cmul (p_, x);
+            x = { MM(add_ps) (px.re, u.re), MM(add_ps) (px.im, u.im) };
         }
 
-        std::array<std::complex<float>, 4> x {};
-        std::array<std::complex<float>, 4> Gcalc {};
+        /// sum Re (x), the bank's contribution to the output sample.
+        [[nodiscard]] float output() const noexcept { return detail::hsum (x.re); }
+
+        [[nodiscard]] std::complex<float> getX (int m) const noexcept { return x.lane (m); }
+        [[nodiscard]] std::complex<float> getG (int m) const noexcept { return Gcalc.lane (m); }
+
+        PoleVec x {};
+        PoleVec Gcalc {};
 
     private:
         float Ts_ { 1.0f / 48000.0f };
         std::array<std::complex<float>, 4> pole_corr {};
-        std::array<float, 4> pole_corr_angle {};
         std::array<std::complex<float>, 4> gCoef {};
         std::array<std::complex<float>, 4> Amult {};
-        std::array<std::complex<float>, 4> Aplus {};
+        PoleVec p_ {};
+        PoleVec Amult_ {};
+        PoleVec Aplus {};
     };
 }
 #endif
@@ -0,0 +1,301 @@
+#pragma once
+
+#ifndef CHRONOS_BBD_STEREO_BRIGADE_LINE_H
+#define CHRONOS_BBD_STEREO_BRIGADE_LINE_H
+
+#include "BrigadeLine.h"
+
+namespace MarsDSP::BBD
+{
+    /** Two BrigadeLines that share one event schedule while their clocks agree.
+     *  The pole rotations depend only on the event time and the clock, so
+     *  in lockstep they are computed once, on the left line, and copied to
+     *  the right. Each line keeps its own pole states, buckets and input.
+     *  Lockstep needs equal clocks, equal bank cutoffs, the same phase
+     *  (tn, next event, bucket pointer) and the same rotation step, which
+     *  the right line then copies. Otherwise both lines run their own
+     *  readTap. Either way the output is bit-identical to two independent
+     *  lines.
+     *
+     *  Lines fall out of phase once their clocks differ, for example under
+     *  per-channel modulation. They come back into lockstep at the next reset.
+     *
+     *  readAhead and writeAhead are BrigadeLine's split run for both lines,
+     *  sharing the rotations the same way on both halves.
+     */
+    template <int Stages = 4096>
+    class StereoBrigadeLine
+    {
+    public:
+        using Line = BrigadeLine<Stages>;
+        static constexpr int kStages = Stages;
+
+        static constexpr std::size_t bbdStorageFloats() noexcept { return Line::bbdStorageFloats (2); }
+
+        void prepare (double sampleRate, float* storageL, float* storageR)
+        {
+            left_.prepare (sampleRate, storageL);
+            right_.prepare (sampleRate, storageR);
+            locked_ = false;
+        }
+
+        void reset() noexcept
+        {
+            left_.reset();
+            right_.reset();
+            locked_ = false;
+        }
+
+        /// Off always runs the lines on their own schedules, as a reference.
+        void setLockstep (bool on) noexcept { lockstep_ = on; }
+
+        void setBoundedCost (bool on) noexcept
+        {
+            left_.setBoundedCost (on);
+            right_.setBoundedCost (on);
+        }
+
+        /// Per-channel clocks for the next readTap. Equal clocks on lines in
+        /// phase update only the left line's rotation step.
+        void setClockHz (float clkL, float clkR) noexcept
+        {
+            locked_ = lockstep_ && clkL == clkR && inPhase_();
+            left_.setClockHz (clkL);
+            if (locked_)
+            {
+                right_.Ts_bbd_ = left_.Ts_bbd_;
+                right_.stride_ = left_.stride_;
+                if (right_.stepClockHz_ != left_.stepClockHz_)
+                {
+                    right_.stepClockHz_ = left_.stepClockHz_;
+                    right_.inputBank_.copyStep (left_.inputBank_);
+                    right_.outputBank_.copyStep (left_.outputBank_);
+                }
+            }
+            else
+                right_.setClockHz (clkR);
+        }
+
+        inline void readTap (float& tapL, float& tapR) noexcept
+        {
+            if (!locked_)
+            {
+                tapL = left_.readTap();
+                tapR = right_.readTap();
+                return;
+            }
+
+            Line& l = left_;
+            Line& r = right_;
+            if (l.storage_ == nullptr || r.storage_ == nullptr)
+            {
+                tapL = l.readTap();
+                tapR = r.readTap();
+                return;
+            }
+
+            PoleVec accL {};
+            PoleVec accR {};
+            int iterations = 0;
+            bool inFresh = true;
+            bool outFresh = true;
+
+            const float stepNorm = l.Ts_bbd_ * l.fs_ * static_cast<float> (l.stride_);
+            while (l.tn_ < 1.0f)
+            {
+                if (++iterations > 10000)
+                    break;
+
+                if (l.evenOn_)
+                {
+                    l.rotate_ (l.inputBank_, inFresh, l.tn_);
+                    r.inputBank_.Gcalc = l.inputBank_.Gcalc;
+                    l.pushBucket_ (l.inputBank_.bucketCharge (l.lastIn_), l.stride_);
+                    r.pushBucket_ (r.inputBank_.bucketCharge (r.lastIn_), r.stride_);
+                }
+                else
+                {
+                    const float deltaL = l.popDelta_ (l.bufferPtr_);
+                    const float deltaR = r.popDelta_ (r.bufferPtr_);
+                    l.rotate_ (l.outputBank_, outFresh, l.tn_);
+                    r.outputBank_.Gcalc = l.outputBank_.Gcalc;
+                    l.outputBank_.accumulate (accL, deltaL);
+                    r.outputBank_.accumulate (accR, deltaR);
+                }
+
+                l.evenOn_ = !l.evenOn_;
+                l.tn_ += stepNorm;
+            }
+            l.tn_ -= 1.0f;
+            r.tn_ = l.tn_;
+            r.evenOn_ = l.evenOn_;
+
+            tapL = l.finishTap_ (accL);
+            tapR = r.finishTap_ (accR);
+        }
+
+        inline void writeSample (float uL, float uR) noexcept
+        {
+            left_.writeSample (uL);
+            right_.writeSample (uR);
+        }
+
+        /// BrigadeLine::readAhead for both lines; the run is as long as the
+        /// shorter of the two limits.
+        int readAhead (const float* clkL, const float* clkR, float* outL, float* outR, int n) noexcept
+        {
+            n = std::min (left_.aheadLimit (clkL, n), right_.aheadLimit (clkR, n));
+            left_.beginAhead_();
+            right_.beginAhead_();
+            for (int i = 0; i < n; ++i)
+            {
+                locked_ = lockstep_ && clkL[i] == clkR[i] && inPhase_()
+                          && left_.storage_ != nullptr && right_.storage_ != nullptr
+                          && !left_.readsInPlace_ (clkL[i]);
+                lockedAhead_[static_cast<std::size_t> (i)] = locked_;
+                if (locked_)
+                    readAheadLocked_ (clkL[i], outL[i], outR[i]);
+                else
+                {
+                    outL[i] = left_.readAheadTap_ (clkL[i]);
+                    outR[i] = right_.readAheadTap_ (clkR[i]);
+                }
+            }
+            return n;
+        }
+
+        /// Input halves of the oldest samples read ahead, then uL and uR.
+        inline void writeAhead (float uL, float uR) noexcept
+        {
+            Line& l = left_;
+            Line& r = right_;
+            const int k = l.aheadNext_;
+            const auto idx = static_cast<std::size_t> (k);
+            if (k >= l.aheadCount_ || k != r.aheadNext_ || !lockedAhead_[idx]
+                || !(l.ahead_[idx] == r.ahead_[idx]))
+            {
+                l.writeAhead (uL);
+                r.writeAhead (uR);
+                return;
+            }
+
+            const auto step = l.ahead_[idx];
+            ++l.aheadNext_;
+            ++r.aheadNext_;
+            if (step.delta > 0.0f)
+            {
+                l.inputBank_.set_delta (step.delta);
+                r.inputBank_.copyStep (l.inputBank_);
+            }
+
+            bool inFresh = true;
+            float tn = step.firstTn;
+            for (int p = 0; p < step.pushes; ++p)
+            {
+                l.rotate_ (l.inputBank_, inFresh, tn);
+                r.inputBank_.Gcalc = l.inputBank_.Gcalc;
+                l.pushBucket_ (l.inputBank_.bucketCharge (l.lastIn_), step.stride);
+                r.pushBucket_ (r.inputBank_.bucketCharge (r.lastIn_), step.stride);
+                tn += step.step;
+                tn += step.step;
+            }
+
+            l.writeSample (uL);
+            r.writeSample (uR);
+        }
+
+        /// True when the last setClockHz, or the last sample readAhead took,
+        /// put the lines in lockstep.
+        [[nodiscard]] bool isLocked() const noexcept { return locked_; }
+
+        [[nodiscard]] Line& left() noexcept { return left_; }
+        [[nodiscard]] Line& right() noexcept { return right_; }
+
+    private:
+        // readAheadTap_ for both lines in lockstep. The right line copies
+        // the left line's clock, step and output rotations.
+        void readAheadLocked_ (float clk, float& tapL, float& tapR) noexcept
+        {
+            Line& l = left_;
+            Line& r = right_;
+            auto& stepL = l.ahead_[static_cast<std::size_t> (l.aheadCount_++)];
+            auto& stepR = r.ahead_[static_cast<std::size_t> (r.aheadCount_++)];
+
+            stepL.delta = 0.0f;
+            if (l.applyClock_ (clk))
+            {
+                l.stepClockHz_ = l.getClockHz();
+                stepL.delta = l.deltaNorm_();
+                l.outputBank_.set_delta (stepL.delta);
+            }
+            stepL.stride = l.stride_;
+            stepL.step = l.Ts_bbd_ * l.fs_ * static_cast<float> (l.stride_);
+            stepL.pushes = 0;
+
+            r.Ts_bbd_ = l.Ts_bbd_;
+            r.stride_ = l.stride_;
+            if (r.stepClockHz_ != l.stepClockHz_)
+            {
+                r.stepClockHz_ = l.stepClockHz_;
+                r.outputBank_.copyStep (l.outputBank_);
+            }
+
+            PoleVec accL {};
+            PoleVec accR {};
+            int iterations = 0;
+            bool outFresh = true;
+            while (l.tn_ < 1.0f)
+            {
+                if (++iterations > 10000)
+                    break;
+
+                if (l.evenOn_)
+                {
+                    if (stepL.pushes++ == 0)
+                        stepL.firstTn = l.tn_;
+                    l.skipPush_ (stepL.stride);
+                    r.skipPush_ (stepL.stride);
+                }
+                else
+                {
+                    const float deltaL = l.popDelta_ (l.popPtr_);
+                    const float deltaR = r.popDelta_ (r.popPtr_);
+                    l.rotate_ (l.outputBank_, outFresh, l.tn_);
+                    r.outputBank_.Gcalc = l.outputBank_.Gcalc;
+                    l.outputBank_.accumulate (accL, deltaL);
+                    r.outputBank_.accumulate (accR, deltaR);
+                }
+
+                l.evenOn_ = !l.evenOn_;
+                l.tn_ += stepL.step;
+            }
+            l.tn_ -= 1.0f;
+            r.tn_ = l.tn_;
+            r.evenOn_ = l.evenOn_;
+            stepR = stepL;
+
+            tapL = l.finishTap_ (accL);
+            tapR = r.finishTap_ (accR);
+        }
+
+        [[nodiscard]] bool inPhase_() const noexcept
+        {
+            return left_.tn_ == right_.tn_
+                && left_.evenOn_ == right_.evenOn_
+                && left_.stepClockHz_ == right_.stepClockHz_
+                && left_.bufferPtr_ == right_.bufferPtr_
+                && left_.popPtr_ == right_.popPtr_
+                && left_.inputCutoffHz_ == right_.inputCutoffHz_
+                && left_.outputCutoffHz_ == right_.outputCutoffHz_
+                && left_.incrementalPoles_ == right_.incrementalPoles_
+                && left_.boundedCost_ == right_.boundedCost_;
+        }
+
+        Line left_;
+        Line right_;
+        std::array<bool, Line::kMaxAhead> lockedAhead_ {};
+        bool lockstep_ { true };
+        bool locked_ { false };
+    };
+}
+#endif
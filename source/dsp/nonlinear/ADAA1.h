@@ -4,33 +4,77 @@
 #define CHRONOS_ADAA1_H
 
 #include <cmath>
+#include <type_traits>
+#include "Nonlinearities.h"
 
 namespace MarsDSP::Nonlinear {
+    /// Runs in NL's sample type: double, or float for the economy NLs.
     template <typename NL>
     class ADAA1 {
     public:
+        using Sample = SampleOf<NL>;
+
+        // Float: F1's rounding over dx balanced against the midpoint error,
+        // from scripts/python/remez_tanh_economy.py.
+        static constexpr Sample kEps = std::is_same_v<Sample, float> ? Sample(0.049) : Sample(1e-4);
+
         void reset() noexcept
         {
-            x1_ = 0.0;
-            F1x1_ = 0.0;
+            x1_ = Sample(0);
+            F1x1_ = Sample(0);
+        }
+
+        Sample process(Sample x0) noexcept
+        {
+            return step(x0, NL::F1(x0), x1_, F1x1_);
+        }
+
+        /// n samples from x into y, which must not alias x. F1 runs over the
+        /// whole block first (NL::F1Block where the NL has one), then the
+        /// difference quotients in order.
+        void processBlock(const Sample *x, Sample *y, const int n) noexcept
+        {
+            if constexpr (requires { NL::F1Block(x, y, n); }) NL::F1Block(x, y, n);
+            else for (int i = 0; i < n; ++i) y[i] = NL::F1(x[i]);
+            for (int i = 0; i < n; ++i)
+                y[i] = step(x[i], y[i], x1_, F1x1_);
+        }
+
+        /// processBlock for a quiet block: when x and the history stay under
+        /// NL::kSeriesBound, runs NL's series path, leaves the state as
+        /// processBlock would and returns true. Otherwise touches nothing.
+        bool trySeriesBlock(const Sample *x, Sample *y, const int n) noexcept
+            requires SeriesNL<NL>
+        {
+            if (n <= 0 || !underSeriesBound(x, n, NL::kSeriesBound, x1_)) return false;
+            NL::Series1Block(x, y, n, x1_);
+            seriesHandOff(x[n - 1], x1_, F1x1_);
+            return true;
+        }
+
+        /// The state step() leaves after x0, for the series path's last sample.
+        static void seriesHandOff(Sample x0, Sample &x1, Sample &F1x1) noexcept
+        {
+            x1 = x0;
+            F1x1 = NL::F1(x0);
         }
 
-        double process(double x0) noexcept
+        /// One step on external state, given F1(x0). StereoADAA1 runs
+        /// its lanes through this when it cannot take the packed path.
+        static Sample step(Sample x0, Sample F1x0, Sample &x1, Sample &F1x1) noexcept
         {
-            constexpr double kEps = 1e-4;
-            const double F1x0 = NL::F1(x0);
-            const double dx = x0 - x1_;
-            const double y = (std::fabs(dx) < kEps)
-                                 ? NL::f(0.5 * (x0 + x1_))
-                                 : (F1x0 - F1x1_) / dx;
-            x1_ = x0;
-            F1x1_ = F1x0;
+            const Sample dx = x0 - x1;
+            const Sample y = (std::fabs(dx) < kEps)
+                                 ? NL::f(Sample(0.5) * (x0 + x1))
+                                 : (F1x0 - F1x1) / dx;
+            x1 = x0;
+            F1x1 = F1x0;
             return y;
         }
 
     private:
-        double x1_{0.0};
-        double F1x1_{0.0};
+        Sample x1_{0};
+        Sample F1x1_{0};
     };
 }
 #endif
@@ -4,6 +4,7 @@
 #define CHRONOS_ADAA2_H
 
 #include <cmath>
+#include "Nonlinearities.h"
 
 namespace MarsDSP::Nonlinear {
     template <typename NL>
@@ -20,44 +21,86 @@ namespace MarsDSP::Nonlinear {
         }
 
         double process(double x0) noexcept
+        {
+            return step(x0, NL::F2(x0), x1_, x2_, F2x1_, d2_);
+        }
+
+        /// n samples from x into y, which must not alias x. F2 runs over the
+        /// whole block first (NL::F2Block where the NL has one), then the
+        /// divided-difference recurrence. The midpoint branches still call
+        /// NL::F1 and NL::f per sample; they are rare.
+        void processBlock(const double *x, double *y, const int n) noexcept
+        {
+            if constexpr (requires { NL::F2Block(x, y, n); }) NL::F2Block(x, y, n);
+            else for (int i = 0; i < n; ++i) y[i] = NL::F2(x[i]);
+            for (int i = 0; i < n; ++i)
+                y[i] = step(x[i], y[i], x1_, x2_, F2x1_, d2_);
+        }
+
+        /// processBlock for a quiet block: when x and the history stay under
+        /// NL::kSeriesBound, runs NL's series path, leaves the state as
+        /// processBlock would and returns true. Otherwise touches nothing.
+        bool trySeriesBlock(const double *x, double *y, const int n) noexcept
+            requires SeriesNL<NL>
+        {
+            if (n <= 0 || !underSeriesBound(x, n, NL::kSeriesBound, x1_, x2_)) return false;
+            NL::Series2Block(x, y, n, x1_, x2_);
+            seriesHandOff(x[n - 1], n > 1 ? x[n - 2] : x1_, x1_, x2_, F2x1_, d2_);
+            return true;
+        }
+
+        /// The state step() leaves after xPrev then x0, for the series
+        /// path's last two samples. d2 takes step()'s d1 branch.
+        static void seriesHandOff(double x0, double xPrev, double &x1, double &x2, double &F2x1, double &d2) noexcept
         {
             const double F2x0 = NL::F2(x0);
+            d2 = (std::fabs(x0 - xPrev) < kEpsInner)
+                     ? NL::F1(0.5 * (x0 + xPrev))
+                     : (F2x0 - NL::F2(xPrev)) / (x0 - xPrev);
+            x2 = xPrev;
+            x1 = x0;
+            F2x1 = F2x0;
+        }
 
-            const double A = std::fabs(x0 - x1_);
-            const double B = std::fabs(x1_ - x2_);
-            const double C = std::fabs(x0 - x2_);
+        /// One step on external state, given F2(x0). StereoADAA2 runs
+        /// its lanes through this when it cannot take the packed path.
+        static double step(double x0, double F2x0, double &x1, double &x2, double &F2x1, double &d2) noexcept
+        {
+            const double A = std::fabs(x0 - x1);
+            const double B = std::fabs(x1 - x2);
+            const double C = std::fabs(x0 - x2);
 
             const double d1 = (A < kEpsInner)
-                                  ? NL::F1(0.5 * (x0 + x1_))
-                                  : (F2x0 - F2x1_) / (x0 - x1_);
+                                  ? NL::F1(0.5 * (x0 + x1))
+                                  : (F2x0 - F2x1) / (x0 - x1);
 
             double y;
             if (A < kEpsInner && B < kEpsInner)
             {
-                y = NL::f((x0 + x1_ + x2_) / 3.0);
+                y = NL::f((x0 + x1 + x2) / 3.0);
             }
             else if (C < kEpsOuter)
             {
-                const double m02 = 0.5 * (x0 + x2_);
-                const double denom = m02 - x1_;
+                const double m02 = 0.5 * (x0 + x2);
+                const double denom = m02 - x1;
                 y = (std::fabs(denom) < 1e-15) ? NL::f(m02) : 2.0 * (NL::F1(m02) - d1) / denom;
             }
             else
             {
-                y = 2.0 * (d1 - d2_) / (x0 - x2_);
+                y = 2.0 * (d1 - d2) / (x0 - x2);
             }
 
-            x2_ = x1_;
-            x1_ = x0;
-            F2x1_ = F2x0;
-            d2_ = d1;
+            x2 = x1;
+            x1 = x0;
+            F2x1 = F2x0;
+            d2 = d1;
             return y;
         }
 
-    private:
         static constexpr double kEpsInner = 1e-4;
         static constexpr double kEpsOuter = 1e-6;
 
+    private:
         double x1_{};
         double x2_{};
         double F2x1_{};
@@ -4,16 +4,98 @@
 #define CHRONOS_NONLINEARITIES_H
 
 #include <cmath>
+#include <concepts>
 #include "math/TanhAntiderivatives.h"
+#include "simd/Kernels.h"
 
 namespace MarsDSP::Nonlinear {
     constexpr double kLn2 = 0.6931471805599453;
+
+    /// ADAA precision, chosen per instance. Economy runs the tanh
+    /// antiderivative and the ADAA1 recurrence in float; ADAA2 stays
+    /// double (see dsp-notes.md).
+    enum class AdaaPrecision
+    {
+        Standard = 0,
+        Economy = 1
+    };
+
+    namespace detail
+    {
+        template <typename NL>
+        struct SampleOfImpl
+        {
+            using type = double;
+        };
+
+        template <typename NL>
+            requires requires { typename NL::Sample; }
+        struct SampleOfImpl<NL>
+        {
+            using type = typename NL::Sample;
+        };
+    } // namespace detail
+
+    /// The type an NL's f/F1/F2 take and return: NL::Sample, else double.
+    template <typename NL>
+    using SampleOf = typename detail::SampleOfImpl<NL>::type;
+
+    /// An NL with a quiet-region series path: Series1Block/Series2Block are
+    /// ADAA1/ADAA2 of a truncated series of f, valid under kSeriesBound.
+    template <typename NL>
+    concept SeriesNL = requires { { NL::kSeriesBound } -> std::convertible_to<double>; };
+
+    /// True when |x| < bound for all n samples and both history values.
+    /// NaN fails the test.
+    inline bool underSeriesBound(const double *x, const int n, const double bound,
+                                 const double h1, const double h2 = 0.0) noexcept
+    {
+        bool under = std::fabs(h1) < bound && std::fabs(h2) < bound;
+        for (int i = 0; i < n; ++i)
+            under &= std::fabs(x[i]) < bound;
+        return under;
+    }
+
     struct TanhNL
     {
         static constexpr auto name = "tanh";
         static double f(const double x) noexcept { return std::tanh(x); }
         static double F1(const double x) noexcept { return Math::f1Tanh(x); }
         static double F2(const double x) noexcept { return Math::f2Tanh(x); }
+
+        // Two lanes at once, bit-identical to the scalar forms per lane.
+        static M128D F1(const M128D x) noexcept { return Math::f1TanhPair(x); }
+        static M128D F2(const M128D x) noexcept { return Math::f2TanhPair(x); }
+
+        // A block at a time through the dispatched kernels, for
+        // ADAA1/ADAA2::processBlock. Within 2 ulp of F1/F2, not bit-identical.
+        static void F1Block(const double *x, double *y, const int n) noexcept { Simd::kernels().tanhF1Block(x, y, n); }
+        static void F2Block(const double *x, double *y, const int n) noexcept { Simd::kernels().tanhF2Block(x, y, n); }
+
+        // ADAA1/ADAA2 of the series x - x^3/3 + 2x^5/15 in closed form, for
+        // blocks whose inputs and history stay under kSeriesBound. There the
+        // result is within 2^-24 kSeriesBound of the antiderivative path
+        // (scripts/python/tanh_series_bound.py).
+        static constexpr double kSeriesBound = 0.1;
+        static void Series1Block(const double *x, double *y, const int n, const double x1) noexcept
+        {
+            Simd::kernels().tanhSeries1Block(x, y, n, x1);
+        }
+        static void Series2Block(const double *x, double *y, const int n, const double x1, const double x2) noexcept
+        {
+            Simd::kernels().tanhSeries2Block(x, y, n, x1, x2);
+        }
+    };
+
+    /// TanhNL in float, for AdaaPrecision::Economy. F1 is within 1.01 ulp
+    /// (float); ADAA1 picks its float threshold from Sample. No F2, so it
+    /// does not instantiate ADAA2.
+    struct TanhNLEconomy
+    {
+        static constexpr auto name = "tanh economy";
+        using Sample = float;
+        static float f(const float x) noexcept { return std::tanh(x); }
+        static float F1(const float x) noexcept { return Math::f1TanhF(x); }
     };
 
     struct AlgebraicNL
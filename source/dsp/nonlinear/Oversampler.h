@@ -0,0 +1,313 @@
+#pragma once
+
+#ifndef CHRONOS_OVERSAMPLER_H
+#define CHRONOS_OVERSAMPLER_H
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include "simd/Config.h"
+
+/**
+ * Polyphase half-band oversampling around a cheap tanh, the alternative
+ * to ADAA for the output saturator.
+ *
+ * Each stage is a linear-phase half-band of length 2D + 1, D odd: h[D] =
+ * 1/2 and every other odd tap is zero. Upsampling runs the D + 1 even taps
+ * on the input for the even output phase; the odd phase is a pure delay.
+ * Downsampling is the transpose. Nothing is ever zero-stuffed, and the
+ * symmetric taps are folded in pairs, so a stage costs (D + 1)/2 fused
+ * multiply-adds per 4 base-rate samples and direction. Both directions
+ * work on whole blocks over a linear history and vectorise across time.
+ *
+ * 2x runs stage A (D = 31). 4x adds stage B (D = 11) between 2x and 4x,
+ * plus one 2x-rate sample of delay so the total latency stays an integer.
+ * Taps come from scripts/python/halfband_design.py: 80 dB past the first
+ * image of 20 kHz at 48 kHz, under 0.001 dB of passband ripple.
+ */
+
+namespace MarsDSP::Nonlinear {
+    /// Stage A, fs <-> 2 fs: h[2i] for i < (D + 1)/2, D = 31.
+    inline constexpr std::array kHalfbandA = {
+        -2.18701534e-05f,
+         0.000102136066f,
+        -0.000278901513f,
+         0.000612418924f,
+        -0.00118228735f,
+         0.00208969577f,
+        -0.00346075906f,
+         0.00545329554f,
+        -0.00827194564f,
+         0.0122022368f,
+        -0.0176888704f,
+         0.0255271681f,
+        -0.0373923816f,
+         0.0576482564f,
+        -0.102394208f,
+         0.31705603f
+    };
+
+    /// Stage B, 2 fs <-> 4 fs: h[2i] for i < (D + 1)/2, D = 11.
+    inline constexpr std::array kHalfbandB = {
+        -3.85577223e-05f,
+         0.00122182141f,
+        -0.00728533091f,
+         0.0264086667f,
+        -0.0781272352f,
+         0.307820648f
+    };
+
+    /// tanh as the [7/6] Lambert continued fraction, clamped where it
+    /// reaches 1. Within 1e-4 of tanh everywhere (worst at the clamp) and
+    /// odd. Cheap enough to run at 4x.
+    namespace FastTanhCoeffs
+    {
+        constexpr float kClamp = 4.97178f;
+        constexpr float N0 = 135135.0f;
+        constexpr float N1 = 17325.0f;
+        constexpr float N2 = 378.0f;
+        constexpr float D0 = 135135.0f;
+        constexpr float D1 = 62370.0f;
+        constexpr float D2 = 3150.0f;
+        constexpr float D3 = 28.0f;
+    }
+
+    inline float fastTanh(const float x) noexcept
+    {
+        using namespace FastTanhCoeffs;
+        const float c = std::clamp(x, -kClamp, kClamp);
+        const float u = c * c;
+        const float num = c * (N0 + u * (N1 + u * (N2 + u)));
+        const float den = D0 + u * (D1 + u * (D2 + u * D3));
+        return std::clamp(num / den, -1.0f, 1.0f);
+    }
+
+    /// fastTanh across four lanes.
+    inline M128 fastTanh(const M128 x) noexcept
+    {
+        using namespace FastTanhCoeffs;
+        const M128 one = MM(set1_ps)(1.0f);
+        const M128 c = MM(max_ps)(MM(min_ps)(x, MM(set1_ps)(kClamp)), MM(set1_ps)(-kClamp));
+        const M128 u = MM(mul_ps)(c, c);
+        M128 num = MM(add_ps)(u, MM(set1_ps)(N2));
+        num = FMADD(u, num, MM(set1_ps)(N1));
+        num = MM(mul_ps)(c, FMADD(u, num, MM(set1_ps)(N0)));
+        M128 den = FMADD(u, MM(set1_ps)(D3), MM(set1_ps)(D2));
+        den = FMADD(u, den, MM(set1_ps)(D1));
+        den = FMADD(u, den, MM(set1_ps)(D0));
+        const M128 y = MM(div_ps)(num, den);
+        return MM(max_ps)(MM(min_ps)(y, one), MM(set1_ps)(-1.0f));
+    }
+
+    inline void fastTanhBlock(float *x, const int n) noexcept
+    {
+        int i = 0;
+        for (; i + 4 <= n; i += 4)
+            MM(storeu_ps)(x + i, fastTanh(MM(loadu_ps)(x + i)));
+        for (; i < n; ++i)
+            x[i] = fastTanh(x[i]);
+    }
+
+    namespace detail
+    {
+        /// sum_i taps[i] (hi[-i] + lo[i]) for four consecutive outputs.
+        template <const auto &Taps>
+        M128 foldedDot(const float *hi, const float *lo, const float scale) noexcept
+        {
+            M128 acc = MM(setzero_ps)();
+            for (std::size_t i = 0; i < Taps.size(); ++i)
+            {
+                const auto k = static_cast<std::ptrdiff_t>(i);
+                const M128 pair = MM(add_ps)(MM(loadu_ps)(hi - k), MM(loadu_ps)(lo + k));
+                acc = FMADD(MM(set1_ps)(scale * Taps[i]), pair, acc);
+            }
+            return acc;
+        }
+
+        template <const auto &Taps>
+        float foldedDot1(const float *hi, const float *lo, const float scale) noexcept
+        {
+            float acc = 0.0f;
+            for (std::size_t i = 0; i < Taps.size(); ++i)
+            {
+                const auto k = static_cast<std::ptrdiff_t>(i);
+                acc = std::fma(scale * Taps[i], hi[-k] + lo[k], acc);
+            }
+            return acc;
+        }
+    } // namespace detail
+
+    /// Half-band interpolator: n input samples to n even and n odd
+    /// output-phase samples. The output is x delayed by D samples at the
+    /// high rate. n <= MaxBlock.
+    template <const auto &Taps, int MaxBlock>
+    class HalfbandUp
+    {
+    public:
+        static constexpr int kHalf = static_cast<int>(Taps.size());
+        static constexpr int kD = 2 * kHalf - 1;
+
+        void reset() noexcept { buf_.fill(0.0f); }
+
+        void process(const float *x, float *even, float *odd, const int n) noexcept
+        {
+            assert(n >= 0 && n <= MaxBlock);
+            float *b = buf_.data();
+            std::memcpy(b + kD, x, static_cast<std::size_t>(n) * sizeof(float));
+
+            // even[m] = sum_j 2 h[2j] x[m - j]; taps j and D - j share h.
+            int m = 0;
+            for (; m + 4 <= n; m += 4)
+                MM(storeu_ps)(even + m, detail::foldedDot<Taps>(b + kD + m, b + m, 2.0f));
+            for (; m < n; ++m)
+                even[m] = detail::foldedDot1<Taps>(b + kD + m, b + m, 2.0f);
+
+            // odd[m] = x[m - (D - 1)/2].
+            std::memcpy(odd, b + kHalf, static_cast<std::size_t>(n) * sizeof(float));
+            std::memmove(b, b + n, static_cast<std::size_t>(kD) * sizeof(float));
+        }
+
+    private:
+        std::array<float, kD + MaxBlock> buf_{};
+    };
+
+    /// Half-band decimator, the transpose of HalfbandUp: n even and n odd
+    /// high-rate samples to n output samples, delayed by D high-rate
+    /// samples. n <= MaxBlock.
+    template <const auto &Taps, int MaxBlock>
+    class HalfbandDown
+    {
+    public:
+        static constexpr int kHalf = static_cast<int>(Taps.size());
+        static constexpr int kD = 2 * kHalf - 1;
+
+        void reset() noexcept
+        {
+            even_.fill(0.0f);
+            odd_.fill(0.0f);
+        }
+
+        void process(const float *even, const float *odd, float *y, const int n) noexcept
+        {
+            assert(n >= 0 && n <= MaxBlock);
+            float *e = even_.data();
+            float *o = odd_.data();
+            std::memcpy(e + kD, even, static_cast<std::size_t>(n) * sizeof(float));
+            std::memcpy(o + kHalf, odd, static_cast<std::size_t>(n) * sizeof(float));
+
+            // y[m] = odd[m - (D + 1)/2] / 2 + sum_j h[2j] even[m - j].
+            const M128 half = MM(set1_ps)(0.5f);
+            int m = 0;
+            for (; m + 4 <= n; m += 4)
+                MM(storeu_ps)(y + m, FMADD(half, MM(loadu_ps)(o + m),
+                                           detail::foldedDot<Taps>(e + kD + m, e + m, 1.0f)));
+            for (; m < n; ++m)
+                y[m] = std::fma(0.5f, o[m], detail::foldedDot1<Taps>(e + kD + m, e + m, 1.0f));
+
+            std::memmove(e, e + n, static_cast<std::size_t>(kD) * sizeof(float));
+            std::memmove(o, o + n, static_cast<std::size_t>(kHalf) * sizeof(float));
+        }
+
+    private:
+        std::array<float, kD + MaxBlock> even_{};
+        std::array<float, kHalf + MaxBlock> odd_{};
+    };
+
+    /// fastTanh at 2x or 4x, one channel, in place on blocks of up to
+    /// MaxBlock samples. The output is delayed by latencySamples(factor).
+    template <int MaxBlock>
+    class Oversampler
+    {
+    public:
+        using UpA = HalfbandUp<kHalfbandA, MaxBlock>;
+        using DownA = HalfbandDown<kHalfbandA, MaxBlock>;
+        using UpB = HalfbandUp<kHalfbandB, 2 * MaxBlock>;
+        using DownB = HalfbandDown<kHalfbandB, 2 * MaxBlock>;
+
+        [[nodiscard]] static constexpr int latencySamples(const int factor) noexcept
+        {
+            return factor >= 4 ? UpA::kD + (UpB::kD + 1) / 2 : (factor >= 2 ? UpA::kD : 0);
+        }
+
+        static constexpr int kMaxLatency = latencySamples(4);
+
+        void reset() noexcept
+        {
+            upA_.reset();
+            downA_.reset();
+            upB_.reset();
+            downB_.reset();
+            lagB_ = 0.0f;
+        }
+
+        /// 2 or 4. A change restarts the filters from silence.
+        void setFactor(const int factor) noexcept
+        {
+            assert(factor == 2 || factor == 4);
+            if (factor == factor_) return;
+            factor_ = factor;
+            reset();
+        }
+
+        [[nodiscard]] int getFactor() const noexcept { return factor_; }
+
+        void process(float *x, const int n) noexcept
+        {
+            assert(n >= 0 && n <= MaxBlock);
+            float *eA = evenA_.data();
+            float *oA = oddA_.data();
+            upA_.process(x, eA, oA, n);
+
+            if (factor_ == 2)
+            {
+                fastTanhBlock(eA, n);
+                fastTanhBlock(oA, n);
+            } else
+            {
+                float *s = stream_.data();
+                float *eB = evenB_.data();
+                float *oB = oddB_.data();
+                for (int m = 0; m < n; ++m)
+                {
+                    s[2 * m] = eA[m];
+                    s[2 * m + 1] = oA[m];
+                }
+                upB_.process(s, eB, oB, 2 * n);
+                fastTanhBlock(eB, 2 * n);
+                fastTanhBlock(oB, 2 * n);
+                downB_.process(eB, oB, s, 2 * n);
+
+                // Stage B delays by D_B (odd) at 2x; one more sample keeps
+                // the phases, and the latency, whole.
+                float lag = lagB_;
+                for (int m = 0; m < n; ++m)
+                {
+                    eA[m] = lag;
+                    oA[m] = s[2 * m];
+                    lag = s[2 * m + 1];
+                }
+                lagB_ = lag;
+            }
+
+            downA_.process(eA, oA, x, n);
+        }
+
+    private:
+        UpA upA_;
+        DownA downA_;
+        UpB upB_;
+        DownB downB_;
+        float lagB_{0.0f};
+        int factor_{2};
+
+        std::array<float, MaxBlock> evenA_{};
+        std::array<float, MaxBlock> oddA_{};
+        std::array<float, 2 * MaxBlock> stream_{};
+        std::array<float, 2 * MaxBlock> evenB_{};
+        std::array<float, 2 * MaxBlock> oddB_{};
+    };
+}
+#endif
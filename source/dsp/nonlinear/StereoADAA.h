@@ -0,0 +1,195 @@
+#pragma once
+
+#ifndef CHRONOS_STEREO_ADAA_H
+#define CHRONOS_STEREO_ADAA_H
+
+#include <array>
+#include <concepts>
+#include "ADAA1.h"
+#include "ADAA2.h"
+#include "math/TanhAntiderivatives.h"
+#include "simd/Config.h"
+
+/**
+ * ADAA1 and ADAA2 with L and R in the two lanes of an M128D.
+ * The well-conditioned difference quotients run packed, and so do the
+ * antiderivatives where the NL has packed overloads. When either lane needs an ill-conditioned branch, both lanes
+ * go through the scalar step, so each lane matches a scalar ADAA1/ADAA2
+ * bit for bit. The one-argument process() runs the left lane alone, for
+ * mono.
+ */
+
+namespace MarsDSP::Nonlinear {
+    namespace detail
+    {
+        template <typename NL>
+        concept PackedAntiderivatives = requires(M128D v)
+        {
+            { NL::F1(v) } -> std::same_as<M128D>;
+            { NL::F2(v) } -> std::same_as<M128D>;
+        };
+
+        inline M128D absPd(const M128D x) noexcept
+        {
+            return MM(andnot_pd)(MM(set1_pd)(-0.0), x);
+        }
+
+        // True if |v| < eps in either lane.
+        inline bool anyBelow(const M128D v, const double eps) noexcept
+        {
+            return MM(movemask_pd)(MM(cmplt_pd)(absPd(v), MM(set1_pd)(eps))) != 0;
+        }
+
+        template <typename NL, int Order>
+        inline M128D antiderivativePair(const M128D x) noexcept
+        {
+            if constexpr (PackedAntiderivatives<NL>)
+            {
+                if constexpr (Order == 1) return NL::F1(x);
+                else return NL::F2(x);
+            } else
+            {
+                const double l = Math::detail::lane0(x);
+                const double r = Math::detail::lane1(x);
+                if constexpr (Order == 1) return MM(set_pd)(NL::F1(r), NL::F1(l));
+                else return MM(set_pd)(NL::F2(r), NL::F2(l));
+            }
+        }
+    } // namespace detail
+
+    template <typename NL>
+    class StereoADAA1 {
+    public:
+        void reset() noexcept
+        {
+            x1_.fill(0.0);
+            F1x1_.fill(0.0);
+        }
+
+        /// One stereo sample, in place.
+        void process(double &l, double &r) noexcept
+        {
+            const M128D x0 = MM(set_pd)(r, l);
+            const M128D F1x0 = detail::antiderivativePair<NL, 1>(x0);
+            const M128D x1 = MM(load_pd)(x1_.data());
+            const M128D dx = MM(sub_pd)(x0, x1);
+
+            if (detail::anyBelow(dx, ADAA1<NL>::kEps))
+            {
+                l = ADAA1<NL>::step(l, Math::detail::lane0(F1x0), x1_[0], F1x1_[0]);
+                r = ADAA1<NL>::step(r, Math::detail::lane1(F1x0), x1_[1], F1x1_[1]);
+                return;
+            }
+
+            const M128D y = MM(div_pd)(MM(sub_pd)(F1x0, MM(load_pd)(F1x1_.data())), dx);
+            MM(store_pd)(x1_.data(), x0);
+            MM(store_pd)(F1x1_.data(), F1x0);
+            l = Math::detail::lane0(y);
+            r = Math::detail::lane1(y);
+        }
+
+        /// Left lane only.
+        double process(double x0) noexcept
+        {
+            return ADAA1<NL>::step(x0, NL::F1(x0), x1_[0], F1x1_[0]);
+        }
+
+        /// ADAA1::trySeriesBlock on both lanes, or the left lane alone when
+        /// xr is null. Both lanes must be quiet.
+        bool trySeriesBlock(const double *xl, const double *xr, double *yl, double *yr, const int n) noexcept
+            requires SeriesNL<NL>
+        {
+            if (n <= 0 || !underSeriesBound(xl, n, NL::kSeriesBound, x1_[0])) return false;
+            if (xr && !underSeriesBound(xr, n, NL::kSeriesBound, x1_[1])) return false;
+            NL::Series1Block(xl, yl, n, x1_[0]);
+            ADAA1<NL>::seriesHandOff(xl[n - 1], x1_[0], F1x1_[0]);
+            if (xr)
+            {
+                NL::Series1Block(xr, yr, n, x1_[1]);
+                ADAA1<NL>::seriesHandOff(xr[n - 1], x1_[1], F1x1_[1]);
+            }
+            return true;
+        }
+
+    private:
+        alignas(16) std::array<double, 2> x1_{};
+        alignas(16) std::array<double, 2> F1x1_{};
+    };
+
+    template <typename NL>
+    class StereoADAA2 {
+    public:
+        static constexpr double kLatencySamples = ADAA2<NL>::kLatencySamples;
+
+        void reset() noexcept
+        {
+            x1_.fill(0.0);
+            x2_.fill(0.0);
+            F2x1_.fill(0.0);
+            d2_.fill(0.0);
+        }
+
+        /// One stereo sample, in place.
+        void process(double &l, double &r) noexcept
+        {
+            const M128D x0 = MM(set_pd)(r, l);
+            const M128D F2x0 = detail::antiderivativePair<NL, 2>(x0);
+            const M128D x1 = MM(load_pd)(x1_.data());
+            const M128D x2 = MM(load_pd)(x2_.data());
+            const M128D d01 = MM(sub_pd)(x0, x1);
+            const M128D d02 = MM(sub_pd)(x0, x2);
+
+            // A below kEpsInner or C below kEpsOuter in either lane: the
+            // midpoint branches, lane by lane.
+            if (detail::anyBelow(d01, ADAA2<NL>::kEpsInner) || detail::anyBelow(d02, ADAA2<NL>::kEpsOuter))
+            {
+                l = ADAA2<NL>::step(l, Math::detail::lane0(F2x0), x1_[0], x2_[0], F2x1_[0], d2_[0]);
+                r = ADAA2<NL>::step(r, Math::detail::lane1(F2x0), x1_[1], x2_[1], F2x1_[1], d2_[1]);
+                return;
+            }
+
+            const M128D d1 = MM(div_pd)(MM(sub_pd)(F2x0, MM(load_pd)(F2x1_.data())), d01);
+            const M128D num = MM(mul_pd)(MM(set1_pd)(2.0), MM(sub_pd)(d1, MM(load_pd)(d2_.data())));
+            const M128D y = MM(div_pd)(num, d02);
+
+            MM(store_pd)(x2_.data(), x1);
+            MM(store_pd)(x1_.data(), x0);
+            MM(store_pd)(F2x1_.data(), F2x0);
+            MM(store_pd)(d2_.data(), d1);
+            l = Math::detail::lane0(y);
+            r = Math::detail::lane1(y);
+        }
+
+        /// Left lane only.
+        double process(double x0) noexcept
+        {
+            return ADAA2<NL>::step(x0, NL::F2(x0), x1_[0], x2_[0], F2x1_[0], d2_[0]);
+        }
+
+        /// ADAA2::trySeriesBlock on both lanes, or the left lane alone when
+        /// xr is null. Both lanes must be quiet.
+        bool trySeriesBlock(const double *xl, const double *xr, double *yl, double *yr, const int n) noexcept
+            requires SeriesNL<NL>
+        {
+            if (n <= 0 || !underSeriesBound(xl, n, NL::kSeriesBound, x1_[0], x2_[0])) return false;
+            if (xr && !underSeriesBound(xr, n, NL::kSeriesBound, x1_[1], x2_[1])) return false;
+            seriesLane_(xl, yl, n, 0);
+            if (xr) seriesLane_(xr, yr, n, 1);
+            return true;
+        }
+
+    private:
+        void seriesLane_(const double *x, double *y, const int n, const std::size_t lane) noexcept
+        {
+            NL::Series2Block(x, y, n, x1_[lane], x2_[lane]);
+            ADAA2<NL>::seriesHandOff(x[n - 1], n > 1 ? x[n - 2] : x1_[lane],
+                                     x1_[lane], x2_[lane], F2x1_[lane], d2_[lane]);
+        }
+
+        alignas(16) std::array<double, 2> x1_{};
+        alignas(16) std::array<double, 2> x2_{};
+        alignas(16) std::array<double, 2> F2x1_{};
+        alignas(16) std::array<double, 2> d2_{};
+    };
+}
+#endif
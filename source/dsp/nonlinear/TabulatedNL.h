@@ -0,0 +1,215 @@
+#pragma once
+
+#ifndef CHRONOS_TABULATED_NL_H
+#define CHRONOS_TABULATED_NL_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+/**
+ * ADAA antiderivatives for any static curve, from a table.
+ *
+ * TabulatedNL<Curve> fits f on a uniform grid over [-Curve::kRange,
+ * Curve::kRange] with cubic Hermite pieces, then integrates each piece
+ * twice in closed form. A piece is stored as the quintic F2 in the local
+ * coordinate t = (x - x_j)/h; F1 and f are its first and second
+ * derivatives. f, F1 and F2 are therefore exact antiderivatives of one
+ * another, and ADAA1/ADAA2 over the table are exact ADAA of the fitted
+ * curve. Per sample the cost is one clamp, one index and a Horner
+ * polynomial, whatever the curve. Beyond the range f is held at its edge
+ * value, and F1/F2 continue as its linear and quadratic antiderivatives.
+ *
+ * Curve provides name, kRange and a static f(double). It may also provide
+ * df(double); otherwise the node slopes come from a five-point difference.
+ * F1(0) = F2(0) = 0. Call prepare() off the audio thread before first use;
+ * it builds the table once per Curve.
+ */
+
+namespace MarsDSP::Nonlinear {
+    template <typename Curve, int Intervals = 1024>
+    struct TabulatedNL
+    {
+        static_assert(Intervals >= 2 && Intervals % 2 == 0, "x = 0 must be a node");
+
+        static constexpr auto name = Curve::name;
+        static constexpr double kRange = Curve::kRange;
+        static constexpr double kStep = 2.0 * kRange / Intervals;
+        static constexpr double kInvStep = Intervals / (2.0 * kRange);
+
+        static void prepare() { (void) table_(); }
+
+        static double f(const double x) noexcept
+        {
+            const Piece p = locate_(x);
+            const Row &c = *p.row;
+            return kInvStep * kInvStep * (2.0 * c[2] + p.t * (6.0 * c[3] + p.t * (12.0 * c[4] + p.t * (20.0 * c[5]))));
+        }
+
+        static double F1(const double x) noexcept
+        {
+            const Piece p = locate_(x);
+            const Row &c = *p.row;
+            double y = kInvStep * (c[1] + p.t * (2.0 * c[2] + p.t * (3.0 * c[3] + p.t * (4.0 * c[4] + p.t * (5.0 * c[5])))));
+            if (p.e != 0.0) [[unlikely]]
+                y += p.e * f(p.xc);
+            return y;
+        }
+
+        static double F2(const double x) noexcept
+        {
+            const Piece p = locate_(x);
+            const Row &c = *p.row;
+            double y = c[0] + p.t * (c[1] + p.t * (c[2] + p.t * (c[3] + p.t * (c[4] + p.t * c[5]))));
+            if (p.e != 0.0) [[unlikely]]
+                y += p.e * (F1(p.xc) + 0.5 * p.e * f(p.xc));
+            return y;
+        }
+
+    private:
+        // F2 on one piece, coefficients of t^0..t^5.
+        using Row = std::array<double, 6>;
+        using Table = std::array<Row, Intervals>;
+
+        struct Piece
+        {
+            const Row *row;
+            double t;  // in [0, 1]
+            double xc; // x clamped to the range
+            double e;  // x - xc; NaN propagates through it
+        };
+
+        static Piece locate_(const double x) noexcept
+        {
+            // fmin/fmax send NaN to the edge; e carries it on.
+            const double xc = std::fmin(std::fmax(x, -kRange), kRange);
+            const double s = (xc + kRange) * kInvStep;
+            const int j = std::min(static_cast<int>(s), Intervals - 1);
+            return {&table_()[static_cast<std::size_t>(j)], s - j, xc, x - xc};
+        }
+
+        static double slope_(const double x) noexcept
+        {
+            if constexpr (requires { Curve::df(x); })
+                return Curve::df(x);
+            else
+            {
+                constexpr double d = 1e-4;
+                return (Curve::f(x - 2.0 * d) - 8.0 * Curve::f(x - d) + 8.0 * Curve::f(x + d) - Curve::f(x + 2.0 * d))
+                       / (12.0 * d);
+            }
+        }
+
+        static std::unique_ptr<Table> build_()
+        {
+            auto table = std::make_unique<Table>();
+            const double h = kStep;
+
+            std::vector<double> fv(Intervals + 1);
+            std::vector<double> dv(Intervals + 1);
+            for (int j = 0; j <= Intervals; ++j)
+            {
+                const double x = -kRange + h * j;
+                fv[static_cast<std::size_t>(j)] = Curve::f(x);
+                dv[static_cast<std::size_t>(j)] = h * slope_(x);
+            }
+
+            // Hermite piece a0 + a1 t + a2 t^2 + a3 t^3 for f on [x_j, x_j+1].
+            auto hermite = [&](const int j)
+            {
+                const auto u = static_cast<std::size_t>(j);
+                const double f0 = fv[u], f1 = fv[u + 1], d0 = dv[u], d1 = dv[u + 1];
+                return std::array<double, 4>{f0, d0, 3.0 * (f1 - f0) - 2.0 * d0 - d1, 2.0 * (f0 - f1) + d0 + d1};
+            };
+            // Growth of F1 and of F2 - h F1(x_j) across a piece.
+            auto dF1 = [&](const std::array<double, 4> &a) { return h * (a[0] + a[1] / 2.0 + a[2] / 3.0 + a[3] / 4.0); };
+            auto dF2 = [&](const std::array<double, 4> &a) { return h * h * (a[0] / 2.0 + a[1] / 6.0 + a[2] / 12.0 + a[3] / 20.0); };
+
+            // Node values of F1 and F2, integrated outwards from x = 0.
+            std::vector<double> F1v(Intervals + 1);
+            std::vector<double> F2v(Intervals + 1);
+            constexpr int mid = Intervals / 2;
+            for (int j = mid; j < Intervals; ++j)
+            {
+                const auto a = hermite(j);
+                const auto u = static_cast<std::size_t>(j);
+                F1v[u + 1] = F1v[u] + dF1(a);
+                F2v[u + 1] = F2v[u] + h * F1v[u] + dF2(a);
+            }
+            for (int j = mid - 1; j >= 0; --j)
+            {
+                const auto a = hermite(j);
+                const auto u = static_cast<std::size_t>(j);
+                F1v[u] = F1v[u + 1] - dF1(a);
+                F2v[u] = F2v[u + 1] - h * F1v[u] - dF2(a);
+            }
+
+            for (int j = 0; j < Intervals; ++j)
+            {
+                const auto a = hermite(j);
+                const auto u = static_cast<std::size_t>(j);
+                (*table)[u] = {F2v[u], h * F1v[u], h * h * a[0] / 2.0, h * h * a[1] / 6.0,
+                               h * h * a[2] / 12.0, h * h * a[3] / 20.0};
+            }
+            return table;
+        }
+
+        static const Table &table_() noexcept
+        {
+            static const std::unique_ptr<Table> table = build_();
+            return *table;
+        }
+    };
+
+    /// tanh through the table, to compare it against TanhNL's fitted kernels.
+    struct TanhCurve
+    {
+        static constexpr auto name = "tanh (tabulated)";
+        static constexpr double kRange = 16.0;
+        static double f(const double x) noexcept { return std::tanh(x); }
+        static double df(const double x) noexcept
+        {
+            const double t = std::tanh(x);
+            return 1.0 - t * t;
+        }
+    };
+
+    /// Biased tanh, the transfer curve of a single-ended triode stage: the
+    /// offset operating point makes it asymmetric, so it adds even
+    /// harmonics. Shifted so f(0) = 0; saturates at 1 - tanh(b) and
+    /// -1 - tanh(b).
+    struct TubeCurve
+    {
+        static constexpr auto name = "tube";
+        static constexpr double kRange = 16.0;
+        static constexpr double kBias = 0.25;
+        static double f(const double x) noexcept { return std::tanh(x + kBias) - std::tanh(kBias); }
+        static double df(const double x) noexcept
+        {
+            const double t = std::tanh(x + kBias);
+            return 1.0 - t * t;
+        }
+    };
+
+    /// Asymmetric diode pair: exponential knees with unit slope at zero,
+    /// clipping at +1 and at -kKnee. The two sides' curvature differs, so
+    /// f is C1 at zero; x = 0 is a table node, so the fit stays exact to
+    /// fourth order on each side.
+    struct DiodeCurve
+    {
+        static constexpr auto name = "diode";
+        static constexpr double kRange = 16.0;
+        static constexpr double kKnee = 0.6;
+        static double f(const double x) noexcept
+        {
+            return x >= 0.0 ? -std::expm1(-x) : kKnee * std::expm1(x / kKnee);
+        }
+        static double df(const double x) noexcept
+        {
+            return x >= 0.0 ? std::exp(-x) : std::exp(x / kKnee);
+        }
+    };
+}
+#endif
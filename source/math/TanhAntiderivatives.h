@@ -7,6 +7,7 @@
 #include <cmath>
 
 #include "math/Dilogarithm.h"
+#include "simd/Config.h"
 
 /**
  * Regional minimax kernels for the tanh antiderivatives F1 and F2.
@@ -14,6 +15,7 @@
  * Three regions with crossovers a0 = 1 and a1 = 19. See dsp-notes.md
  * for the derivation and the seam and evaluation reasoning.
  * Coefficients are derived and checked by scripts/python/remez_*.py.
+ * f1TanhF is the float twin for the economy ADAA precision.
  */
 
 namespace MarsDSP::Math
@@ -147,6 +149,46 @@ namespace MarsDSP::Math
             const double r0 = std::fma(q1, u4, q0);
             return std::fma(q2, u8, r0);
         }
+
+        // estrin15 on two lanes. FMADD_PD is fused, so each lane matches
+        // the scalar evaluation bit for bit.
+        inline M128D estrin15Pair(const std::array<double, 15> &c, const M128D u) noexcept
+        {
+            const auto k = [&c](int i) { return MM(set1_pd)(c[static_cast<std::size_t>(i)]); };
+            const M128D u2 = MM(mul_pd)(u, u);
+            const M128D u4 = MM(mul_pd)(u2, u2);
+            const M128D u8 = MM(mul_pd)(u4, u4);
+            const M128D p0 = FMADD_PD(k(1), u, k(0));
+            const M128D p1 = FMADD_PD(k(3), u, k(2));
+            const M128D p2 = FMADD_PD(k(5), u, k(4));
+            const M128D p3 = FMADD_PD(k(7), u, k(6));
+            const M128D p4 = FMADD_PD(k(9), u, k(8));
+            const M128D p5 = FMADD_PD(k(11), u, k(10));
+            const M128D p6 = FMADD_PD(k(13), u, k(12));
+            const M128D p7 = k(14);
+            const M128D q0 = FMADD_PD(p1, u2, p0);
+            const M128D q1 = FMADD_PD(p3, u2, p2);
+            const M128D q2 = FMADD_PD(p5, u2, p4);
+            const M128D q3 = FMADD_PD(p7, u2, p6);
+            const M128D r0 = FMADD_PD(q1, u4, q0);
+            const M128D r1 = FMADD_PD(q3, u4, q2);
+            return FMADD_PD(r1, u8, r0);
+        }
+
+        inline double lane0(const M128D v) noexcept { return MM(cvtsd_f64)(v); }
+        inline double lane1(const M128D v) noexcept { return MM(cvtsd_f64)(MM(unpackhi_pd)(v, v)); }
+
+        // True when both lanes are in region I. Without simde FMADD_PD is
+        // not fused, so the pair kernels stay lane by lane.
+        inline bool pairInRegionI([[maybe_unused]] const M128D x) noexcept
+        {
+#ifdef SIMDE_UNAVAILABLE
+            return false;
+#else
+            const M128D a = MM(andnot_pd)(MM(set1_pd)(-0.0), x);
+            return MM(movemask_pd)(MM(cmple_pd)(a, MM(set1_pd)(kTanA0))) == 3;
+#endif
+        }
     } // namespace detail
 
     /// F2(x) = integral of ln cosh. Odd. F2(0) is exactly zero.
@@ -191,6 +233,96 @@ namespace MarsDSP::Math
         return h;
     }
 
+    /// F2 on two lanes, bit-identical to f2Tanh per lane. Region I runs
+    /// packed; anything else goes lane by lane, where std::exp dominates.
+    inline M128D f2TanhPair(const M128D x) noexcept
+    {
+        if (detail::pairInRegionI(x))
+        {
+            const M128D u = MM(mul_pd)(x, x);
+            return MM(mul_pd)(MM(mul_pd)(x, u), detail::estrin15Pair(kF2RegionI, u));
+        }
+        return MM(set_pd)(f2Tanh(detail::lane1(x)), f2Tanh(detail::lane0(x)));
+    }
+
+    /// F1 on two lanes, bit-identical to f1Tanh per lane.
+    inline M128D f1TanhPair(const M128D x) noexcept
+    {
+        if (detail::pairInRegionI(x))
+        {
+            const M128D u = MM(mul_pd)(x, x);
+            return MM(mul_pd)(u, detail::estrin15Pair(kF1RegionI, u));
+        }
+        return MM(set_pd)(f1Tanh(detail::lane1(x)), f1Tanh(detail::lane0(x)));
+    }
+
+    // Economy kernel: F1's regions in float, for ADAA1 run in float
+    // (TanhNLEconomy). Region III starts at 9 here: the dropped term sits
+    // below 2^-28 relative. Coefficients, a1 and the float ADAA1 threshold
+    // come from scripts/python/remez_tanh_economy.py. Within 1.01 ulp.
+    inline constexpr float kTanA0F = 1.0f;
+    inline constexpr float kTanA1F = 9.0f;
+    inline constexpr float kTanLn2HiF = 0.693147182f; // 0x1.62e43p-1
+    inline constexpr float kTanLn2LoF = -1.90465421e-09f;
+
+    // S(u), degree 6. F1(x) = u*S(u), u = x^2, |x| <= 1.
+    inline constexpr std::array<float, 7> kF1RegionIF{
+        {
+            0.5f, -0.0833329707f, 0.0222162753f, -0.00670901081f,
+            0.0020743066f, -0.000553270394f, 8.55027611e-05f,
+        }
+    };
+
+    // L(t), degree 4 on [0, e^-2].
+    inline constexpr std::array<float, 5> kF1RegionIILF{
+        {1.0f, -0.4999955f, 0.333069831f, -0.244514644f, 0.151864752f}
+    };
+
+    namespace detail
+    {
+        // Estrin evaluation, degree 6, depth 3.
+        inline float estrin7(const std::array<float, 7> &c, float u) noexcept
+        {
+            const float u2 = u * u;
+            const float u4 = u2 * u2;
+            const float p0 = std::fma(c[1], u, c[0]);
+            const float p1 = std::fma(c[3], u, c[2]);
+            const float p2 = std::fma(c[5], u, c[4]);
+            const float q0 = std::fma(p1, u2, p0);
+            const float q1 = std::fma(c[6], u2, p2);
+            return std::fma(q1, u4, q0);
+        }
+
+        // Estrin evaluation, degree 4, depth 3.
+        inline float estrin5(const std::array<float, 5> &c, float u) noexcept
+        {
+            const float u2 = u * u;
+            const float u4 = u2 * u2;
+            const float p0 = std::fma(c[1], u, c[0]);
+            const float p1 = std::fma(c[3], u, c[2]);
+            const float q0 = std::fma(p1, u2, p0);
+            return std::fma(c[4], u4, q0);
+        }
+    } // namespace detail
+
+    /// f1Tanh in float. Even and non-negative; F1(0) is exactly zero.
+    inline float f1TanhF(const float x) noexcept
+    {
+        const float a = std::fabs(x);
+        if (a <= kTanA0F)
+        {
+            const float u = x * x;
+            return u * detail::estrin7(kF1RegionIF, u);
+        }
+        const float h = (a - kTanLn2HiF) - kTanLn2LoF;
+        if (a < kTanA1F)
+        {
+            const float t = std::exp(-2.0f * a);
+            return std::fma(t, detail::estrin5(kF1RegionIILF, t), h);
+        }
+        return h;
+    }
+
     // Reference twins for the test oracle. Keep them; do not optimize.
     namespace Ref
     {
@@ -0,0 +1,294 @@
+#pragma once
+
+#ifndef CHRONOS_SIMD_BATCH_H
+#define CHRONOS_SIMD_BATCH_H
+
+/**
+ * Width-generic float batches for the dispatched kernels.
+ * Batch4 wraps the 128-bit layer from Config.h. Batch8 (AVX2 + FMA) and
+ * Batch16 (AVX-512F) exist only under CHRONOS_SIMD_WIDE_DISPATCH and carry
+ * per-function target attributes, so they build without -mavx2/-mavx512f
+ * and must only run after Dispatch.h has reported the tier.
+ * Every batch exposes the same static operations, so one kernel body
+ * serves all three widths and does the same per-lane arithmetic in each.
+ * The ...D operations run double lanes, kWidthD = kWidth / 2 per register.
+ */
+
+#include "simd/Config.h"
+#include "simd/Dispatch.h"
+
+#include <cstdint>
+
+#ifdef CHRONOS_SIMD_WIDE_DISPATCH
+#include <immintrin.h>
+#endif
+
+// Target regions for the wide tiers. MSVC emits any intrinsic without them.
+#ifdef CHRONOS_SIMD_WIDE_DISPATCH
+#if defined(__clang__)
+#define CHRONOS_SIMD_TARGET_AVX2_BEGIN \
+    _Pragma("clang attribute push(__attribute__((target(\"avx2,fma\"))), apply_to = function)")
+#define CHRONOS_SIMD_TARGET_AVX512_BEGIN \
+    _Pragma("clang attribute push(__attribute__((target(\"avx512f,avx2,fma\"))), apply_to = function)")
+#define CHRONOS_SIMD_TARGET_END _Pragma("clang attribute pop")
+#elif defined(__GNUC__)
+#define CHRONOS_SIMD_TARGET_AVX2_BEGIN \
+    _Pragma("GCC push_options") _Pragma("GCC target(\"avx2,fma\")")
+#define CHRONOS_SIMD_TARGET_AVX512_BEGIN \
+    _Pragma("GCC push_options") _Pragma("GCC target(\"avx512f,avx2,fma\")")
+#define CHRONOS_SIMD_TARGET_END _Pragma("GCC pop_options")
+#else
+#define CHRONOS_SIMD_TARGET_AVX2_BEGIN
+#define CHRONOS_SIMD_TARGET_AVX512_BEGIN
+#define CHRONOS_SIMD_TARGET_END
+#endif
+#endif
+
+namespace MarsDSP::Simd
+{
+    /// 128-bit batch over the MM() layer. Also the tail width of the wide tiers.
+    struct Batch4
+    {
+        static constexpr int kWidth = 4;
+        using F = M128;
+        using I = M128I;
+        using Mask = M128;
+
+        static F load(const float *p) noexcept { return MM(loadu_ps)(p); }
+        static void store(float *p, const F v) noexcept { MM(storeu_ps)(p, v); }
+        static F set1(const float x) noexcept { return MM(set1_ps)(x); }
+        static F zero() noexcept { return MM(setzero_ps)(); }
+        static F add(const F a, const F b) noexcept { return MM(add_ps)(a, b); }
+        static F sub(const F a, const F b) noexcept { return MM(sub_ps)(a, b); }
+        static F mul(const F a, const F b) noexcept { return MM(mul_ps)(a, b); }
+        static F div(const F a, const F b) noexcept { return MM(div_ps)(a, b); }
+        static F fmadd(const F a, const F b, const F c) noexcept { return FMADD(a, b, c); }
+
+        /// All-ones lanes where x is neither NaN nor ±inf.
+        static Mask finite(const F x) noexcept { return MM(cmpeq_ps)(MM(sub_ps)(x, x), zero()); }
+        static Mask both(const Mask a, const Mask b) noexcept { return MM(and_ps)(a, b); }
+        /// x where m is set, +0.0f elsewhere.
+        static F keep(const Mask m, const F x) noexcept { return MM(and_ps)(m, x); }
+        static F abs(const F x) noexcept { return MM(andnot_ps)(MM(set1_ps)(-0.0f), x); }
+        /// b where either lane is NaN, as maxps.
+        static F max(const F a, const F b) noexcept { return MM(max_ps)(a, b); }
+
+        /// Round half away from zero: truncate q + copysign(0.5, q).
+        static F roundHalfAway(const F q) noexcept
+        {
+            const F sign = MM(and_ps)(q, MM(set1_ps)(-0.0f));
+            const F shifted = MM(add_ps)(q, MM(or_ps)(MM(set1_ps)(0.5f), sign));
+            return MM(cvtepi32_ps)(MM(cvttps_epi32)(shifted));
+        }
+
+        static I loadI(const std::uint32_t *p) noexcept { return MM(loadu_si128)(reinterpret_cast<const M128I *>(p)); }
+        static void storeI(std::uint32_t *p, const I v) noexcept { MM(storeu_si128)(reinterpret_cast<M128I *>(p), v); }
+        static I xorI(const I a, const I b) noexcept { return MM(xor_si128)(a, b); }
+        template <int N> static I shl(const I a) noexcept { return MM(slli_epi32)(a, N); }
+        template <int N> static I shr(const I a) noexcept { return MM(srli_epi32)(a, N); }
+        static F toFloat(const I a) noexcept { return MM(cvtepi32_ps)(a); }
+
+        // Double lanes, half as many per register, for the tanh antiderivatives.
+        static constexpr int kWidthD = 2;
+        using D = M128D;
+        using MaskD = M128D;
+
+        static D loadD(const double *p) noexcept { return MM(loadu_pd)(p); }
+        static void storeD(double *p, const D v) noexcept { MM(storeu_pd)(p, v); }
+        static D set1D(const double x) noexcept { return MM(set1_pd)(x); }
+        static D addD(const D a, const D b) noexcept { return MM(add_pd)(a, b); }
+        static D subD(const D a, const D b) noexcept { return MM(sub_pd)(a, b); }
+        static D mulD(const D a, const D b) noexcept { return MM(mul_pd)(a, b); }
+        static D fmaddD(const D a, const D b, const D c) noexcept { return FMADD_PD(a, b, c); }
+        static D minD(const D a, const D b) noexcept { return MM(min_pd)(a, b); }
+        static D absD(const D x) noexcept { return MM(andnot_pd)(MM(set1_pd)(-0.0), x); }
+        /// x with the sign bit of s flipped in.
+        static D flipSignD(const D x, const D s) noexcept { return MM(xor_pd)(x, MM(and_pd)(s, MM(set1_pd)(-0.0))); }
+        static MaskD lessD(const D a, const D b) noexcept { return MM(cmplt_pd)(a, b); }
+        static MaskD lessEqD(const D a, const D b) noexcept { return MM(cmple_pd)(a, b); }
+        /// a where m is set, b elsewhere.
+        static D selectD(const MaskD m, const D a, const D b) noexcept
+        {
+            return MM(or_pd)(MM(and_pd)(m, a), MM(andnot_pd)(m, b));
+        }
+        /// 2^n, where k = n + 0x1.8p52 holds n in its low mantissa bits.
+        static D pow2D(const D k) noexcept
+        {
+            const M128I e = MM(add_epi64)(MM(castpd_si128)(k), MM(set1_epi64x)(1023));
+            return MM(castsi128_pd)(MM(slli_epi64)(e, 52));
+        }
+    };
+}
+
+#ifdef CHRONOS_SIMD_WIDE_DISPATCH
+CHRONOS_SIMD_TARGET_AVX2_BEGIN
+namespace MarsDSP::Simd
+{
+    /// 256-bit batch, AVX2 + FMA.
+    struct Batch8
+    {
+        static constexpr int kWidth = 8;
+        using F = __m256;
+        using I = __m256i;
+        using Mask = __m256;
+
+        static F load(const float *p) noexcept { return _mm256_loadu_ps(p); }
+        static void store(float *p, const F v) noexcept { _mm256_storeu_ps(p, v); }
+        static F set1(const float x) noexcept { return _mm256_set1_ps(x); }
+        static F zero() noexcept { return _mm256_setzero_ps(); }
+        static F add(const F a, const F b) noexcept { return _mm256_add_ps(a, b); }
+        static F sub(const F a, const F b) noexcept { return _mm256_sub_ps(a, b); }
+        static F mul(const F a, const F b) noexcept { return _mm256_mul_ps(a, b); }
+        static F div(const F a, const F b) noexcept { return _mm256_div_ps(a, b); }
+#ifndef SIMDE_UNAVAILABLE
+        static F fmadd(const F a, const F b, const F c) noexcept { return _mm256_fmadd_ps(a, b, c); }
+#else
+        // Mirrors Config.h's FMADD fallback so every width rounds alike.
+        static F fmadd(const F a, const F b, const F c) noexcept { return _mm256_add_ps(_mm256_mul_ps(a, b), c); }
+#endif
+
+        static Mask finite(const F x) noexcept { return _mm256_cmp_ps(_mm256_sub_ps(x, x), zero(), _CMP_EQ_OQ); }
+        static Mask both(const Mask a, const Mask b) noexcept { return _mm256_and_ps(a, b); }
+        static F keep(const Mask m, const F x) noexcept { return _mm256_and_ps(m, x); }
+        static F abs(const F x) noexcept { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x); }
+        static F max(const F a, const F b) noexcept { return _mm256_max_ps(a, b); }
+
+        static F roundHalfAway(const F q) noexcept
+        {
+            const F sign = _mm256_and_ps(q, _mm256_set1_ps(-0.0f));
+            const F shifted = _mm256_add_ps(q, _mm256_or_ps(_mm256_set1_ps(0.5f), sign));
+            return _mm256_cvtepi32_ps(_mm256_cvttps_epi32(shifted));
+        }
+
+        static I loadI(const std::uint32_t *p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+        static void storeI(std::uint32_t *p, const I v) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v); }
+        static I xorI(const I a, const I b) noexcept { return _mm256_xor_si256(a, b); }
+        template <int N> static I shl(const I a) noexcept { return _mm256_slli_epi32(a, N); }
+        template <int N> static I shr(const I a) noexcept { return _mm256_srli_epi32(a, N); }
+        static F toFloat(const I a) noexcept { return _mm256_cvtepi32_ps(a); }
+
+        static constexpr int kWidthD = 4;
+        using D = __m256d;
+        using MaskD = __m256d;
+
+        static D loadD(const double *p) noexcept { return _mm256_loadu_pd(p); }
+        static void storeD(double *p, const D v) noexcept { _mm256_storeu_pd(p, v); }
+        static D set1D(const double x) noexcept { return _mm256_set1_pd(x); }
+        static D addD(const D a, const D b) noexcept { return _mm256_add_pd(a, b); }
+        static D subD(const D a, const D b) noexcept { return _mm256_sub_pd(a, b); }
+        static D mulD(const D a, const D b) noexcept { return _mm256_mul_pd(a, b); }
+#ifndef SIMDE_UNAVAILABLE
+        static D fmaddD(const D a, const D b, const D c) noexcept { return _mm256_fmadd_pd(a, b, c); }
+#else
+        static D fmaddD(const D a, const D b, const D c) noexcept { return _mm256_add_pd(_mm256_mul_pd(a, b), c); }
+#endif
+        static D minD(const D a, const D b) noexcept { return _mm256_min_pd(a, b); }
+        static D absD(const D x) noexcept { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), x); }
+        static D flipSignD(const D x, const D s) noexcept
+        {
+            return _mm256_xor_pd(x, _mm256_and_pd(s, _mm256_set1_pd(-0.0)));
+        }
+        static MaskD lessD(const D a, const D b) noexcept { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+        static MaskD lessEqD(const D a, const D b) noexcept { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+        static D selectD(const MaskD m, const D a, const D b) noexcept { return _mm256_blendv_pd(b, a, m); }
+        static D pow2D(const D k) noexcept
+        {
+            const __m256i e = _mm256_add_epi64(_mm256_castpd_si256(k), _mm256_set1_epi64x(1023));
+            return _mm256_castsi256_pd(_mm256_slli_epi64(e, 52));
+        }
+    };
+}
+CHRONOS_SIMD_TARGET_END
+
+CHRONOS_SIMD_TARGET_AVX512_BEGIN
+namespace MarsDSP::Simd
+{
+    /// 512-bit batch, AVX-512F only (no DQ/VL), so float logic goes through
+    /// the integer domain and comparisons produce opmasks.
+    struct Batch16
+    {
+        static constexpr int kWidth = 16;
+        using F = __m512;
+        using I = __m512i;
+        using Mask = __mmask16;
+
+        static F load(const float *p) noexcept { return _mm512_loadu_ps(p); }
+        static void store(float *p, const F v) noexcept { _mm512_storeu_ps(p, v); }
+        static F set1(const float x) noexcept { return _mm512_set1_ps(x); }
+        static F zero() noexcept { return _mm512_setzero_ps(); }
+        static F add(const F a, const F b) noexcept { return _mm512_add_ps(a, b); }
+        static F sub(const F a, const F b) noexcept { return _mm512_sub_ps(a, b); }
+        static F mul(const F a, const F b) noexcept { return _mm512_mul_ps(a, b); }
+        static F div(const F a, const F b) noexcept { return _mm512_div_ps(a, b); }
+#ifndef SIMDE_UNAVAILABLE
+        static F fmadd(const F a, const F b, const F c) noexcept { return _mm512_fmadd_ps(a, b, c); }
+#else
+        static F fmadd(const F a, const F b, const F c) noexcept { return _mm512_add_ps(_mm512_mul_ps(a, b), c); }
+#endif
+
+        static Mask finite(const F x) noexcept { return _mm512_cmp_ps_mask(_mm512_sub_ps(x, x), zero(), _CMP_EQ_OQ); }
+        static Mask both(const Mask a, const Mask b) noexcept { return static_cast<Mask>(a & b); }
+        static F keep(const Mask m, const F x) noexcept { return _mm512_maskz_mov_ps(m, x); }
+        static F abs(const F x) noexcept
+        {
+            return _mm512_castsi512_ps(_mm512_and_epi32(_mm512_castps_si512(x), _mm512_set1_epi32(0x7fffffff)));
+        }
+        static F max(const F a, const F b) noexcept { return _mm512_max_ps(a, b); }
+
+        static F roundHalfAway(const F q) noexcept
+        {
+            const __m512i sign = _mm512_and_epi32(_mm512_castps_si512(q),
+                                                  _mm512_set1_epi32(static_cast<int>(0x80000000u)));
+            const __m512i half = _mm512_or_epi32(_mm512_castps_si512(_mm512_set1_ps(0.5f)), sign);
+            const F shifted = _mm512_add_ps(q, _mm512_castsi512_ps(half));
+            return _mm512_cvtepi32_ps(_mm512_cvttps_epi32(shifted));
+        }
+
+        static I loadI(const std::uint32_t *p) noexcept { return _mm512_loadu_si512(p); }
+        static void storeI(std::uint32_t *p, const I v) noexcept { _mm512_storeu_si512(p, v); }
+        static I xorI(const I a, const I b) noexcept { return _mm512_xor_si512(a, b); }
+        template <int N> static I shl(const I a) noexcept { return _mm512_slli_epi32(a, N); }
+        template <int N> static I shr(const I a) noexcept { return _mm512_srli_epi32(a, N); }
+        static F toFloat(const I a) noexcept { return _mm512_cvtepi32_ps(a); }
+
+        static constexpr int kWidthD = 8;
+        using D = __m512d;
+        using MaskD = __mmask8;
+
+        static D loadD(const double *p) noexcept { return _mm512_loadu_pd(p); }
+        static void storeD(double *p, const D v) noexcept { _mm512_storeu_pd(p, v); }
+        static D set1D(const double x) noexcept { return _mm512_set1_pd(x); }
+        static D addD(const D a, const D b) noexcept { return _mm512_add_pd(a, b); }
+        static D subD(const D a, const D b) noexcept { return _mm512_sub_pd(a, b); }
+        static D mulD(const D a, const D b) noexcept { return _mm512_mul_pd(a, b); }
+#ifndef SIMDE_UNAVAILABLE
+        static D fmaddD(const D a, const D b, const D c) noexcept { return _mm512_fmadd_pd(a, b, c); }
+#else
+        static D fmaddD(const D a, const D b, const D c) noexcept { return _mm512_add_pd(_mm512_mul_pd(a, b), c); }
+#endif
+        static D minD(const D a, const D b) noexcept { return _mm512_min_pd(a, b); }
+        static D absD(const D x) noexcept
+        {
+            return _mm512_castsi512_pd(_mm512_and_epi64(_mm512_castpd_si512(x),
+                                                        _mm512_set1_epi64(0x7fffffffffffffffLL)));
+        }
+        static D flipSignD(const D x, const D s) noexcept
+        {
+            const __m512i sign = _mm512_and_epi64(_mm512_castpd_si512(s),
+                                                  _mm512_set1_epi64(static_cast<long long>(0x8000000000000000ULL)));
+            return _mm512_castsi512_pd(_mm512_xor_epi64(_mm512_castpd_si512(x), sign));
+        }
+        static MaskD lessD(const D a, const D b) noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ); }
+        static MaskD lessEqD(const D a, const D b) noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ); }
+        static D selectD(const MaskD m, const D a, const D b) noexcept { return _mm512_mask_blend_pd(m, b, a); }
+        static D pow2D(const D k) noexcept
+        {
+            const __m512i e = _mm512_add_epi64(_mm512_castpd_si512(k), _mm512_set1_epi64(1023));
+            return _mm512_castsi512_pd(_mm512_slli_epi64(e, 52));
+        }
+    };
+}
+CHRONOS_SIMD_TARGET_END
+#endif
+
+#endif
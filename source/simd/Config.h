@@ -5,7 +5,7 @@
 
 /**
  * SIMD abstraction layer over native SSE or SIMDe.
- * Defines the MM(x) and M128 macros plus the FMADD alias.
+ * Defines the MM(x), M128 and M128D macros plus the FMADD and FMADD_PD aliases.
  * This is the single include of simde/x86/fma.h.
  */
 
@@ -64,10 +64,12 @@
 // FMADD lowers to a fused multiply-add under -mfma on x86_64.
 #ifndef SIMDE_UNAVAILABLE
 #define FMADD simde_mm_fmadd_ps
+#define FMADD_PD simde_mm_fmadd_pd
 #else
 // No simde: a mul plus an add. The product rounds before the add, so this is
 // not bit-identical to the fused path. Parity tolerances account for it.
 #define FMADD(a,b,c) _mm_add_ps(_mm_mul_ps((a),(b)), (c))
+#define FMADD_PD(a,b,c) _mm_add_pd(_mm_mul_pd((a),(b)), (c))
 #endif
 
 // Branch B: non-x86 with SIMDe available.
@@ -81,6 +83,7 @@
 
 // FMADD lowers to native vfmadd on arm64 (FMA is unconditional there).
 #define FMADD simde_mm_fmadd_ps
+#define FMADD_PD simde_mm_fmadd_pd
 #endif
 
 static_assert(__cplusplus >= 202302L, "Chronos requires C++23 or later.");
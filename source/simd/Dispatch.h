@@ -0,0 +1,166 @@
+#pragma once
+
+#ifndef CHRONOS_SIMD_DISPATCH_H
+#define CHRONOS_SIMD_DISPATCH_H
+
+/**
+ * Runtime CPU-feature detection for the vector kernels.
+ * Config.h fixes the 128-bit baseline at compile time. The wider tiers are
+ * compiled alongside it under per-function target attributes and picked
+ * once at run time from cpuid and the OS-enabled register state (xgetbv).
+ * Define CHRONOS_SIMD_NO_DISPATCH to build the 128-bit tier only.
+ */
+
+#include "simd/Config.h"
+
+#include <atomic>
+
+#if defined(MARSCORE_SIMD_NATIVE_X86) && !defined(MARSCORE_SIMD_ARM64EC) && !defined(CHRONOS_SIMD_NO_DISPATCH) \
+    && (defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER))
+#define CHRONOS_SIMD_WIDE_DISPATCH 1
+#endif
+
+#ifdef CHRONOS_SIMD_WIDE_DISPATCH
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace MarsDSP::Simd
+{
+    /// Dispatch tiers, ordered by register width.
+    /// Sse42 is the 128-bit baseline (SSE4.2 on x86, SIMDe elsewhere).
+    enum class Isa : int
+    {
+        Sse42 = 0,
+        Avx2 = 1,
+        Avx512 = 2
+    };
+
+    inline constexpr int kNumIsas = 3;
+
+    [[nodiscard]] constexpr int isaWidth(const Isa isa) noexcept
+    {
+        switch (isa)
+        {
+            case Isa::Avx2: return 8;
+            case Isa::Avx512: return 16;
+            default: return 4;
+        }
+    }
+
+    [[nodiscard]] constexpr const char *isaName(const Isa isa) noexcept
+    {
+        switch (isa)
+        {
+            case Isa::Avx2: return "AVX2";
+            case Isa::Avx512: return "AVX-512";
+            default: return "SSE4.2";
+        }
+    }
+
+    namespace detail
+    {
+#ifdef CHRONOS_SIMD_WIDE_DISPATCH
+        inline void cpuid(unsigned leaf, unsigned sub, unsigned (&r)[4]) noexcept
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            int regs[4]{};
+            __cpuidex(regs, static_cast<int>(leaf), static_cast<int>(sub));
+            for (int i = 0; i < 4; ++i) r[i] = static_cast<unsigned>(regs[i]);
+#else
+            r[0] = r[1] = r[2] = r[3] = 0u;
+            __cpuid_count(leaf, sub, r[0], r[1], r[2], r[3]);
+#endif
+        }
+
+        inline unsigned long long xgetbv0() noexcept
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            return _xgetbv(0);
+#else
+            unsigned lo = 0u;
+            unsigned hi = 0u;
+            __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+            return (static_cast<unsigned long long>(hi) << 32) | lo;
+#endif
+        }
+#endif
+
+        inline Isa probeIsa() noexcept
+        {
+#ifdef CHRONOS_SIMD_WIDE_DISPATCH
+            unsigned r[4];
+            cpuid(0u, 0u, r);
+            const unsigned maxLeaf = r[0];
+            if (maxLeaf < 7u) return Isa::Sse42;
+
+            cpuid(1u, 0u, r);
+            const bool osxsave = (r[2] & (1u << 27)) != 0u;
+            const bool fma = (r[2] & (1u << 12)) != 0u;
+            const bool avx = (r[2] & (1u << 28)) != 0u;
+            if (!osxsave || !avx || !fma) return Isa::Sse42;
+
+            // XMM and YMM state must be OS-enabled before any VEX instruction.
+            const unsigned long long xcr0 = xgetbv0();
+            if ((xcr0 & 0x6u) != 0x6u) return Isa::Sse42;
+
+            cpuid(7u, 0u, r);
+            const bool avx2 = (r[1] & (1u << 5)) != 0u;
+            const bool avx512f = (r[1] & (1u << 16)) != 0u;
+            if (!avx2) return Isa::Sse42;
+
+            // Opmask plus both halves of the ZMM file.
+            if (avx512f && (xcr0 & 0xE6u) == 0xE6u) return Isa::Avx512;
+            return Isa::Avx2;
+#else
+            return Isa::Sse42;
+#endif
+        }
+
+        inline std::atomic<int> &isaOverride() noexcept
+        {
+            static std::atomic<int> value{-1};
+            return value;
+        }
+    }
+
+    /// Widest tier the CPU and OS support. Probed once.
+    [[nodiscard]] inline Isa detectedIsa() noexcept
+    {
+        static const Isa isa = detail::probeIsa();
+        return isa;
+    }
+
+    /// Tier the kernels run on: the detected tier unless capped by setIsaOverride.
+    [[nodiscard]] inline Isa activeIsa() noexcept
+    {
+        const int cap = detail::isaOverride().load(std::memory_order_relaxed);
+        const Isa hw = detectedIsa();
+        if (cap < 0 || cap >= static_cast<int>(hw)) return hw;
+        return static_cast<Isa>(cap);
+    }
+
+    /// Cap the active tier, e.g. to run parity checks per width or to keep a
+    /// host off AVX-512. The cap never raises the tier above detectedIsa().
+    /// Not for use while audio is running.
+    inline void setIsaOverride(const Isa cap) noexcept
+    {
+        detail::isaOverride().store(static_cast<int>(cap), std::memory_order_relaxed);
+    }
+
+    inline void clearIsaOverride() noexcept
+    {
+        detail::isaOverride().store(-1, std::memory_order_relaxed);
+    }
+
+    /// True when isa can run on this machine.
+    [[nodiscard]] inline bool isaAvailable(const Isa isa) noexcept
+    {
+        return static_cast<int>(isa) <= static_cast<int>(detectedIsa());
+    }
+}
+
+#endif
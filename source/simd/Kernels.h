@@ -0,0 +1,169 @@
+#pragma once
+
+#ifndef CHRONOS_SIMD_KERNELS_H
+#define CHRONOS_SIMD_KERNELS_H
+
+/**
+ * Runtime-dispatched vector kernels.
+ * Kernels.inl is compiled once per tier (Batch4, and under
+ * CHRONOS_SIMD_WIDE_DISPATCH also Batch8 and Batch16). kernels() returns
+ * the table for activeIsa(). Callers fetch it once per block and call
+ * through it; the table is constant after the first probe.
+ * Counts named n4 must be multiples of 4. The caller keeps its own scalar
+ * tail, so outputs do not depend on which tier ran.
+ */
+
+#include "simd/Batch.h"
+#include "simd/Config.h"
+#include "simd/Dispatch.h"
+#include "math/TanhAntiderivatives.h"
+#include "math/Trigonometry.h"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+namespace MarsDSP::Simd
+{
+    /// SimdSVF state for up to kMaxLanes independent lanes, one row per
+    /// register of SimdSVF, laid out so a batch loads lanes [l, l + W).
+    struct SvfLanes
+    {
+        static constexpr int kMaxLanes = 16;
+        using Row = std::array<float, kMaxLanes>;
+
+        alignas(64) Row ic1{};
+        alignas(64) Row ic2{};
+        alignas(64) Row a1{};
+        alignas(64) Row a2{};
+        alignas(64) Row a3{};
+        alignas(64) Row m0{};
+        alignas(64) Row m1{};
+        alignas(64) Row m2{};
+        alignas(64) Row da1{};
+        alignas(64) Row da2{};
+        alignas(64) Row da3{};
+        alignas(64) Row dm0{};
+        alignas(64) Row dm1{};
+        alignas(64) Row dm2{};
+    };
+
+    /// One chunk of a nested allpass: tap windows (sample i reads win[i+1..i+4]),
+    /// Lagrange coefficients and gains in, inner/outer ring writes out.
+    struct AllpassTaps
+    {
+        const float *winOut;
+        const float *winIn;
+        float cfOut[4];
+        float cfIn[4];
+        float gOut;
+        float gIn;
+        float *vIn;
+        float *w;
+    };
+
+    struct KernelTable
+    {
+        Isa isa;
+
+        void (*sinBlock)(const float *x, float *y, int n) noexcept;
+        void (*cosBlock)(const float *x, float *y, int n) noexcept;
+        void (*tanBlock)(const float *x, float *y, int n) noexcept;
+
+        /// outL = dryL * cos(theta) + wetL * sin(theta); the R side when outR != nullptr.
+        void (*crossfade)(const float *theta, const float *dryL, const float *wetL, float *outL,
+                          const float *dryR, const float *wetR, float *outR, int n4) noexcept;
+
+        void (*applyGain)(const float *in, const float *gain, float *out, int n4) noexcept;
+
+        /// max |x[i]| over n samples (any n). NaN samples are skipped.
+        float (*peakAbs)(const float *x, int n) noexcept;
+
+        /// out = round((in * gain + TPDF) / lsb) * lsb with a 4-lane xorshift32 state.
+        void (*quantise)(const float *in, const float *gain, float *out, int n4, float lsb,
+                         std::uint32_t *rng) noexcept;
+
+        /// dst = old + alpha * (new - old), old/new the 6-tap dots of each window.
+        void (*tapBlend)(const float *oldWin, const float *newWin, const float *cOld, const float *cNew,
+                         const float *alpha, float *dst, int n4) noexcept;
+
+        void (*nestedAllpass)(const AllpassTaps &taps, float *io, int m) noexcept;
+
+        /// Two SVFs in series per lane; io is sample-major with stride lanes (a multiple of 4).
+        void (*svfCascade)(SvfLanes &first, SvfLanes &second, float *io, int lanes, int n) noexcept;
+
+        /// F1/F2 of tanh per sample (any n), regions blended without branches.
+        /// Within 2 ulp of Math::f1Tanh/f2Tanh and identical at every tier.
+        void (*tanhF1Block)(const double *x, double *y, int n) noexcept;
+        void (*tanhF2Block)(const double *x, double *y, int n) noexcept;
+
+        /// ADAA1/ADAA2 of tanh's series x - x^3/3 + 2x^5/15 (any n), for
+        /// inputs under TanhNL::kSeriesBound. x1, x2 are the inputs before
+        /// x[0]. Identical at every tier.
+        void (*tanhSeries1Block)(const double *x, double *y, int n, double x1) noexcept;
+        void (*tanhSeries2Block)(const double *x, double *y, int n, double x1, double x2) noexcept;
+    };
+}
+
+#define CHRONOS_KERNEL_NS sse42
+#define CHRONOS_KERNEL_TIER 0
+#include "simd/Kernels.inl"
+#undef CHRONOS_KERNEL_NS
+#undef CHRONOS_KERNEL_TIER
+
+#ifdef CHRONOS_SIMD_WIDE_DISPATCH
+CHRONOS_SIMD_TARGET_AVX2_BEGIN
+#define CHRONOS_KERNEL_NS avx2
+#define CHRONOS_KERNEL_TIER 1
+#include "simd/Kernels.inl"
+#undef CHRONOS_KERNEL_NS
+#undef CHRONOS_KERNEL_TIER
+CHRONOS_SIMD_TARGET_END
+
+CHRONOS_SIMD_TARGET_AVX512_BEGIN
+#define CHRONOS_KERNEL_NS avx512
+#define CHRONOS_KERNEL_TIER 2
+#include "simd/Kernels.inl"
+#undef CHRONOS_KERNEL_NS
+#undef CHRONOS_KERNEL_TIER
+CHRONOS_SIMD_TARGET_END
+#endif
+
+namespace MarsDSP::Simd
+{
+    namespace detail
+    {
+#define CHRONOS_KERNEL_TABLE(ns, tier)                                                            \
+    KernelTable { tier, &ns::sinBlock, &ns::cosBlock, &ns::tanBlock, &ns::crossfade, &ns::applyGain, \
+                  &ns::peakAbs, &ns::quantise, &ns::tapBlend, &ns::nestedAllpass, &ns::svfCascade, \
+                  &ns::tanhF1Block, &ns::tanhF2Block, &ns::tanhSeries1Block, &ns::tanhSeries2Block }
+
+        inline constexpr KernelTable kSse42Kernels = CHRONOS_KERNEL_TABLE(sse42, Isa::Sse42);
+#ifdef CHRONOS_SIMD_WIDE_DISPATCH
+        inline constexpr KernelTable kAvx2Kernels = CHRONOS_KERNEL_TABLE(avx2, Isa::Avx2);
+        inline constexpr KernelTable kAvx512Kernels = CHRONOS_KERNEL_TABLE(avx512, Isa::Avx512);
+#endif
+
+#undef CHRONOS_KERNEL_TABLE
+    }
+
+    /// Table for a given tier. Tiers this build or CPU lacks fall back to the widest one below.
+    [[nodiscard]] inline const KernelTable &kernelsFor(const Isa isa) noexcept
+    {
+#ifdef CHRONOS_SIMD_WIDE_DISPATCH
+        const Isa run = isaAvailable(isa) ? isa : detectedIsa();
+        if (run == Isa::Avx512) return detail::kAvx512Kernels;
+        if (run == Isa::Avx2) return detail::kAvx2Kernels;
+#else
+        (void) isa;
+#endif
+        return detail::kSse42Kernels;
+    }
+
+    [[nodiscard]] inline const KernelTable &kernels() noexcept
+    {
+        return kernelsFor(activeIsa());
+    }
+}
+
+#endif
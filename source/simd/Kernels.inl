@@ -0,0 +1,701 @@
+// Kernel bodies shared by every dispatch tier. No include guard: Kernels.h
+// includes this once per tier, inside that tier's target region, with
+// CHRONOS_KERNEL_NS naming the namespace and CHRONOS_KERNEL_TIER the widest
+// batch (0: Batch4, 1: Batch8, 2: Batch16). Each entry point runs its widest
+// batch first and steps down to Batch4 for the rest, so lane i of every
+// tier sees the same operations in the same order.
+
+namespace MarsDSP::Simd::CHRONOS_KERNEL_NS
+{
+    // ── Minimax trig (same coefficients and Horner order as Trigonometry.h) ──
+
+    template <class B>
+    typename B::F sin(const typename B::F x) noexcept
+    {
+        using namespace MinimaxSinCoeffs;
+        const auto x2 = B::mul(x, x);
+        auto numInner = B::fmadd(x2, B::set1(N3), B::set1(N2));
+        numInner = B::fmadd(x2, numInner, B::set1(N1));
+        numInner = B::fmadd(x2, numInner, B::set1(N0));
+        const auto num = B::mul(x, numInner);
+        auto denInner = B::fmadd(x2, B::set1(D3), B::set1(D2));
+        denInner = B::fmadd(x2, denInner, B::set1(D1));
+        const auto den = B::fmadd(x2, denInner, B::set1(D0));
+        return B::div(num, den);
+    }
+
+    template <class B>
+    typename B::F cos(const typename B::F x) noexcept
+    {
+        using namespace MinimaxCosCoeffs;
+        const auto x2 = B::mul(x, x);
+        auto numInner = B::fmadd(x2, B::set1(N3), B::set1(N2));
+        numInner = B::fmadd(x2, numInner, B::set1(N1));
+        const auto num = B::fmadd(x2, numInner, B::set1(N0));
+        auto denInner = B::fmadd(x2, B::set1(D3), B::set1(D2));
+        denInner = B::fmadd(x2, denInner, B::set1(D1));
+        const auto den = B::fmadd(x2, denInner, B::set1(D0));
+        return B::div(num, den);
+    }
+
+    template <class B>
+    typename B::F tan(const typename B::F x) noexcept
+    {
+        using namespace MinimaxTanCoeffs;
+        const auto x2 = B::mul(x, x);
+        auto numInner = B::fmadd(x2, B::set1(N3), B::set1(N2));
+        numInner = B::fmadd(x2, numInner, B::set1(N1));
+        const auto poly = B::fmadd(x2, numInner, B::set1(N0));
+        const auto num = B::mul(x, poly);
+        auto denInner = B::fmadd(x2, B::set1(D3), B::set1(D2));
+        denInner = B::fmadd(x2, denInner, B::set1(D1));
+        const auto den = B::fmadd(x2, denInner, B::set1(D0));
+        return B::div(num, den);
+    }
+
+    enum class TrigFn { Sin, Cos, Tan };
+
+    template <TrigFn Fn, class B>
+    typename B::F trig(const typename B::F x) noexcept
+    {
+        if constexpr (Fn == TrigFn::Sin) return sin<B>(x);
+        else if constexpr (Fn == TrigFn::Cos) return cos<B>(x);
+        else return tan<B>(x);
+    }
+
+    template <TrigFn Fn, class B>
+    int trigSpan(const float *x, float *y, int i, const int n) noexcept
+    {
+        for (; i + B::kWidth <= n; i += B::kWidth)
+            B::store(y + i, trig<Fn, B>(B::load(x + i)));
+        return i;
+    }
+
+    template <TrigFn Fn>
+    void trigBlock(const float *x, float *y, const int n) noexcept
+    {
+        int i = 0;
+#if CHRONOS_KERNEL_TIER >= 2
+        i = trigSpan<Fn, Batch16>(x, y, i, n);
+#endif
+#if CHRONOS_KERNEL_TIER >= 1
+        i = trigSpan<Fn, Batch8>(x, y, i, n);
+#endif
+        i = trigSpan<Fn, Batch4>(x, y, i, n);
+        if (i < n)
+        {
+            // Pad the tail to one 4-lane batch so it uses the vector formula too.
+            float pad[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+            for (int k = 0; k < n - i; ++k) pad[k] = x[i + k];
+            Batch4::store(pad, trig<Fn, Batch4>(Batch4::load(pad)));
+            for (int k = 0; k < n - i; ++k) y[i + k] = pad[k];
+        }
+    }
+
+    inline void sinBlock(const float *x, float *y, const int n) noexcept { trigBlock<TrigFn::Sin>(x, y, n); }
+    inline void cosBlock(const float *x, float *y, const int n) noexcept { trigBlock<TrigFn::Cos>(x, y, n); }
+    inline void tanBlock(const float *x, float *y, const int n) noexcept { trigBlock<TrigFn::Tan>(x, y, n); }
+
+    // ── Equal-power crossfade: out = dry * cos(theta) + wet * sin(theta) ──
+
+    template <class B>
+    int crossfadeSpan(const float *theta, const float *dryL, const float *wetL, float *outL,
+                      const float *dryR, const float *wetR, float *outR, int i, const int n4) noexcept
+    {
+        for (; i + B::kWidth <= n4; i += B::kWidth)
+        {
+            const auto vTheta = B::load(theta + i);
+            const auto vCos = cos<B>(vTheta);
+            const auto vSin = sin<B>(vTheta);
+            B::store(outL + i, B::fmadd(B::load(dryL + i), vCos, B::mul(B::load(wetL + i), vSin)));
+            if (outR != nullptr)
+                B::store(outR + i, B::fmadd(B::load(dryR + i), vCos, B::mul(B::load(wetR + i), vSin)));
+        }
+        return i;
+    }
+
+    inline void crossfade(const float *theta, const float *dryL, const float *wetL, float *outL,
+                          const float *dryR, const float *wetR, float *outR, const int n4) noexcept
+    {
+        int i = 0;
+#if CHRONOS_KERNEL_TIER >= 2
+        i = crossfadeSpan<Batch16>(theta, dryL, wetL, outL, dryR, wetR, outR, i, n4);
+#endif
+#if CHRONOS_KERNEL_TIER >= 1
+        i = crossfadeSpan<Batch8>(theta, dryL, wetL, outL, dryR, wetR, outR, i, n4);
+#endif
+        crossfadeSpan<Batch4>(theta, dryL, wetL, outL, dryR, wetR, outR, i, n4);
+    }
+
+    // ── Output gain and TPDF-dithered quantiser ──
+
+    template <class B>
+    int gainSpan(const float *in, const float *gain, float *out, int i, const int n4) noexcept
+    {
+        for (; i + B::kWidth <= n4; i += B::kWidth)
+            B::store(out + i, B::mul(B::load(in + i), B::load(gain + i)));
+        return i;
+    }
+
+    inline void applyGain(const float *in, const float *gain, float *out, const int n4) noexcept
+    {
+        int i = 0;
+#if CHRONOS_KERNEL_TIER >= 2
+        i = gainSpan<Batch16>(in, gain, out, i, n4);
+#endif
+#if CHRONOS_KERNEL_TIER >= 1
+        i = gainSpan<Batch8>(in, gain, out, i, n4);
+#endif
+        gainSpan<Batch4>(in, gain, out, i, n4);
+    }
+
+    // ── Peak level ──
+
+    // The running peak is the second max operand, so a NaN lane keeps it.
+    template <class B>
+    int peakSpan(const float *x, int i, const int n, typename B::F &acc) noexcept
+    {
+        for (; i + B::kWidth <= n; i += B::kWidth)
+            acc = B::max(B::abs(B::load(x + i)), acc);
+        return i;
+    }
+
+    template <class B>
+    float reducePeak(const typename B::F acc) noexcept
+    {
+        alignas(64) float lanes[B::kWidth];
+        B::store(lanes, acc);
+        float peak = 0.0f;
+        for (const float v: lanes)
+            peak = v > peak ? v : peak;
+        return peak;
+    }
+
+    inline float peakAbs(const float *x, const int n) noexcept
+    {
+        int i = 0;
+        float peak = 0.0f;
+#if CHRONOS_KERNEL_TIER >= 2
+        {
+            auto acc = Batch16::zero();
+            i = peakSpan<Batch16>(x, i, n, acc);
+            peak = reducePeak<Batch16>(acc);
+        }
+#endif
+#if CHRONOS_KERNEL_TIER >= 1
+        {
+            auto acc = Batch8::zero();
+            i = peakSpan<Batch8>(x, i, n, acc);
+            const float p = reducePeak<Batch8>(acc);
+            peak = p > peak ? p : peak;
+        }
+#endif
+        {
+            auto acc = Batch4::zero();
+            i = peakSpan<Batch4>(x, i, n, acc);
+            const float p = reducePeak<Batch4>(acc);
+            peak = p > peak ? p : peak;
+        }
+        for (; i < n; ++i)
+        {
+            const float a = std::fabs(x[i]);
+            peak = a > peak ? a : peak;
+        }
+        return peak;
+    }
+
+    template <class B>
+    typename B::I xorshift(typename B::I s) noexcept
+    {
+        s = B::xorI(s, B::template shl<13>(s));
+        s = B::xorI(s, B::template shr<17>(s));
+        s = B::xorI(s, B::template shl<5>(s));
+        return s;
+    }
+
+    template <class B>
+    typename B::F uniform(const typename B::I s) noexcept
+    {
+        // Top 24 bits -> [0, 1).
+        return B::mul(B::toFloat(B::template shr<8>(s)), B::set1(1.0f / 16777216.0f));
+    }
+
+    // rng holds the canonical 4-lane xorshift32 state. The 4-wide quantiser
+    // draws two values per 4 samples, so 4-sample group j of a W-wide batch
+    // starts 2j steps ahead and every group advances 2 * (W / 4) steps per
+    // batch. The dither sequence is therefore the same at every width.
+    template <class B>
+    int quantiseSpan(const float *in, const float *gain, float *out, int i, const int n4,
+                     const float lsb, std::uint32_t *rng) noexcept
+    {
+        constexpr int kGroups = B::kWidth / 4;
+        if (i + B::kWidth > n4) return i;
+
+        alignas(64) std::uint32_t lanes[B::kWidth];
+        for (int g = 0; g < kGroups; ++g)
+            for (int k = 0; k < 4; ++k)
+            {
+                std::uint32_t s = rng[k];
+                for (int step = 0; step < 2 * g; ++step)
+                {
+                    s ^= s << 13;
+                    s ^= s >> 17;
+                    s ^= s << 5;
+                }
+                lanes[4 * g + k] = s;
+            }
+
+        auto state = B::loadI(lanes);
+        const auto vLsb = B::set1(lsb);
+        const auto vInvLsb = B::set1(1.0f / lsb);
+        for (; i + B::kWidth <= n4; i += B::kWidth)
+        {
+            const auto vScaled = B::mul(B::load(in + i), B::load(gain + i));
+            state = xorshift<B>(state);
+            const auto vD1 = uniform<B>(state);
+            state = xorshift<B>(state);
+            const auto vD2 = uniform<B>(state);
+            for (int step = 0; step < 2 * kGroups - 2; ++step)
+                state = xorshift<B>(state);
+            const auto vDither = B::mul(B::sub(vD1, vD2), vLsb);
+            const auto vQ = B::mul(B::add(vScaled, vDither), vInvLsb);
+            B::store(out + i, B::mul(B::roundHalfAway(vQ), vLsb));
+        }
+
+        B::storeI(lanes, state);
+        for (int k = 0; k < 4; ++k) rng[k] = lanes[k];
+        return i;
+    }
+
+    inline void quantise(const float *in, const float *gain, float *out, const int n4, const float lsb,
+                         std::uint32_t *rng) noexcept
+    {
+        int i = 0;
+#if CHRONOS_KERNEL_TIER >= 2
+        i = quantiseSpan<Batch16>(in, gain, out, i, n4, lsb, rng);
+#endif
+#if CHRONOS_KERNEL_TIER >= 1
+        i = quantiseSpan<Batch8>(in, gain, out, i, n4, lsb, rng);
+#endif
+        quantiseSpan<Batch4>(in, gain, out, i, n4, lsb, rng);
+    }
+
+    // ── 6-tap window blend: dst = lerp(dot6(cOld, old), dot6(cNew, new), alpha) ──
+
+    template <class B>
+    int tapBlendSpan(const float *oldWin, const float *newWin, const float *cOld, const float *cNew,
+                     const float *alpha, float *dst, int i, const int n4) noexcept
+    {
+        if (i + B::kWidth > n4) return i;
+        typename B::F cbOld[6];
+        typename B::F cbNew[6];
+        for (int t = 0; t < 6; ++t)
+        {
+            cbOld[t] = B::set1(cOld[t]);
+            cbNew[t] = B::set1(cNew[t]);
+        }
+        for (; i + B::kWidth <= n4; i += B::kWidth)
+        {
+            auto vOld = B::zero();
+            auto vNew = B::zero();
+            for (int t = 0; t < 6; ++t)
+            {
+                vOld = B::fmadd(B::load(oldWin + i + t), cbOld[t], vOld);
+                vNew = B::fmadd(B::load(newWin + i + t), cbNew[t], vNew);
+            }
+            B::store(dst + i, B::fmadd(B::load(alpha + i), B::sub(vNew, vOld), vOld));
+        }
+        return i;
+    }
+
+    inline void tapBlend(const float *oldWin, const float *newWin, const float *cOld, const float *cNew,
+                         const float *alpha, float *dst, const int n4) noexcept
+    {
+        int i = 0;
+#if CHRONOS_KERNEL_TIER >= 2
+        i = tapBlendSpan<Batch16>(oldWin, newWin, cOld, cNew, alpha, dst, i, n4);
+#endif
+#if CHRONOS_KERNEL_TIER >= 1
+        i = tapBlendSpan<Batch8>(oldWin, newWin, cOld, cNew, alpha, dst, i, n4);
+#endif
+        tapBlendSpan<Batch4>(oldWin, newWin, cOld, cNew, alpha, dst, i, n4);
+    }
+
+    // ── Nested allpass chunk (see NestedAllpass::processBlock) ──
+
+    // 4-tap Lagrange read, pairs summed as ((c1 w1 + c3 w3) + (c2 w2 + c4 w4)).
+    template <class B>
+    typename B::F lagrange4(const float *win, const float *c) noexcept
+    {
+        const auto p0 = B::mul(B::load(win + 1), B::set1(c[0]));
+        const auto p1 = B::mul(B::load(win + 2), B::set1(c[1]));
+        const auto p2 = B::mul(B::load(win + 3), B::set1(c[2]));
+        const auto p3 = B::mul(B::load(win + 4), B::set1(c[3]));
+        return B::add(B::add(p0, p2), B::add(p1, p3));
+    }
+
+    // Mul-then-add throughout, never fmadd: the scalar reference is unfused.
+    template <class B>
+    int allpassSpan(const AllpassTaps &t, float *io, int i, const int m4) noexcept
+    {
+        const auto vGOut = B::set1(t.gOut);
+        const auto vGIn = B::set1(t.gIn);
+        for (; i + B::kWidth <= m4; i += B::kWidth)
+        {
+            const auto d = lagrange4<B>(t.winOut + i, t.cfOut);
+            auto v = B::sub(B::load(io + i), B::mul(vGOut, d));
+            v = B::keep(B::finite(v), v);
+
+            const auto dIn = lagrange4<B>(t.winIn + i, t.cfIn);
+            auto vIn = B::sub(v, B::mul(vGIn, dIn));
+            vIn = B::keep(B::finite(vIn), vIn);
+
+            B::store(t.vIn + i, vIn);
+            B::store(t.w + i, B::add(dIn, B::mul(vGIn, vIn)));
+            B::store(io + i, B::add(d, B::mul(vGOut, v)));
+        }
+        return i;
+    }
+
+    inline void nestedAllpass(const AllpassTaps &t, float *io, const int m) noexcept
+    {
+        const int m4 = m & ~3;
+        int i = 0;
+#if CHRONOS_KERNEL_TIER >= 2
+        i = allpassSpan<Batch16>(t, io, i, m4);
+#endif
+#if CHRONOS_KERNEL_TIER >= 1
+        i = allpassSpan<Batch8>(t, io, i, m4);
+#endif
+        i = allpassSpan<Batch4>(t, io, i, m4);
+
+        for (; i < m; ++i)
+        {
+            const float *wo = t.winOut + i;
+            const float d = (t.cfOut[0] * wo[1] + t.cfOut[2] * wo[3]) + (t.cfOut[1] * wo[2] + t.cfOut[3] * wo[4]);
+            float v = io[i] - t.gOut * d;
+            if (!std::isfinite(v)) v = 0.0f;
+
+            const float *wi = t.winIn + i;
+            const float dIn = (t.cfIn[0] * wi[1] + t.cfIn[2] * wi[3]) + (t.cfIn[1] * wi[2] + t.cfIn[3] * wi[4]);
+            float vIn = v - t.gIn * dIn;
+            if (!std::isfinite(vIn)) vIn = 0.0f;
+
+            t.vIn[i] = vIn;
+            t.w[i] = dIn + t.gIn * vIn;
+            io[i] = d + t.gOut * v;
+        }
+    }
+
+    // ── SVF cascade over independent lanes (SimdSVF::step per lane) ──
+
+    template <class B>
+    struct SvfRegs
+    {
+        typename B::F ic1, ic2, a1, a2, a3, m0, m1, m2, da1, da2, da3, dm0, dm1, dm2;
+
+        void load(const SvfLanes &s, const int l) noexcept
+        {
+            ic1 = B::load(s.ic1.data() + l);
+            ic2 = B::load(s.ic2.data() + l);
+            a1 = B::load(s.a1.data() + l);
+            a2 = B::load(s.a2.data() + l);
+            a3 = B::load(s.a3.data() + l);
+            m0 = B::load(s.m0.data() + l);
+            m1 = B::load(s.m1.data() + l);
+            m2 = B::load(s.m2.data() + l);
+            da1 = B::load(s.da1.data() + l);
+            da2 = B::load(s.da2.data() + l);
+            da3 = B::load(s.da3.data() + l);
+            dm0 = B::load(s.dm0.data() + l);
+            dm1 = B::load(s.dm1.data() + l);
+            dm2 = B::load(s.dm2.data() + l);
+        }
+
+        void store(SvfLanes &s, const int l) const noexcept
+        {
+            B::store(s.ic1.data() + l, ic1);
+            B::store(s.ic2.data() + l, ic2);
+            B::store(s.a1.data() + l, a1);
+            B::store(s.a2.data() + l, a2);
+            B::store(s.a3.data() + l, a3);
+            B::store(s.m0.data() + l, m0);
+            B::store(s.m1.data() + l, m1);
+            B::store(s.m2.data() + l, m2);
+        }
+
+        // A non-finite input or state clears only its own lane.
+        typename B::F step(const typename B::F input) noexcept
+        {
+            const auto good = B::both(B::finite(input), B::both(B::finite(ic1), B::finite(ic2)));
+            const auto in = B::keep(good, input);
+            ic1 = B::keep(good, ic1);
+            ic2 = B::keep(good, ic2);
+
+            const auto two = B::set1(2.0f);
+            const auto v3 = B::sub(in, ic2);
+            const auto v1 = B::add(B::mul(a1, ic1), B::mul(a2, v3));
+            const auto v2 = B::add(ic2, B::add(B::mul(a2, ic1), B::mul(a3, v3)));
+            ic1 = B::sub(B::mul(two, v1), ic1);
+            ic2 = B::sub(B::mul(two, v2), ic2);
+            const auto out = B::add(B::mul(m0, in), B::add(B::mul(m1, v1), B::mul(m2, v2)));
+
+            a1 = B::add(a1, da1);
+            a2 = B::add(a2, da2);
+            a3 = B::add(a3, da3);
+            m0 = B::add(m0, dm0);
+            m1 = B::add(m1, dm1);
+            m2 = B::add(m2, dm2);
+            return out;
+        }
+    };
+
+    template <class B>
+    int svfCascadeSpan(SvfLanes &first, SvfLanes &second, float *io, const int lanes, int l, const int n) noexcept
+    {
+        for (; l + B::kWidth <= lanes; l += B::kWidth)
+        {
+            SvfRegs<B> s1;
+            SvfRegs<B> s2;
+            s1.load(first, l);
+            s2.load(second, l);
+            for (int s = 0; s < n; ++s)
+            {
+                float *p = io + s * lanes + l;
+                B::store(p, s2.step(s1.step(B::load(p))));
+            }
+            s1.store(first, l);
+            s2.store(second, l);
+        }
+        return l;
+    }
+
+    inline void svfCascade(SvfLanes &first, SvfLanes &second, float *io, const int lanes, const int n) noexcept
+    {
+        int l = 0;
+#if CHRONOS_KERNEL_TIER >= 2
+        l = svfCascadeSpan<Batch16>(first, second, io, lanes, l, n);
+#endif
+#if CHRONOS_KERNEL_TIER >= 1
+        l = svfCascadeSpan<Batch8>(first, second, io, lanes, l, n);
+#endif
+        svfCascadeSpan<Batch4>(first, second, io, lanes, l, n);
+    }
+
+    // ── Tanh antiderivatives F1/F2 (double, regions blended) ──
+
+    // Same coefficients and Estrin split as TanhAntiderivatives.h, so region
+    // I and III match f1Tanh/f2Tanh bit for bit. Region II replaces std::exp
+    // with expNeg2 below, within 2 ulp of it.
+    template <class B, std::size_t N>
+    typename B::D estrinD(const std::array<double, N> &c, const typename B::D u) noexcept
+    {
+        static_assert(N == 11 || N == 15);
+        const auto k = [&c](std::size_t i) { return B::set1D(c[i]); };
+        const auto u2 = B::mulD(u, u);
+        const auto u4 = B::mulD(u2, u2);
+        const auto u8 = B::mulD(u4, u4);
+        const auto p0 = B::fmaddD(k(1), u, k(0));
+        const auto p1 = B::fmaddD(k(3), u, k(2));
+        const auto p2 = B::fmaddD(k(5), u, k(4));
+        const auto p3 = B::fmaddD(k(7), u, k(6));
+        const auto p4 = B::fmaddD(k(9), u, k(8));
+        const auto q0 = B::fmaddD(p1, u2, p0);
+        const auto q1 = B::fmaddD(p3, u2, p2);
+        const auto r0 = B::fmaddD(q1, u4, q0);
+        if constexpr (N == 11)
+        {
+            const auto q2 = B::fmaddD(k(10), u2, p4);
+            return B::fmaddD(q2, u8, r0);
+        } else
+        {
+            const auto p5 = B::fmaddD(k(11), u, k(10));
+            const auto p6 = B::fmaddD(k(13), u, k(12));
+            const auto q2 = B::fmaddD(p5, u2, p4);
+            const auto q3 = B::fmaddD(k(14), u2, p6);
+            const auto r1 = B::fmaddD(q3, u4, q2);
+            return B::fmaddD(r1, u8, r0);
+        }
+    }
+
+    // exp(-2a) for a in [0, kTanA1]: y = n ln2 + r with |r| <= ln2/2, then
+    // exp(r) by its degree-13 Taylor polynomial (truncation below 1e-17
+    // relative) and 2^n through the exponent bits.
+    template <class B>
+    typename B::D expNeg2(const typename B::D a) noexcept
+    {
+        constexpr double kShifter = 6755399441055744.0; // 0x1.8p52
+        const auto y = B::mulD(B::set1D(-2.0), a);
+        const auto k = B::fmaddD(y, B::set1D(1.4426950408889634), B::set1D(kShifter));
+        const auto n = B::subD(k, B::set1D(kShifter));
+        auto r = B::fmaddD(n, B::set1D(-6.93147180369123816490e-01), y);
+        r = B::fmaddD(n, B::set1D(-1.90821492927058770002e-10), r);
+
+        const auto c = [](double v) { return B::set1D(v); };
+        const auto r2 = B::mulD(r, r);
+        const auto r4 = B::mulD(r2, r2);
+        const auto r8 = B::mulD(r4, r4);
+        const auto p0 = B::fmaddD(c(1.0), r, c(1.0));
+        const auto p1 = B::fmaddD(c(1.0 / 6.0), r, c(1.0 / 2.0));
+        const auto p2 = B::fmaddD(c(1.0 / 120.0), r, c(1.0 / 24.0));
+        const auto p3 = B::fmaddD(c(1.0 / 5040.0), r, c(1.0 / 720.0));
+        const auto p4 = B::fmaddD(c(1.0 / 362880.0), r, c(1.0 / 40320.0));
+        const auto p5 = B::fmaddD(c(1.0 / 39916800.0), r, c(1.0 / 3628800.0));
+        const auto p6 = B::fmaddD(c(1.0 / 6227020800.0), r, c(1.0 / 479001600.0));
+        const auto q0 = B::fmaddD(p1, r2, p0);
+        const auto q1 = B::fmaddD(p3, r2, p2);
+        const auto q2 = B::fmaddD(p5, r2, p4);
+        const auto s0 = B::fmaddD(q1, r4, q0);
+        const auto s1 = B::fmaddD(p6, r4, q2);
+        return B::mulD(B::fmaddD(s1, r8, s0), B::pow2D(k));
+    }
+
+    // Every region is evaluated and the lanes pick theirs, so the cost does
+    // not depend on the input. NaN lands in region III and propagates.
+    template <int Order, class B>
+    typename B::D tanhAntiderivative(const typename B::D x) noexcept
+    {
+        const auto &cI = Order == 1 ? Math::kF1RegionI : Math::kF2RegionI;
+        const auto &cII = Order == 1 ? Math::kF1RegionIIL : Math::kF2RegionIIPsi;
+        const auto a = B::absD(x);
+        const auto u = B::mulD(x, x);
+        const auto pI = estrinD<B>(cI, u);
+        const auto yI = Order == 1 ? B::mulD(u, pI) : B::mulD(B::mulD(x, u), pI);
+
+        const auto h = B::subD(B::subD(a, B::set1D(Math::kTanLn2Hi)), B::set1D(Math::kTanLn2Lo));
+        const auto t = expNeg2<B>(B::minD(a, B::set1D(Math::kTanA1)));
+        const auto pII = estrinD<B>(cII, t);
+        typename B::D yII;
+        typename B::D yIII;
+        if constexpr (Order == 1)
+        {
+            yII = B::fmaddD(t, pII, h);
+            yIII = h;
+        } else
+        {
+            yIII = B::fmaddD(B::mulD(B::set1D(0.5), h), h, B::set1D(Math::kTanC2));
+            yII = B::subD(yIII, B::mulD(B::mulD(B::set1D(0.5), t), pII));
+            yII = B::flipSignD(yII, x);
+            yIII = B::flipSignD(yIII, x);
+        }
+        const auto outer = B::selectD(B::lessD(a, B::set1D(Math::kTanA1)), yII, yIII);
+        return B::selectD(B::lessEqD(a, B::set1D(Math::kTanA0)), yI, outer);
+    }
+
+    template <int Order, class B>
+    int tanhAntiderivativeSpan(const double *x, double *y, int i, const int n) noexcept
+    {
+        for (; i + B::kWidthD <= n; i += B::kWidthD)
+            B::storeD(y + i, tanhAntiderivative<Order, B>(B::loadD(x + i)));
+        return i;
+    }
+
+    template <int Order>
+    void tanhAntiderivativeBlock(const double *x, double *y, const int n) noexcept
+    {
+        int i = 0;
+#if CHRONOS_KERNEL_TIER >= 2
+        i = tanhAntiderivativeSpan<Order, Batch16>(x, y, i, n);
+#endif
+#if CHRONOS_KERNEL_TIER >= 1
+        i = tanhAntiderivativeSpan<Order, Batch8>(x, y, i, n);
+#endif
+        i = tanhAntiderivativeSpan<Order, Batch4>(x, y, i, n);
+        if (i < n)
+        {
+            double pad[2] = {x[i], 0.0};
+            Batch4::storeD(pad, tanhAntiderivative<Order, Batch4>(Batch4::loadD(pad)));
+            y[i] = pad[0];
+        }
+    }
+
+    inline void tanhF1Block(const double *x, double *y, const int n) noexcept { tanhAntiderivativeBlock<1>(x, y, n); }
+    inline void tanhF2Block(const double *x, double *y, const int n) noexcept { tanhAntiderivativeBlock<2>(x, y, n); }
+
+    // ── ADAA of tanh's series p(x) = x - x^3/3 + 2x^5/15 (double) ──
+
+    // Order 1 is p's mean over [b, a]: s (1/2 - q/12 + (q^2 - m^2)/45) with
+    // s = a + b, m = ab, q = a^2 + b^2. Order 2 is 2 p[a, b, c], i.e.
+    // h1/3 - h3/30 + 2 h5/315 over the complete homogeneous polynomials of
+    // a, b, c, which follow from e1, e2, e3 as h_k = e1 h_k-1 - e2 h_k-2 + e3 h_k-3.
+    template <class B>
+    typename B::D tanhSeries1(const typename B::D a, const typename B::D b) noexcept
+    {
+        const auto s = B::addD(a, b);
+        const auto m = B::mulD(a, b);
+        const auto q = B::fmaddD(a, a, B::mulD(b, b));
+        const auto r = B::subD(B::mulD(q, q), B::mulD(m, m));
+        const auto k = B::fmaddD(q, B::set1D(-1.0 / 12.0), B::set1D(0.5));
+        return B::mulD(s, B::fmaddD(r, B::set1D(1.0 / 45.0), k));
+    }
+
+    template <class B>
+    typename B::D tanhSeries2(const typename B::D a, const typename B::D b, const typename B::D c) noexcept
+    {
+        const auto ab = B::addD(a, b);
+        const auto e1 = B::addD(ab, c);
+        const auto m = B::mulD(a, b);
+        const auto e2 = B::fmaddD(c, ab, m);
+        const auto e3 = B::mulD(m, c);
+        const auto h2 = B::subD(B::mulD(e1, e1), e2);
+        const auto h3 = B::fmaddD(e1, h2, B::subD(e3, B::mulD(e2, e1)));
+        const auto h4 = B::fmaddD(e1, h3, B::subD(B::mulD(e3, e1), B::mulD(e2, h2)));
+        const auto h5 = B::fmaddD(e1, h4, B::subD(B::mulD(e3, h2), B::mulD(e2, h3)));
+        const auto lo = B::fmaddD(h3, B::set1D(-1.0 / 30.0), B::mulD(e1, B::set1D(1.0 / 3.0)));
+        return B::fmaddD(h5, B::set1D(2.0 / 315.0), lo);
+    }
+
+    template <int Order, class B>
+    typename B::D tanhSeries(const double *x) noexcept
+    {
+        const auto a = B::loadD(x);
+        const auto b = B::loadD(x - 1);
+        if constexpr (Order == 1) return tanhSeries1<B>(a, b);
+        else return tanhSeries2<B>(a, b, B::loadD(x - 2));
+    }
+
+    template <int Order, class B>
+    int tanhSeriesSpan(const double *x, double *y, int i, const int n) noexcept
+    {
+        for (; i + B::kWidthD <= n; i += B::kWidthD)
+            B::storeD(y + i, tanhSeries<Order, B>(x + i));
+        return i;
+    }
+
+    // Samples 0 and 1 read the history x1, x2 through a padded window; from
+    // 2 on every operand is in x. y must not alias x.
+    template <int Order>
+    void tanhSeriesBlock(const double *x, double *y, const int n, const double x1, const double x2) noexcept
+    {
+        if (n <= 0) return;
+        double pad[4] = {x2, x1, x[0], n > 1 ? x[1] : 0.0};
+        Batch4::storeD(pad, tanhSeries<Order, Batch4>(pad + 2));
+        y[0] = pad[0];
+        if (n > 1) y[1] = pad[1];
+
+        int i = 2;
+#if CHRONOS_KERNEL_TIER >= 2
+        i = tanhSeriesSpan<Order, Batch16>(x, y, i, n);
+#endif
+#if CHRONOS_KERNEL_TIER >= 1
+        i = tanhSeriesSpan<Order, Batch8>(x, y, i, n);
+#endif
+        i = tanhSeriesSpan<Order, Batch4>(x, y, i, n);
+        if (i < n)
+        {
+            double tail[4] = {x[i - 2], x[i - 1], x[i], 0.0};
+            Batch4::storeD(tail, tanhSeries<Order, Batch4>(tail + 2));
+            y[i] = tail[0];
+        }
+    }
+
+    inline void tanhSeries1Block(const double *x, double *y, const int n, const double x1) noexcept
+    {
+        tanhSeriesBlock<1>(x, y, n, x1, 0.0);
+    }
+
+    inline void tanhSeries2Block(const double *x, double *y, const int n, const double x1, const double x2) noexcept
+    {
+        tanhSeriesBlock<2>(x, y, n, x1, x2);
+    }
+}
@@ -1,17 +1,20 @@
 /**
  * Correctness harness for ADAA2 (and, for the static curve, ADAA1).
  * ADAA2 output is twice the second divided difference of F2 over the
- * last three input samples. Plain main(), exit code, always-live CHECK/FAIL.
+ * last three input samples. Section 12 covers the quiet-region series
+ * path (trySeriesBlock). Plain main(), exit code, always-live CHECK/FAIL.
  */
 
 #include "dsp/nonlinear/ADAA1.h"
 #include "dsp/nonlinear/ADAA2.h"
 #include "dsp/nonlinear/Nonlinearities.h"
+#include "dsp/nonlinear/TabulatedNL.h"
 
 #include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstdlib>
+#include <limits>
 #include <print>
 #include <vector>
 
@@ -20,7 +23,12 @@ namespace
     using MarsDSP::Nonlinear::ADAA1;
     using MarsDSP::Nonlinear::ADAA2;
     using MarsDSP::Nonlinear::AlgebraicNL;
+    using MarsDSP::Nonlinear::DiodeCurve;
+    using MarsDSP::Nonlinear::TabulatedNL;
+    using MarsDSP::Nonlinear::TanhCurve;
     using MarsDSP::Nonlinear::TanhNL;
+    using MarsDSP::Nonlinear::TanhNLEconomy;
+    using MarsDSP::Nonlinear::TubeCurve;
 
     const char *g_section = "(startup)";
 
@@ -500,7 +508,7 @@ namespace
         std::println("  {:<22} odd symmetry bit-exact over 5000 samples: PASS", what);
     }
 
-    // 8. a0-seam triples for TanhNL.
+    // 9. a0-seam triples for TanhNL.
     void checkA0Seam()
     {
         constexpr double a0 = 1.0;
@@ -603,6 +611,330 @@ namespace
             GaussRule::N, std::fabs(ws - 2.0), worst);
     }
 
+    // 8. Block path. processBlock takes F1/F2 from the dispatched kernels,
+    // which may differ from the scalar ones by 1 ulp in region II. The
+    // recurrence amplifies that exactly as it does a scalar rounding, so the
+    // gap to process() must stay inside the same error model. Block lengths
+    // vary so the kernel tails and the block seams both run.
+    template<typename NL>
+    void checkBlock(const char *what)
+    {
+        constexpr int kN = 60000;
+        constexpr std::array<int, 6> kLens = {64, 1, 17, 3, 64, 5};
+        std::vector<double> x(kN);
+        unsigned seed = 4242u;
+        for (int i = 0; i < kN; ++i)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            const double noise = static_cast<double>(seed >> 8) / 8388608.0 - 1.0;
+            const double n = static_cast<double>(i);
+            const int seg = i / 10000;
+            double v = 0.0;
+            if (seg == 0) v = 0.7 * std::sin(0.003 * n);
+            else if (seg == 1) v = 3.0 * std::sin(0.2 * n) + 1e-3 * noise;
+            else if (seg == 2) v = 25.0 * std::sin(0.01 * n);
+            else if (seg == 3) v = 1.0 + 1e-7 * noise;
+            else if (seg == 4) v = 40.0 * noise;
+            else v = 1.5 * std::sin(2.5 * n);
+            x[static_cast<std::size_t>(i)] = v;
+        }
+
+        ADAA1<NL> s1, b1;
+        ADAA2<NL> s2, b2;
+        s1.reset();
+        b1.reset();
+        s2.reset();
+        b2.reset();
+        std::vector<double> y1(kN), y2(kN);
+        for (int i = 0, k = 0; i < kN; ++k)
+        {
+            const int len = std::min(kLens[static_cast<std::size_t>(k) % kLens.size()], kN - i);
+            b1.processBlock(x.data() + i, y1.data() + i, len);
+            b2.processBlock(x.data() + i, y2.data() + i, len);
+            i += len;
+        }
+
+        Worst w;
+        double max1 = 0.0;
+        for (int i = 0; i < kN; ++i)
+        {
+            const double x0 = x[static_cast<std::size_t>(i)];
+            const double x1 = i > 0 ? x[static_cast<std::size_t>(i - 1)] : 0.0;
+            const double x2 = i > 1 ? x[static_cast<std::size_t>(i - 2)] : 0.0;
+
+            const double e1 = std::fabs(y1[static_cast<std::size_t>(i)] - s1.process(x0));
+            const double bnd1 = std::fabs(x0 - x1) < MarsDSP::Nonlinear::ADAA1<NL>::kEps
+                                    ? 8.0 * kU
+                                    : 4.0 * kU * std::fmax(scaleF1<NL>(x0), scaleF1<NL>(x1)) / std::fabs(x0 - x1);
+            if (e1 > kSlack * bnd1)
+                FAIL("{} ADAA1 block n={} x={:.17g}: |diff|={:.3e} bound={:.3e}", what, i, x0, e1, bnd1);
+            max1 = std::fmax(max1, e1);
+
+            const double ys = s2.process(x0);
+            const double e2 = std::fabs(y2[static_cast<std::size_t>(i)] - ys);
+            const double bnd2 = errBound<NL>(x0, x1, x2, ys);
+            w.feed(e2, bnd2, x0, x1, x2);
+            if (e2 > kSlack * bnd2)
+                FAIL("{} ADAA2 block n={} ({:.6}, {:.6}, {:.6}): |diff|={:.3e} bound={:.3e}",
+                     what, i, x0, x1, x2, e2, bnd2);
+        }
+        std::println("  {:<22} ADAA1 max |block - process| = {:.3e}; ADAA2 max diff/bound = {:.3f}: PASS",
+                     what, max1, w.ratio);
+    }
+
+    // 10. Economy precision. ADAA1<TanhNLEconomy> runs in float, so F1's
+    // rounding is amplified by the difference quotient down to the float
+    // kEps. Reports the worst-case error against the double ADAA1 on the
+    // same float input, per drive level, and gates it at twice the balanced
+    // error remez_tanh_economy.py derives for X = 16.
+    void checkEconomy()
+    {
+        constexpr double kGate = 1.5e-4;
+        constexpr int kN = 48000;
+        constexpr std::array<float, 5> kDrives = {0.1f, 0.5f, 1.0f, 4.0f, 16.0f};
+        constexpr std::array<double, 5> kW = {1e-4, 0.003, 0.05, 0.6, 2.9};
+
+        double all = 0.0;
+        for (const float drive: kDrives)
+        {
+            double worst = 0.0;
+            float at = 0.0f;
+            unsigned seed = 777u;
+            for (const double w: kW)
+            {
+                ADAA1<TanhNL> ref;
+                ADAA1<TanhNLEconomy> eco;
+                for (int i = 0; i < kN; ++i)
+                {
+                    seed = seed * 1664525u + 1013904223u;
+                    const double noise = static_cast<double>(seed >> 8) / 8388608.0 - 1.0;
+                    // Sine plus a little noise, so the increments also land
+                    // next to the threshold.
+                    const auto x = static_cast<float>(drive * (std::sin(w * i) + 0.01 * noise));
+                    const double d = std::fabs(static_cast<double>(eco.process(x)) - ref.process(x));
+                    if (!(d <= worst)) { worst = d; at = x; }
+                }
+            }
+            std::println("  drive {:>5.1f}: worst {:.3e} (x = {:.4g})", drive, worst, at);
+            all = std::fmax(all, worst);
+        }
+        if (!(all <= kGate))
+            FAIL("economy ADAA1 worst-case error {:.3e} > {:.1e}", all, kGate);
+        std::println("  worst case {:.3e} ({:.1f} dB): PASS (gate {:.1e})", all, 20.0 * std::log10(all), kGate);
+    }
+
+    // 11. Tabulated curves. The table's f, F1 and F2 are exact
+    // antiderivatives of one another, so the fit error against the curve
+    // bounds the ADAA error against ADAA of the true curve. Each table is
+    // checked against an analytic twin: TanhNL's fitted kernels for tanh,
+    // closed forms for tube and diode. The quadrature oracle of 2-4 is not
+    // used here; it is not exact on a piecewise polynomial.
+    struct TubeRefNL
+    {
+        static constexpr double b = TubeCurve::kBias;
+        static double f(double x) noexcept { return TubeCurve::f(x); }
+        static double F1(double x) noexcept { return TanhNL::F1(x + b) - TanhNL::F1(b) - std::tanh(b) * x; }
+        static double F2(double x) noexcept
+        {
+            return TanhNL::F2(x + b) - TanhNL::F2(b) - TanhNL::F1(b) * x - 0.5 * std::tanh(b) * x * x;
+        }
+    };
+
+    struct DiodeRefNL
+    {
+        static constexpr double k = DiodeCurve::kKnee;
+        static double f(double x) noexcept { return DiodeCurve::f(x); }
+        static double F1(double x) noexcept
+        {
+            return x >= 0.0 ? x + std::expm1(-x) : k * k * std::expm1(x / k) - k * x;
+        }
+        static double F2(double x) noexcept
+        {
+            return x >= 0.0 ? 0.5 * x * x - x - std::expm1(-x)
+                            : k * k * k * std::expm1(x / k) - 0.5 * k * x * x - k * k * x;
+        }
+    };
+
+    template<typename Curve, typename RefNL>
+    void checkTabulated(const char *what)
+    {
+        using NL = TabulatedNL<Curve>;
+        constexpr double kGate = 2e-8;
+        NL::prepare();
+
+        double eFit = 0.0;
+        double eF1 = 0.0;
+        double eF2 = 0.0;
+        for (int i = 0; i <= 200000; ++i)
+        {
+            // Offset from the nodes; past the range the curve is held.
+            const double x = -20.0 + 40.0 * (static_cast<double>(i) + 0.37) / 200000.0;
+            eFit = std::fmax(eFit, std::fabs(NL::f(x) - Curve::f(std::fmin(std::fmax(x, -Curve::kRange), Curve::kRange))));
+            if (std::fabs(x) <= Curve::kRange)
+            {
+                eF1 = std::fmax(eF1, std::fabs(NL::F1(x) - RefNL::F1(x)) / (1.0 + std::fabs(x)));
+                eF2 = std::fmax(eF2, std::fabs(NL::F2(x) - RefNL::F2(x)) / (1.0 + x * x));
+            }
+        }
+        if (!(eFit <= kGate) || !(eF1 <= kGate) || !(eF2 <= kGate))
+            FAIL("{} table off the curve: f {:.3e}, F1 {:.3e}, F2 {:.3e} > {:.0e}", what, eFit, eF1, eF2, kGate);
+        std::println("  {:<8} fit |df| = {:.3e}, |dF1|/(1+|x|) = {:.3e}, |dF2|/(1+x^2) = {:.3e} (gate {:.0e})",
+                     what, eFit, eF1, eF2, kGate);
+
+        // ADAA1 inherits the fit error, plus the rounding of two quotients.
+        // ADAA2's own rounding near the thresholds can be larger, so its gap
+        // is held to the fit error plus the error model of section 4.
+        double w1 = 0.0;
+        Worst w2;
+        for (const double drive: {0.5, 4.0, 16.0})
+            for (const double w: {1e-4, 0.003, 0.05, 0.6, 2.9})
+            {
+                ADAA1<RefNL> r1;
+                ADAA2<RefNL> r2;
+                ADAA1<NL> t1;
+                ADAA2<NL> t2;
+                unsigned seed = 777u;
+                double xm1 = 0.0;
+                double xm2 = 0.0;
+                for (int i = 0; i < 20000; ++i)
+                {
+                    seed = seed * 1664525u + 1013904223u;
+                    const double noise = static_cast<double>(seed >> 8) / 8388608.0 - 1.0;
+                    const double x = drive * (std::sin(w * i) + 0.01 * noise);
+                    w1 = std::fmax(w1, std::fabs(t1.process(x) - r1.process(x)));
+                    const double y = r2.process(x);
+                    w2.feed(std::fabs(t2.process(x) - y), kGate + errBound<RefNL>(x, xm1, xm2, y), x, xm1, xm2);
+                    xm2 = xm1;
+                    xm1 = x;
+                }
+            }
+        if (!(w1 <= 2.0 * kGate))
+            FAIL("{} ADAA1 off the analytic twin by {:.3e} > {:.0e}", what, w1, 2.0 * kGate);
+        if (w2.ratio > kSlack)
+            FAIL("{} ADAA2 off the analytic twin: err/bound {:.1f} > {:.0f} (err {:.3e})", what, w2.ratio, kSlack, w2.err);
+        std::println("  {:<8} through ADAA: ADAA1 {:.3e} (gate {:.0e}), ADAA2 err/bound {:.2f} (err {:.3e})",
+                     what, w1, 2.0 * kGate, w2.ratio, w2.err);
+
+        checkStaticCurve<NL, ADAA2<NL> >("  static, ADAA2");
+        checkStaticCurve<NL, ADAA1<NL> >("  static, ADAA1");
+        checkReset<NL>("  reset");
+        checkBlock<NL>("  block");
+    }
+
+    // 12. Series path. TanhNL's quiet-region series ADAA, block by block.
+    // Quiet blocks are held to the quadrature oracle within the series'
+    // truncation, 2^-24 kSeriesBound, and the F1/F2 path's error there is
+    // reported alongside. Loud blocks run per sample on the state the
+    // hand-off left and must match the F1/F2 path bit for bit. A refused
+    // block leaves the state alone.
+    template<typename Stage, int Order>
+    void checkSeries(const char *what)
+    {
+        constexpr int kBlock = 64;
+        constexpr int kBlocks = 3000;
+        const double gate = std::ldexp(TanhNL::kSeriesBound, -24) + 1e-15;
+
+        Stage fast;
+        Stage ref;
+        std::array<double, kBlock> x{};
+        std::array<double, kBlock> y{};
+        double worstSeries = 0.0;
+        double worstRef = 0.0;
+        int quiet = 0;
+        int loud = 0;
+        double xm1 = 0.0;
+        double xm2 = 0.0;
+        unsigned seed = 4242u;
+        for (int b = 0; b < kBlocks; ++b)
+        {
+            // Quiet stretches at several levels and rates, loud blocks in
+            // between, and blocks that straddle the bound.
+            const int kind = b % 7;
+            const double level = kind == 0 ? 2.5 : (kind == 3 ? 0.13 : 0.099 * std::pow(0.1, b % 5));
+            const double w = 0.001 + 0.4 * static_cast<double>(b % 11) / 11.0;
+            double peak = 0.0;
+            for (int i = 0; i < kBlock; ++i)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                const double noise = static_cast<double>(seed >> 8) / 8388608.0 - 1.0;
+                const double v = level * (0.9 * std::sin(w * (b * kBlock + i)) + 0.1 * noise);
+                x[static_cast<std::size_t>(i)] = std::clamp(v, -level, level);
+                peak = std::fmax(peak, std::fabs(x[static_cast<std::size_t>(i)]));
+            }
+
+            const bool took = fast.trySeriesBlock(x.data(), y.data(), kBlock);
+            if (!took)
+                for (int i = 0; i < kBlock; ++i)
+                    y[static_cast<std::size_t>(i)] = fast.process(x[static_cast<std::size_t>(i)]);
+            (took ? quiet : loud) += 1;
+            CHECK(took == (peak < TanhNL::kSeriesBound && std::fabs(xm1) < TanhNL::kSeriesBound
+                           && (Order == 1 || std::fabs(xm2) < TanhNL::kSeriesBound)));
+
+            for (int i = 0; i < kBlock; ++i)
+            {
+                const double xi = x[static_cast<std::size_t>(i)];
+                const double r = ref.process(xi);
+                const double yi = y[static_cast<std::size_t>(i)];
+                if (!took && yi != r)
+                    FAIL("{} loud block {} sample {} off the F1/F2 path by {:.3e}", what, b, i, std::fabs(yi - r));
+                if (took)
+                {
+                    const double o = Order == 1
+                                         ? integrate01([&](double t) { return std::tanh(xm1 + (xi - xm1) * t); }, 1)
+                                         : oracleADAA2<TanhNL>(xi, xm1, xm2);
+                    const double e = std::fabs(yi - o);
+                    if (!(e <= gate))
+                        FAIL("{} series off the oracle by {:.3e} > {:.3e} at ({:.9g}, {:.9g}, {:.9g})",
+                             what, e, gate, xi, xm1, xm2);
+                    worstSeries = std::fmax(worstSeries, e);
+                    worstRef = std::fmax(worstRef, std::fabs(r - o));
+                }
+                xm2 = xm1;
+                xm1 = xi;
+            }
+        }
+
+        // NaN is never quiet.
+        x.fill(0.01);
+        x[17] = std::numeric_limits<double>::quiet_NaN();
+        CHECK(!fast.trySeriesBlock(x.data(), y.data(), kBlock));
+
+        std::println("  {:<6} {} quiet / {} loud blocks; quiet vs oracle: series {:.3e} (gate {:.3e}), F1/F2 {:.3e}; "
+                     "loud bit-exact: PASS", what, quiet, loud, worstSeries, gate, worstRef);
+    }
+
+    // The series kernels at every tier this machine runs, against the
+    // SSE4.2 table, on a block length that exercises the padded head and tail.
+    void checkSeriesTiers()
+    {
+        using MarsDSP::Simd::Isa;
+        constexpr int kN = 203;
+        std::array<double, kN> x{};
+        for (int i = 0; i < kN; ++i)
+            x[static_cast<std::size_t>(i)] = 0.0999 * std::sin(0.37 * i + 0.2 * std::sin(1.7 * i));
+
+        std::array<double, kN> base1{}, base2{}, y1{}, y2{};
+        const auto &sse = MarsDSP::Simd::kernelsFor(Isa::Sse42);
+        sse.tanhSeries1Block(x.data(), base1.data(), kN, -0.05);
+        sse.tanhSeries2Block(x.data(), base2.data(), kN, -0.05, 0.07);
+        for (int t = 0; t < MarsDSP::Simd::kNumIsas; ++t)
+        {
+            const Isa isa = static_cast<Isa>(t);
+            if (!MarsDSP::Simd::isaAvailable(isa)) continue;
+            const auto &k = MarsDSP::Simd::kernelsFor(isa);
+            for (const int n: {1, 2, 3, 5, kN})
+            {
+                k.tanhSeries1Block(x.data(), y1.data(), n, -0.05);
+                k.tanhSeries2Block(x.data(), y2.data(), n, -0.05, 0.07);
+                for (int i = 0; i < n; ++i)
+                    if (y1[static_cast<std::size_t>(i)] != base1[static_cast<std::size_t>(i)]
+                        || y2[static_cast<std::size_t>(i)] != base2[static_cast<std::size_t>(i)])
+                        FAIL("{} series kernel differs from SSE4.2 at n = {}, i = {}", MarsDSP::Simd::isaName(isa), n, i);
+            }
+            std::println("  {:<8} series kernels match SSE4.2", MarsDSP::Simd::isaName(isa));
+        }
+    }
+
     template<typename NL>
     double runPolicy(const char *label)
     {
@@ -626,6 +958,9 @@ namespace
         checkDegenerate<NL>("degenerate");
         checkReset<NL>("reset");
         checkParity<NL>("parity");
+
+        std::println(" 8. processBlock against process():");
+        checkBlock<NL>("block");
         return surf;
     }
 } // namespace
@@ -652,10 +987,30 @@ int main()
     const double sAlg = runPolicy<AlgebraicNL>("AlgebraicNL");
 
     std::println();
-    std::println("[8. a0-seam triples straddling TanhNL's region boundary]");
+    std::println("[9. a0-seam triples straddling TanhNL's region boundary]");
     g_section = "a0-seam";
     checkA0Seam();
 
+    std::println();
+    std::println("[10. economy precision, float ADAA1 against double]");
+    std::println("  kEps = {}", ADAA1<TanhNLEconomy>::kEps);
+    g_section = "economy";
+    checkEconomy();
+
+    std::println();
+    std::println("[11. TabulatedNL against analytic twins]");
+    g_section = "tabulated";
+    checkTabulated<TanhCurve, TanhNL>("tanh");
+    checkTabulated<TubeCurve, TubeRefNL>("tube");
+    checkTabulated<DiodeCurve, DiodeRefNL>("diode");
+
+    std::println();
+    std::println("[12. TanhNL series path on quiet blocks, kSeriesBound = {}]", TanhNL::kSeriesBound);
+    g_section = "series";
+    checkSeries<ADAA1<TanhNL>, 1>("ADAA1");
+    checkSeries<ADAA2<TanhNL>, 2>("ADAA2");
+    checkSeriesTiers();
+
     std::println();
     std::println("error-surface maxima: TanhNL {:.3e}, AlgebraicNL {:.3e}", sTanh, sAlg);
     std::println();
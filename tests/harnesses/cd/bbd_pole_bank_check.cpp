@@ -2,8 +2,11 @@
 //
 // Verification harness for BBD analytic Sallen-Key pole banks:
 // closed-form self-consistency, DC unity, magnitude/phase response against
-// analytic Butterworth prototype, and cross-check against cascaded WDF Sallen-Key sections.
+// analytic Butterworth prototype, cross-check against cascaded WDF Sallen-Key sections,
+// and drift of the incremental pole rotation that BrigadeLine::readTap runs per event,
+// also under a moving clock.
 
+#include "dsp/bbd/BrigadeLine.h"
 #include "dsp/bbd/PoleBank.h"
 #include "dsp/SallenKeyLPF.h"
 
@@ -129,7 +132,7 @@ int main()
                     inBank.process (inSample);
                     float y = 0.0f;
                     for (int m = 0; m < 4; ++m)
-                        y += (pr.residues[m] * static_cast<std::complex<double>>(inBank.x[m])).real();
+                        y += (pr.residues[m] * static_cast<std::complex<double>>(inBank.getX (m))).real();
                     ir[n] = y;
                 }
 
@@ -189,7 +192,7 @@ int main()
             inBank.process (n == 0 ? 1.0f : 0.0f);
             float y = 0.0f;
             for (int m = 0; m < 4; ++m)
-                y += (pr.residues[m] * static_cast<std::complex<double>>(inBank.x[m])).real();
+                y += (pr.residues[m] * static_cast<std::complex<double>>(inBank.getX (m))).real();
             irBank[n] = y;
         }
 
@@ -204,6 +207,140 @@ int main()
         }
     }
 
+    // 4. Incremental rotation: Gcalc advanced by Aplus tracks calcG at the
+    //    same event times, for as many events as one audio sample can hold.
+    g_section = "incremental_rotation_drift";
+    {
+        constexpr float kGate = 1.0e-5f;
+        float worstIn = 0.0f;
+        float worstOut = 0.0f;
+        for (double rate : testRates)
+        {
+            const float Ts = static_cast<float> (1.0 / rate);
+            const float fs = static_cast<float> (rate);
+            for (float clkRatio : { 100.0f, 37.0f, 8.0f, 2.5f, 1.0f, 1.0f / 30.0f })
+            {
+                const float stepNorm = (1.0f / (clkRatio * fs)) * fs;
+                const float delta = 2.0f * stepNorm;
+
+                InputPoleBank inRef (Ts), inInc (Ts);
+                OutputPoleBank outRef (Ts), outInc (Ts);
+                inInc.set_delta (delta);
+                outInc.set_delta (delta);
+
+                for (float tn0 : { 0.0f, 0.37f * stepNorm, 0.999f * stepNorm })
+                {
+                    inInc.calcG (tn0);
+                    outInc.calcG (tn0);
+                    float tn = tn0;
+                    for (int k = 0; tn < 1.0f; ++k)
+                    {
+                        if (k > 0)
+                        {
+                            inInc.advanceG();
+                            outInc.advanceG();
+                        }
+                        inRef.calcG (tn);
+                        outRef.calcG (tn);
+                        for (int m = 0; m < 4; ++m)
+                        {
+                            worstIn = std::max (worstIn, std::abs (inInc.getG (m) - inRef.getG (m)) / std::abs (inRef.getG (m)));
+                            worstOut = std::max (worstOut, std::abs (outInc.getG (m) - outRef.getG (m)) / std::abs (outRef.getG (m)));
+                        }
+                        tn += stepNorm;
+                        tn += stepNorm;
+                    }
+                }
+            }
+        }
+        std::println("rotation drift: input {:.3e} output {:.3e} (gate {:.1e})", worstIn, worstOut, kGate);
+        CHECK (worstIn < kGate);
+        CHECK (worstOut < kGate);
+    }
+
+    // 5. The same through BrigadeLine: incremental and exact rotations give
+    //    the same output across the clock range.
+    g_section = "incremental_line_parity";
+    {
+        constexpr double fs = 48000.0;
+        constexpr int kLen = 48000;
+        float worst = 0.0f;
+        for (float delayMs : { 1.7f, 5.0f, 50.0f, 375.0f, 853.0f })
+        {
+            std::vector<float> memInc (BrigadeLine<>::bbdStorageFloats (1), 0.0f);
+            std::vector<float> memRef (BrigadeLine<>::bbdStorageFloats (1), 0.0f);
+            BrigadeLine<> inc, ref;
+            inc.prepare (fs, memInc.data());
+            ref.prepare (fs, memRef.data());
+            ref.setIncrementalPoles (false);
+            inc.setDelaySeconds (delayMs * 0.001f);
+            ref.setDelaySeconds (delayMs * 0.001f);
+
+            float peak = 0.0f;
+            float diff = 0.0f;
+            for (int n = 0; n < kLen; ++n)
+            {
+                const float u = 0.5f * static_cast<float> (std::sin (2.0 * std::numbers::pi * 440.0 * n / fs))
+                              + ((n % 4801) == 0 ? 0.4f : 0.0f);
+                const float a = inc.process (u);
+                const float b = ref.process (u);
+                peak = std::max (peak, std::fabs (b));
+                diff = std::max (diff, std::fabs (a - b));
+            }
+            const float rel = diff / std::max (peak, 1.0e-9f);
+            std::println("delay={:.1f}ms peak={:.4f} max|inc-exact|={:.3e} rel={:.3e}", delayMs, peak, diff, rel);
+            CHECK (peak > 0.1f);
+            CHECK (rel < 4.0e-6f);
+            worst = std::max (worst, rel);
+        }
+        std::println("line parity worst rel {:.3e}", worst);
+    }
+
+    // 6. A moving clock: setClockHz keeps the rotation step while the clock
+    //    stays within kRetuneTolerance of the one it was taken for. The
+    //    exact path has no step, so it is the reference for the lag.
+    g_section = "retune_tolerance";
+    {
+        constexpr double fs = 48000.0;
+        constexpr int kLen = 48000;
+        float worst = 0.0f;
+        for (float delayMs : { 5.0f, 50.0f, 375.0f })
+        {
+            for (float depth : { 4.0e-6f, 3.0e-3f })
+            {
+                std::vector<float> memInc (BrigadeLine<>::bbdStorageFloats (1), 0.0f);
+                std::vector<float> memRef (BrigadeLine<>::bbdStorageFloats (1), 0.0f);
+                BrigadeLine<> inc, ref;
+                inc.prepare (fs, memInc.data());
+                ref.prepare (fs, memRef.data());
+                ref.setIncrementalPoles (false);
+                const float clk0 = 2.0f * static_cast<float> (BrigadeLine<>::kStages) / (delayMs * 0.001f);
+
+                float peak = 0.0f;
+                float diff = 0.0f;
+                for (int n = 0; n < kLen; ++n)
+                {
+                    const float clk = clk0 * (1.0f + depth * static_cast<float> (std::sin (2.0 * std::numbers::pi * 0.7 * n / fs)));
+                    inc.setClockHz (clk);
+                    ref.setClockHz (clk);
+                    const float u = 0.5f * static_cast<float> (std::sin (2.0 * std::numbers::pi * 440.0 * n / fs))
+                                  + ((n % 4801) == 0 ? 0.4f : 0.0f);
+                    const float a = inc.process (u);
+                    const float b = ref.process (u);
+                    peak = std::max (peak, std::fabs (b));
+                    diff = std::max (diff, std::fabs (a - b));
+                }
+                const float rel = diff / std::max (peak, 1.0e-9f);
+                std::println("delay={:.0f}ms wobble={:.0e}: max|inc-exact|={:.3e} rel={:.3e}",
+                             delayMs, static_cast<double> (depth), diff, rel);
+                CHECK (peak > 0.1f);
+                CHECK (rel < 4.0e-6f);
+                worst = std::max (worst, rel);
+            }
+        }
+        std::println("retune tolerance worst rel {:.3e}", worst);
+    }
+
     std::println("=== bbd_pole_bank_check OK ===");
     return 0;
 }
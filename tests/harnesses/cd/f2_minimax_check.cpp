@@ -62,6 +62,14 @@
 //                           The python scripts re-derive the values and
 //                           exit non-zero on drift; they run in CI
 //                           alongside these harnesses.
+//  13. Block kernels      – Simd::KernelTable::tanhF1Block/tanhF2Block at
+//                           every tier this machine runs, over the section
+//                           2/3 sweep with both signs. Same gates as
+//                           sections 2/3 against the oracle, at most 1 ulp
+//                           from f1Tanh/f2Tanh (regions I and III are the
+//                           same expressions; region II swaps std::exp for
+//                           the packed one), and bit-identical across
+//                           tiers. NaN and +-inf follow the scalar kernels.
 //
 // Usage: f2_minimax_check [--full] [--points N]
 //   Default: CI-sized sweep counts. --full: the dense local counts.
@@ -73,11 +81,14 @@
 // armed in a Debug configure.
 
 #include "math/TanhAntiderivatives.h"
+#include "simd/Kernels.h"
 
 #include "f2_dd_oracle.h"
 
 #include <cmath>
 #include <cstdio>
+#include <limits>
+#include <vector>
 #include <print>
 #include <cstdlib>
 #include <cstring>
@@ -443,6 +454,76 @@ void sectionTranscription()
     std::println("    (the python derivation scripts re-derive these values and\n     exit non-zero on drift; they run in CI alongside this harness)");
 }
 
+// 13. Block kernels
+void sectionBlockKernels()
+{
+    g_section = "block kernels";
+    using MarsDSP::Simd::Isa;
+    const int n = gPoints;
+    std::vector<double> x(static_cast<size_t>(2 * n) + 3);
+    for (int i = 0; i < n; ++i)
+    {
+        const double v = 1e-12 * std::pow(1e15, static_cast<double>(i) / (n - 1));
+        x[static_cast<size_t>(2 * i)] = v;
+        x[static_cast<size_t>(2 * i + 1)] = -v;
+    }
+    // An odd count, so the padded tail runs too.
+    const size_t nx = x.size();
+    x[nx - 3] = std::numeric_limits<double>::quiet_NaN();
+    x[nx - 2] = std::numeric_limits<double>::infinity();
+    x[nx - 1] = -std::numeric_limits<double>::infinity();
+
+    std::vector<double> base1(nx), base2(nx), y1(nx), y2(nx);
+    for (int t = 0; t < MarsDSP::Simd::kNumIsas; ++t)
+    {
+        const Isa isa = static_cast<Isa>(t);
+        if (!MarsDSP::Simd::isaAvailable(isa)) continue;
+        const auto &k = MarsDSP::Simd::kernelsFor(isa);
+        k.tanhF1Block(x.data(), y1.data(), static_cast<int>(nx));
+        k.tanhF2Block(x.data(), y2.data(), static_cast<int>(nx));
+
+        double worst1 = 0.0, worst2 = 0.0, scalar1 = 0.0, scalar2 = 0.0;
+        for (size_t i = 0; i + 3 < nx; ++i)
+        {
+            const double v = x[i];
+            const double r1 = toDouble(f1DD(v));
+            const double r2 = toDouble(f2DD(v));
+            worst1 = std::fmax(worst1, std::fabs(y1[i] - r1) / std::fabs(r1));
+            worst2 = std::fmax(worst2, std::fabs(y2[i] - r2) / std::fabs(r2));
+            scalar1 = std::fmax(scalar1, std::fabs(y1[i] - f1Tanh(v)) / std::fabs(f1Tanh(v)));
+            scalar2 = std::fmax(scalar2, std::fabs(y2[i] - f2Tanh(v)) / std::fabs(f2Tanh(v)));
+        }
+        for (size_t i = nx - 3; i < nx; ++i)
+        {
+            const double v = x[i];
+            if (std::isnan(v))
+            {
+                CHECK(std::isnan(y1[i]) && std::isnan(y2[i]));
+                continue;
+            }
+            CHECK(y1[i] == f1Tanh(v));
+            CHECK(y2[i] == f2Tanh(v));
+        }
+        std::println("    {:<8} F1 {:.3} ulp, F2 {:.3} ulp vs oracle; {:.3} / {:.3} ulp from f1Tanh/f2Tanh",
+                    MarsDSP::Simd::isaName(isa), ulpOf(worst1), ulpOf(worst2), ulpOf(scalar1), ulpOf(scalar2));
+        CHECK(ulpOf(worst1) <= 2.0);
+        CHECK(ulpOf(worst2) <= 3.0);
+        CHECK(ulpOf(scalar1) <= 1.0);
+        CHECK(ulpOf(scalar2) <= 1.0);
+
+        if (t == 0)
+        {
+            base1 = y1;
+            base2 = y2;
+            continue;
+        }
+        for (size_t i = 0; i + 3 < nx; ++i)
+            if (y1[i] != base1[i] || y2[i] != base2[i])
+                FAIL("{} differs from SSE4.2 at x = {:.17}", MarsDSP::Simd::isaName(isa), x[i]);
+    }
+    std::println("block kernels within gates, <= 1 ulp from scalar, identical across tiers: PASS");
+}
+
 int runAll()
 {
     F2Oracle::init();
@@ -458,6 +539,7 @@ int runAll()
     sectionExtremes();
     sectionBasisCond();
     sectionTranscription();
+    sectionBlockKernels();
     return 0;
 }
 
@@ -1,5 +1,7 @@
 // tests/harnesses/dsp/alias_check.cpp
+#include <algorithm>
 #include <array>
+#include <chrono>
 #include <cmath>
 #include <format>
 #include <print>
@@ -10,12 +12,14 @@
 #include "dsp/nonlinear/ADAA1.h"
 #include "dsp/nonlinear/ADAA2.h"
 #include "dsp/nonlinear/Nonlinearities.h"
+#include "dsp/nonlinear/Oversampler.h"
 
 namespace {
 
 using MarsDSP::Nonlinear::ADAA1;
 using MarsDSP::Nonlinear::ADAA2;
 using MarsDSP::Nonlinear::TanhNL;
+using Oversampler = MarsDSP::Nonlinear::Oversampler<64>;
 
 const char* g_section = "(startup)";
 
@@ -224,7 +228,7 @@ std::vector<double> downsample2x(const std::vector<double>& x, const std::vector
 
 // configurations
 
-enum Config { kNone = 0, kIdentity, kADAA1, kADAA2, kADAA1x2, kIdentityX2 };
+enum Config { kNone = 0, kIdentity, kADAA1, kADAA2, kADAA1x2, kIdentityX2, kOs2, kOs4 };
 
 const char* configName(Config c)
 {
@@ -235,6 +239,8 @@ const char* configName(Config c)
         case kADAA1:       return "ADAA1";
         case kADAA2:       return "ADAA2";
         case kADAA1x2:     return "ADAA1@2x";
+        case kOs2:         return "OS2";
+        case kOs4:         return "OS4";
         default:           return "identity@2x";
     }
 }
@@ -253,7 +259,20 @@ std::vector<double> render(Config cfg, int k0, double driveLin, const std::vecto
 
     std::vector<double> out(static_cast<std::size_t>(total));
 
-    if (cfg == kADAA1x2 || cfg == kIdentityX2)
+    if (cfg == kOs2 || cfg == kOs4)
+    {
+        // The engine's oversampled saturator, in float, a tile at a time.
+        Oversampler os;
+        os.setFactor(cfg == kOs2 ? 2 : 4);
+        std::vector<float> buf(static_cast<std::size_t>(total));
+        for (int n = 0; n < total; ++n)
+            buf[static_cast<std::size_t>(n)] = static_cast<float>(driveLin * x[static_cast<std::size_t>(n)]);
+        for (int n = 0; n < total; n += 64)
+            os.process(buf.data() + n, std::min(64, total - n));
+        for (int n = 0; n < total; ++n)
+            out[static_cast<std::size_t>(n)] = buf[static_cast<std::size_t>(n)];
+    }
+    else if (cfg == kADAA1x2 || cfg == kIdentityX2)
     {
         const std::vector<double> up = upsample2x(x, h);
         std::vector<double> sat(up.size());
@@ -445,6 +464,91 @@ int main()
         FAIL("ADAA2 must beat no-ADAA by >= 20 dB at 10 kHz / 24 dB; got {:.1} dB", improvement);
     std::println("       -> PASS (>= 20 dB)");
 
+    // oversampling against ADAA: alias floor and cost, to choose per preset
+    g_section = "oversampling";
+    {
+        // ns per base-rate sample, best of five passes over one window.
+        auto costNs = [&](Config cfg)
+        {
+            std::vector<double> x(static_cast<std::size_t>(kN));
+            for (int n = 0; n < kN; ++n)
+                x[static_cast<std::size_t>(n)] = 16.0 * std::sin(0.05 * static_cast<double>(n));
+            std::vector<float> xf(x.begin(), x.end());
+            double best = 1e30;
+            volatile double sink = 0.0;
+            for (int pass = 0; pass < 5; ++pass)
+            {
+                const auto t0 = std::chrono::steady_clock::now();
+                if (cfg == kADAA1 || cfg == kADAA2)
+                {
+                    ADAA1<TanhNL> a1;
+                    ADAA2<TanhNL> a2;
+                    double acc = 0.0;
+                    for (int n = 0; n < kN; ++n)
+                        acc += cfg == kADAA1 ? a1.process(x[static_cast<std::size_t>(n)])
+                                             : a2.process(x[static_cast<std::size_t>(n)]);
+                    sink = sink + acc;
+                }
+                else
+                {
+                    Oversampler os;
+                    os.setFactor(cfg == kOs2 ? 2 : 4);
+                    std::vector<float> buf = xf;
+                    for (int n = 0; n < kN; n += 64)
+                        os.process(buf.data() + n, 64);
+                    sink = sink + buf[static_cast<std::size_t>(kN - 1)];
+                }
+                const auto t1 = std::chrono::steady_clock::now();
+                best = std::fmin(best, std::chrono::duration<double, std::nano>(t1 - t0).count() / kN);
+            }
+            return best;
+        };
+
+        const std::array<Config, 4> alt = {{ kADAA1, kADAA2, kOs2, kOs4 }};
+        std::println("[oversampling] alias floor (dBc) against cost; OS2/OS4 are the engine's");
+        std::println("      half-band oversampler around fastTanh, in float");
+        std::array<double, 4> cost{};
+        for (int c = 0; c < 4; ++c)
+            cost[static_cast<std::size_t>(c)] = costNs(alt[static_cast<std::size_t>(c)]);
+        std::println("      {:<10} {:<10} {:<10} {:<10}  (ns/sample)",
+                    configName(alt[0]), configName(alt[1]), configName(alt[2]), configName(alt[3]));
+        std::println("      {:<10.1f} {:<10.1f} {:<10.1f} {:<10.1f}", cost[0], cost[1], cost[2], cost[3]);
+
+        double midAdaa2 = 0.0, midOs4 = 0.0;   // 2 kHz / 24 dB
+        for (const double dB : { 12.0, 24.0, 40.0 })
+        {
+            const double driveLin = std::pow(10.0, dB / 20.0);
+            std::println("    [drive {:.0f} dB]  f0 (Hz)  {:<10} {:<10} {:<10} {:<10}",
+                        dB, configName(alt[0]), configName(alt[1]), configName(alt[2]), configName(alt[3]));
+            for (const double f0 : { 1000.0, 2000.0, 5000.0, 10000.0 })
+            {
+                const int k0 = roundToOdd(f0 * static_cast<double>(kN) / kFs);
+                const double fAct = static_cast<double>(k0) * kFs / static_cast<double>(kN);
+                std::array<double, 4> v{};
+                for (int c = 0; c < 4; ++c)
+                    v[static_cast<std::size_t>(c)] = analyze(render(alt[static_cast<std::size_t>(c)], k0, driveLin, h), k0).aliasDbc;
+                std::println("                  {:8.1f} {} {} {} {}",
+                            fAct, fmtDbc(v[0]), fmtDbc(v[1]), fmtDbc(v[2]), fmtDbc(v[3]));
+                if (dB == 24.0 && f0 == 2000.0)
+                {
+                    midAdaa2 = v[1];
+                    midOs4 = v[3];
+                }
+            }
+        }
+
+        // Neither wins everywhere. Near Nyquist at high drive the harmonics
+        // that fold at 4 fs are still strong, and ADAA2's lowpass wins; below
+        // a few kHz the oversampler's clean band wins at similar cost. The
+        // gate holds the second claim, where oversampling earns its place.
+        const double osImprovement = clampFloor(midAdaa2) - clampFloor(midOs4);
+        std::println("[gate] 2 kHz / 24 dB: ADAA2 {:.1f} dBc, OS4 {:.1f} dBc -> {:.1f} dB better",
+                    midAdaa2, midOs4, osImprovement);
+        if (osImprovement < 10.0)
+            FAIL("OS4 must beat ADAA2 by >= 10 dB at 2 kHz / 24 dB; got {:.1f} dB", osImprovement);
+        std::println("       -> PASS (>= 10 dB)");
+    }
+
     std::println("\n=== ALL PROPERTIES HELD ===");
     return 0;
 }
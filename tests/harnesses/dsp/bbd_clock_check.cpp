@@ -1,6 +1,6 @@
 // tests/harnesses/dsp/bbd_clock_check.cpp
 //
-// Verification harness for ClockModel: exact inverse mapping,
+// Verification harness for ClockModel: exact inverse mapping for every chip,
 // OU-driven pitch deviation, stereo channel decorrelation, and step response.
 
 #include "dsp/bbd/ClockModel.h"
@@ -26,8 +26,8 @@ namespace
         }                                                                                \
     } while (0)
 
-    using MarsDSP::BBD::BrigadeLine;
-    using MarsDSP::BBD::ClockModel;
+    using BrigadeLine = MarsDSP::BBD::BrigadeLine<>;
+    using ClockModel = MarsDSP::BBD::ClockModel<>;
     using MarsDSP::Mod::OrnsteinUhlenbeck;
 
     constexpr double kFs = 48000.0;
@@ -99,6 +99,35 @@ namespace
         CHECK (count > 1000);
         return std::sqrt (sumSq / static_cast<double> (count));
     }
+
+    // clockFor and achievedDelaySamples invert each other over the whole
+    // clock range of a Stages-bucket chip, and clockForBlock matches clockFor.
+    template <int Stages>
+    void checkInverseMapping (double fs)
+    {
+        using Model = MarsDSP::BBD::ClockModel<Stages>;
+        const float minD = Model::achievedDelaySamples (Model::maxClockHz (fs), fs);
+        const float maxD = Model::achievedDelaySamples (Model::minClockHz (fs), fs);
+
+        for (float d = minD + 1.0f; d < maxD - 1.0f; d += 50.0f)
+        {
+            const float clk = Model::clockFor (d, fs);
+            const float recovered = Model::achievedDelaySamples (clk, fs);
+            const double relErr = std::fabs (recovered - d) / d;
+            CHECK (relErr < 1.0e-6);
+        }
+
+        // The block form gives clockFor's clocks bit for bit, clamps and
+        // tail included.
+        std::vector<float> delays;
+        for (float d = 0.25f * minD; d < 1.5f * maxD; d *= 1.01f)
+            delays.push_back (d);
+        delays.push_back (-3.0f);
+        std::vector<float> clocks (delays.size());
+        Model::clockForBlock (delays.data(), clocks.data(), static_cast<int> (delays.size()), fs);
+        for (std::size_t i = 0; i < delays.size(); ++i)
+            CHECK (clocks[i] == Model::clockFor (delays[i], fs));
+    }
 } // namespace
 
 int main()
@@ -106,18 +135,13 @@ int main()
     // 1. Exact Inverse Mapping
     g_section = "inverse_mapping";
     {
+        using MarsDSP::BBD::kChipStages;
         for (double fs : { 44100.0, 48000.0, 96000.0 })
         {
-            const float minD = ClockModel::achievedDelaySamples (ClockModel::maxClockHz (fs), fs);
-            const float maxD = ClockModel::achievedDelaySamples (ClockModel::minClockHz (fs), fs);
-
-            for (float d = minD + 1.0f; d < maxD - 1.0f; d += 50.0f)
-            {
-                const float clk = ClockModel::clockFor (d, fs);
-                const float recovered = ClockModel::achievedDelaySamples (clk, fs);
-                const double relErr = std::fabs (recovered - d) / d;
-                CHECK (relErr < 1.0e-6);
-            }
+            checkInverseMapping<kChipStages[0]> (fs);
+            checkInverseMapping<kChipStages[1]> (fs);
+            checkInverseMapping<kChipStages[2]> (fs);
+            checkInverseMapping<kChipStages[3]> (fs);
         }
     }
 
@@ -26,7 +26,7 @@ namespace
         }                                                                                \
     } while (0)
 
-    using MarsDSP::BBD::BrigadeLine;
+    using BrigadeLine = MarsDSP::BBD::BrigadeLine<>;
     using MarsDSP::Delays::FeedbackDelay;
 
     constexpr double kFs = 48000.0;
@@ -2,9 +2,12 @@
 //
 // Correctness harness for BrigadeLine: transport centroid, DC unity,
 // zero-in/zero-out, reset determinism, block-size invariance, clock clamps,
-// and parameter sweep robustness.
+// parameter sweep robustness, StereoBrigadeLine lockstep parity, the
+// transport of every chip's stage count, and readAhead/writeAhead parity.
 
 #include "dsp/bbd/BrigadeLine.h"
+#include "dsp/bbd/ClockModel.h"
+#include "dsp/bbd/StereoBrigadeLine.h"
 
 #include <algorithm>
 #include <cmath>
@@ -25,7 +28,111 @@ namespace
         }                                                                                \
     } while (0)
 
-    using MarsDSP::BBD::BrigadeLine;
+    using BrigadeLine = MarsDSP::BBD::BrigadeLine<>;
+
+    // Impulse centroid of a Stages-bucket line clocked by ClockModel<Stages>
+    // for samplesPerStage * Stages, minus the delay the model says it
+    // achieves. Equal samplesPerStage means an equal clock for every chip.
+    template <int Stages>
+    double chipCentroidError (double fs, float samplesPerStage)
+    {
+        const float delaySamples = samplesPerStage * static_cast<float> (Stages);
+        using Line = MarsDSP::BBD::BrigadeLine<Stages>;
+        using Clock = MarsDSP::BBD::ClockModel<Stages>;
+
+        std::vector<float> mem (Line::bbdStorageFloats (1), 0.0f);
+        Line line;
+        line.prepare (fs, mem.data());
+        const float clk = Clock::clockFor (delaySamples, fs);
+        line.setClockHz (clk);
+
+        const double expected = static_cast<double> (Clock::achievedDelaySamples (clk, fs))
+                              + Line::getBankGroupDelayAtDC (fs);
+        const int total = static_cast<int> (expected + 1000.0);
+        double sumWeight = 0.0;
+        double sumEnergy = 0.0;
+        for (int i = 0; i < total; ++i)
+        {
+            const double y = line.process (i == 0 ? 1.0f : 0.0f);
+            if (std::fabs (static_cast<double> (i) - expected) < 300.0)
+            {
+                sumWeight += static_cast<double> (i) * y * y;
+                sumEnergy += y * y;
+            }
+        }
+        CHECK (sumEnergy > 1.0e-12);
+        return sumWeight / sumEnergy - expected;
+    }
+
+    // Clock wobble that crosses kRetuneTolerance both ways, and a feedback
+    // input: each tap goes into the next write, so a deferred input half
+    // run on the wrong sample would show.
+    float wobbleClock (float clkBase, int i)
+    {
+        return clkBase * (1.0f + 0.02f * std::sin (0.003f * static_cast<float> (i)));
+    }
+
+    float loopInput (int i, float tap)
+    {
+        const float x = 0.5f * std::sin (0.021f * static_cast<float> (i)) + ((i % 1499) == 0 ? 0.5f : 0.0f);
+        return x + 0.6f * std::tanh (tap);
+    }
+
+    // Run lengths asked of readAhead, 1 to kMaxAhead.
+    int askedRun (int k, int maxAhead)
+    {
+        return 1 + (k * 37) % maxAhead;
+    }
+
+    // One line in a feedback loop, through readAhead and writeAhead in
+    // runs of varying length, against setClockHz, readTap and writeSample
+    // per sample. Returns how many runs came back shorter than asked.
+    template <int Stages>
+    int readAheadParity (double fs, float clkBase, bool bounded)
+    {
+        using Line = MarsDSP::BBD::BrigadeLine<Stages>;
+        constexpr int N = 6000;
+
+        std::vector<float> memRef (Line::bbdStorageFloats (1), 0.0f);
+        std::vector<float> memRun (Line::bbdStorageFloats (1), 0.0f);
+        Line ref;
+        Line run;
+        ref.prepare (fs, memRef.data());
+        run.prepare (fs, memRun.data());
+        ref.setBoundedCost (bounded);
+        run.setBoundedCost (bounded);
+
+        std::vector<float> clocks (N);
+        for (int i = 0; i < N; ++i)
+            clocks[i] = wobbleClock (clkBase, i);
+
+        std::vector<float> refOut (N);
+        for (int i = 0; i < N; ++i)
+        {
+            ref.setClockHz (clocks[i]);
+            refOut[i] = ref.readTap();
+            ref.writeSample (loopInput (i, refOut[i]));
+        }
+
+        std::vector<float> runOut (N);
+        int cut = 0;
+        for (int i = 0, k = 0; i < N; ++k)
+        {
+            const int asked = std::min (askedRun (k, Line::kMaxAhead), N - i);
+            const int m = run.readAhead (clocks.data() + i, runOut.data() + i, asked);
+            CHECK (m >= 1 && m <= asked);
+            CHECK (m == run.aheadLimit (clocks.data() + i, asked));
+            if (m < asked)
+                ++cut;
+            for (int j = i; j < i + m; ++j)
+                run.writeAhead (loopInput (j, runOut[j]));
+            i += m;
+        }
+
+        for (int i = 0; i < N; ++i)
+            CHECK (runOut[i] == refOut[i]);
+        return cut;
+    }
 } // namespace
 
 int main()
@@ -174,6 +281,38 @@ int main()
             for (int i = 0; i < N; ++i)
                 CHECK (blockOut[i] == refOut[i]);
         }
+
+        // processBlock with a moving clock against setClockHz and process
+        // per sample. The wobble crosses kRetuneTolerance both ways.
+        std::vector<float> clocks (N);
+        for (int i = 0; i < N; ++i)
+            clocks[i] = 819200.0f * (1.0f + 0.02f * std::sin (0.003f * static_cast<float> (i)));
+
+        std::vector<float> memRef (BrigadeLine::bbdStorageFloats (1), 0.0f);
+        BrigadeLine lineRef;
+        lineRef.prepare (fs, memRef.data());
+        for (int i = 0; i < N; ++i)
+        {
+            lineRef.setClockHz (clocks[i]);
+            refOut[i] = lineRef.process (input[i]);
+        }
+
+        for (int bs : { 1, 7, 64, 512 })
+        {
+            std::vector<float> memBlock (BrigadeLine::bbdStorageFloats (1), 0.0f);
+            BrigadeLine lineBlock;
+            lineBlock.prepare (fs, memBlock.data());
+
+            std::vector<float> blockOut (N);
+            for (int off = 0; off < N; off += bs)
+            {
+                const int cur = std::min (bs, N - off);
+                lineBlock.processBlock (input.data() + off, clocks.data() + off, blockOut.data() + off, cur);
+            }
+
+            for (int i = 0; i < N; ++i)
+                CHECK (blockOut[i] == refOut[i]);
+        }
     }
 
     // 6. Clock Clamps
@@ -218,6 +357,189 @@ int main()
         CHECK (maxOut <= 4.0f);
     }
 
+    // 8. StereoBrigadeLine against two independent lines, bit for bit:
+    //    equal clocks (lockstep), split clocks (fallback), equal again
+    //    (still out of phase), then reset (lockstep again).
+    g_section = "stereo_lockstep_parity";
+    {
+        using StereoBrigadeLine = MarsDSP::BBD::StereoBrigadeLine<>;
+        constexpr double fs = 48000.0;
+        constexpr int kSeg = 12000;
+
+        std::vector<float> memS (StereoBrigadeLine::bbdStorageFloats(), 0.0f);
+        std::vector<float> memL (BrigadeLine::bbdStorageFloats (1), 0.0f);
+        std::vector<float> memR (BrigadeLine::bbdStorageFloats (1), 0.0f);
+        const std::size_t perChan = BrigadeLine::bbdStorageFloats (1);
+
+        StereoBrigadeLine stereo;
+        stereo.prepare (fs, memS.data(), memS.data() + perChan);
+        BrigadeLine refL, refR;
+        refL.prepare (fs, memL.data());
+        refR.prepare (fs, memR.data());
+
+        int n = 0;
+        auto runSegment = [&] (float clkL, float clkR, bool expectLocked)
+        {
+            for (int i = 0; i < kSeg; ++i, ++n)
+            {
+                // A slow clock wobble keeps the event count per sample moving.
+                const float wobble = 1.0f + 0.05f * std::sin (0.0007f * static_cast<float> (n));
+                const float cL = clkL * wobble;
+                const float cR = clkR * wobble;
+                const float uL = 0.5f * std::sin (0.031f * static_cast<float> (n));
+                const float uR = 0.4f * std::sin (0.017f * static_cast<float> (n)) + ((n % 997) == 0 ? 0.3f : 0.0f);
+
+                stereo.setClockHz (cL, cR);
+                CHECK (stereo.isLocked() == expectLocked);
+                float yL = 0.0f;
+                float yR = 0.0f;
+                stereo.readTap (yL, yR);
+                stereo.writeSample (uL, uR);
+
+                refL.setClockHz (cL);
+                refR.setClockHz (cR);
+                const float rL = refL.process (uL);
+                const float rR = refR.process (uR);
+                CHECK (yL == rL);
+                CHECK (yR == rR);
+            }
+        };
+
+        for (float clk : { 700000.0f, 90000.0f, 9000.0f })
+        {
+            stereo.reset();
+            refL.reset();
+            refR.reset();
+            runSegment (clk, clk, true);
+            runSegment (clk, clk * 1.013f, false);
+            runSegment (clk, clk, false);
+
+            stereo.reset();
+            refL.reset();
+            refR.reset();
+            runSegment (clk, clk, true);
+        }
+
+        // The reference switch keeps the lines apart.
+        stereo.reset();
+        refL.reset();
+        refR.reset();
+        stereo.setLockstep (false);
+        runSegment (60000.0f, 60000.0f, false);
+        stereo.setLockstep (true);
+        std::println("stereo lockstep parity: bit-exact over {} samples", n);
+    }
+
+    // 9. Each chip's stage count: storage follows the stage count, and the
+    //    clock ClockModel picks for a delay lands the impulse there. The
+    //    delays scale with the stage count, so every chip runs at clocks of
+    //    about 8, 2 and 1 times fs.
+    g_section = "chip_stage_counts";
+    {
+        using MarsDSP::BBD::kChipStages;
+        static_assert (MarsDSP::BBD::BrigadeLine<kChipStages[0]>::bbdStorageFloats (1) >= kChipStages[0] + 1);
+        static_assert (MarsDSP::BBD::BrigadeLine<kChipStages[3]>::bbdStorageFloats (1) < kChipStages[3] + 17);
+        static_assert (MarsDSP::BBD::BrigadeLine<kChipStages[1]>::bbdStorageFloats (1)
+                       < MarsDSP::BBD::BrigadeLine<kChipStages[0]>::bbdStorageFloats (1));
+
+        for (double fs : { 44100.0, 96000.0 })
+        {
+            for (float samplesPerStage : { 0.25f, 1.0f, 2.0f })
+            {
+                const std::array<double, 4> err {
+                    chipCentroidError<kChipStages[0]> (fs, samplesPerStage),
+                    chipCentroidError<kChipStages[1]> (fs, samplesPerStage),
+                    chipCentroidError<kChipStages[2]> (fs, samplesPerStage),
+                    chipCentroidError<kChipStages[3]> (fs, samplesPerStage)
+                };
+                for (double e : err)
+                    CHECK (std::fabs (e) < 2.5);
+                std::println("fs={:.0f} d={:.2f} x stages: centroid error {:+.3f} {:+.3f} {:+.3f} {:+.3f} samples"
+                             " (4096/2048/1024/512 stages)",
+                             fs, static_cast<double> (samplesPerStage), err[0], err[1], err[2], err[3]);
+            }
+        }
+    }
+
+    // 10. readAhead and writeAhead against the per-sample calls, bit for
+    //     bit, in a feedback loop. Short lines at high clocks cut the runs
+    //     short; 16 stages at 50 fs fill the line within one sample, so
+    //     each run's first sample runs in place.
+    g_section = "read_ahead_parity";
+    {
+        using MarsDSP::BBD::kChipStages;
+        constexpr double fs = 48000.0;
+
+        CHECK (readAheadParity<kChipStages[0]> (fs, 819200.0f, false) == 0);
+        CHECK (readAheadParity<kChipStages[0]> (fs, 1700.0f, false) == 0);
+        readAheadParity<kChipStages[0]> (fs, 4000000.0f, true);
+        const int cut512 = readAheadParity<kChipStages[3]> (fs, 4700000.0f, false);
+        CHECK (cut512 > 0);
+        const int cut16 = readAheadParity<16> (fs, 2400000.0f, false);
+        CHECK (cut16 > 0);
+
+        // Both lines of a StereoBrigadeLine, in lockstep and apart, against
+        // two independent lines.
+        using StereoBrigadeLine = MarsDSP::BBD::StereoBrigadeLine<>;
+        constexpr int kSeg = 6000;
+        std::vector<float> memS (StereoBrigadeLine::bbdStorageFloats(), 0.0f);
+        std::vector<float> memL (BrigadeLine::bbdStorageFloats (1), 0.0f);
+        std::vector<float> memR (BrigadeLine::bbdStorageFloats (1), 0.0f);
+        const std::size_t perChan = BrigadeLine::bbdStorageFloats (1);
+
+        StereoBrigadeLine stereo;
+        stereo.prepare (fs, memS.data(), memS.data() + perChan);
+        BrigadeLine refL, refR;
+        refL.prepare (fs, memL.data());
+        refR.prepare (fs, memR.data());
+
+        std::vector<float> clkL (kSeg), clkR (kSeg), outL (kSeg), outR (kSeg);
+        auto runSegment = [&] (float baseL, float baseR, bool expectLocked)
+        {
+            for (int i = 0; i < kSeg; ++i)
+            {
+                clkL[i] = wobbleClock (baseL, i);
+                clkR[i] = wobbleClock (baseR, i);
+            }
+            bool lockedAll = true;
+            for (int i = 0, k = 0; i < kSeg; ++k)
+            {
+                const int asked = std::min (askedRun (k, BrigadeLine::kMaxAhead), kSeg - i);
+                const int m = stereo.readAhead (clkL.data() + i, clkR.data() + i,
+                                                outL.data() + i, outR.data() + i, asked);
+                CHECK (m >= 1 && m <= asked);
+                lockedAll = lockedAll && stereo.isLocked();
+                for (int j = i; j < i + m; ++j)
+                {
+                    stereo.writeAhead (loopInput (j, outL[j]), loopInput (j + 7, outR[j]));
+
+                    refL.setClockHz (clkL[j]);
+                    refR.setClockHz (clkR[j]);
+                    const float rL = refL.readTap();
+                    const float rR = refR.readTap();
+                    refL.writeSample (loopInput (j, rL));
+                    refR.writeSample (loopInput (j + 7, rR));
+                    CHECK (outL[j] == rL);
+                    CHECK (outR[j] == rR);
+                }
+                i += m;
+            }
+            CHECK (lockedAll == expectLocked);
+        };
+
+        for (float clk : { 700000.0f, 90000.0f })
+        {
+            stereo.reset();
+            refL.reset();
+            refR.reset();
+            runSegment (clk, clk, true);
+            runSegment (clk, clk * 1.013f, false);
+            runSegment (clk, clk, false);
+        }
+        std::println("read_ahead_parity: bit-exact; runs cut short {} (512 stages), {} (16 stages)",
+                     cut512, cut16);
+    }
+
     std::println("=== bbd_line_check OK ===");
     return 0;
 }
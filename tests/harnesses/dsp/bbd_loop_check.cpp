@@ -2,7 +2,7 @@
 //
 // Acceptance harness for BBD core in FeedbackDelay:
 // loop-period identity (diffuser off and on), decay law, loop gain stability,
-// clamp semantics, and mode switching hygiene.
+// clamp semantics, mode switching hygiene, and the BBD chip choice.
 
 #include "dsp/FeedbackDelay.h"
 
@@ -214,8 +214,8 @@ int main()
         }
 
         // Delay is clamped to transport floor (~82 samples + GD_bank)
-        const double gdBank = MarsDSP::BBD::BrigadeLine::getBankGroupDelayAtDC (kFs);
-        const double expectedCentroid = (2.0 * MarsDSP::BBD::BrigadeLine::kStages + 0.5) * kFs / (100.0 * kFs) + gdBank;
+        const double gdBank = MarsDSP::BBD::BrigadeLine<>::getBankGroupDelayAtDC (kFs);
+        const double expectedCentroid = (2.0 * MarsDSP::BBD::BrigadeLine<>::kStages + 0.5) * kFs / (100.0 * kFs) + gdBank;
         const double cBbd = measureCentroid (outBbd, 0, 500);
 
         CHECK (std::fabs (cBbd - expectedCentroid) <= 2.0);
@@ -243,7 +243,7 @@ int main()
 
         // First half Digital
         for (int pos = 0; pos < 24000; pos += kBlock)
-            fb.process (in.data() + pos, nullptr, out.data() + pos, nullptr, kBlock);
+            fb.process (in.data() + pos, nullptr, out.data() + pos, nullptr, std::min (kBlock, 24000 - pos));
 
         float maxStepBefore = 0.0f;
         for (int i = 1000; i < 24000; ++i)
@@ -254,7 +254,7 @@ int main()
         fb.setParams (p);
 
         for (int pos = 24000; pos < totalSamples; pos += kBlock)
-            fb.process (in.data() + pos, nullptr, out.data() + pos, nullptr, kBlock);
+            fb.process (in.data() + pos, nullptr, out.data() + pos, nullptr, std::min (kBlock, totalSamples - pos));
 
         float maxStepAfter = 0.0f;
         for (int i = 24001; i < totalSamples; ++i)
@@ -263,6 +263,53 @@ int main()
         CHECK (maxStepAfter <= 4.0f * maxStepBefore);
     }
 
+    // 5. Chip choice: every stage count lands a 20 ms repeat where the
+    //    digital core does, also after a switch in the middle of a run.
+    g_section = "bbd_chip_choice";
+    {
+        constexpr float delaySamples = 960.0f;
+        constexpr int kSeg = 19 * kBlock;
+        std::vector<float> in (2 * kSeg, 0.0f);
+        in[0] = 1.0f;
+        in[kSeg] = 1.0f;
+
+        auto render = [&] (int mode, int chipA, int chipB)
+        {
+            std::vector<float> out (in.size(), 0.0f);
+            FeedbackDelay fb;
+            fb.prepare (kFs, kBlock, kMaxDelay);
+            FeedbackDelay::Params p;
+            p.delaySamples = delaySamples;
+            p.feedback = 0.0f;
+            p.satOrder = 0;
+            p.delayMode = mode;
+            p.bbdChip = chipA;
+            fb.resetParams (p);
+            for (int pos = 0; pos < 2 * kSeg; pos += kBlock)
+            {
+                if (pos == kSeg)
+                {
+                    p.bbdChip = chipB;
+                    fb.setParams (p);
+                }
+                fb.process (in.data() + pos, nullptr, out.data() + pos, nullptr, kBlock);
+            }
+            return out;
+        };
+
+        const std::vector<float> outDig = render (0, 0, 0);
+        const double cDig = measureCentroid (outDig, 0, kSeg);
+        for (int chip = 0; chip < 4; ++chip)
+        {
+            const std::vector<float> outBbd = render (1, chip, 3 - chip);
+            const double c1 = measureCentroid (outBbd, 0, kSeg);
+            const double c2 = measureCentroid (outBbd, kSeg, 2 * kSeg) - kSeg;
+            std::println("chip {} -> {}: cDig={:.3f} cBbd={:.3f} after switch {:.3f}", chip, 3 - chip, cDig, c1, c2);
+            CHECK (std::fabs (c1 - cDig) <= 2.0);
+            CHECK (std::fabs (c2 - cDig) <= 2.0);
+        }
+    }
+
     std::println("=== bbd_loop_check OK ===");
     return 0;
 }
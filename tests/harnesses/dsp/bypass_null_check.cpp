@@ -136,6 +136,51 @@ void testToggleClick()
     std::println("  toggle click (2 toggles, max sample step = {:.4} < 1.0): PASS", maxStep);
 }
 
+// Test 3: a settled bypass stops the feedback loop, and un-bypass restarts
+// it empty. The tail from before the bypass must not come back.
+void testUnbypassStartsEmpty()
+{
+    g_section = "un-bypass starts empty";
+    constexpr int kBlockSize = 256;
+    constexpr int kBlocks = 60;
+
+    auto p = makeParams(2);
+    p.feedback = 0.9f;
+    p.delaySamples = 4800.0f;
+
+    MarsDSP::ChronosEngine engine;
+    engine.prepare(kFs, 128, 2);
+    engine.reset();
+    engine.setDitherSeeds(0x55555555u, 0x66666666u);
+    engine.resetParams(p);
+    engine.setSleepEnabled(false);
+
+    std::vector<float> L(kBlockSize), R(kBlockSize);
+    double peakAfter = 0.0;
+    for (int b = 0; b < kBlocks; ++b)
+    {
+        // Burst in blocks 0..3, bypass over blocks 10..29, silence after the burst.
+        if (b == 10) engine.setBypass(true);
+        if (b == 30) engine.setBypass(false);
+        for (int s = 0; s < kBlockSize; ++s)
+        {
+            const int i = b * kBlockSize + s;
+            L[static_cast<std::size_t>(s)] = b < 4 ? 0.5f * static_cast<float>(std::sin(0.05 * i)) : 0.0f;
+            R[static_cast<std::size_t>(s)] = L[static_cast<std::size_t>(s)];
+        }
+        std::array<float*, 2> io{ L.data(), R.data() };
+        engine.process(io.data(), 2, kBlockSize);
+        if (b >= 30)
+            for (int s = 0; s < kBlockSize; ++s)
+                peakAfter = std::max(peakAfter, static_cast<double>(std::fabs(L[static_cast<std::size_t>(s)])));
+    }
+
+    const double lsb = static_cast<double>(std::ldexp(1.0f, 1 - 24));
+    if (peakAfter > 2.0 * lsb)
+        FAIL("tail returned after un-bypass: peak {:.3} > 2*lsb={:.3}", peakAfter, 2.0 * lsb);
+    std::println("  un-bypass after settled bypass: peak {:.3} (no old tail, 2*lsb={:.3}): PASS", peakAfter, 2.0 * lsb);
+}
+
 } // namespace
 
 int main()
@@ -147,6 +192,7 @@ int main()
         testBypassNull(mode);
 
     testToggleClick();
+    testUnbypassStartsEmpty();
 
     std::println("\n=== ALL PROPERTIES HELD ===");
     return 0;
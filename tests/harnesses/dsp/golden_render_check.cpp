@@ -10,6 +10,10 @@
 // hashes.txt. The render is deterministic: fixed sample rate, fixed block
 // size, fixed dither seeds, fixed input generators.
 //
+// Run with --bench: render every configuration twice, with the ADAA series
+// fast path off and then on, and report the process time of each, the
+// saving, and the largest output difference. No hashes are compared.
+//
 // The harness drives MarsDSP::ChronosEngine directly. It mirrors the plugin's
 // prepareToPlay + processBlock sequence: prepare, reset, resetParams (snap),
 // then per block setParams + process. SharedCode only, no JUCE.
@@ -18,6 +22,7 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cmath>
 #include <cstdint>
 #include <cstdlib>
@@ -248,10 +253,13 @@ struct RenderResult
 
 // Render one configuration against one input. A fresh engine state is used
 // (reset + resetParams snap every smoother and clear every ring), so each
-// render is independent and deterministic.
+// render is independent and deterministic. seconds, when given, receives
+// the time spent in process(); out receives the rendered audio.
 RenderResult render(MarsDSP::ChronosEngine& engine,
                     const MarsDSP::ChronosEngine::Params& p,
-                    const StereoBuffer& in)
+                    const StereoBuffer& in,
+                    double* seconds = nullptr,
+                    StereoBuffer* out = nullptr)
 {
     engine.setDitherSeeds(kDitherL, kDitherR);
     engine.reset();
@@ -260,6 +268,7 @@ RenderResult render(MarsDSP::ChronosEngine& engine,
 
     std::vector<float> outL(in.L), outR(in.R); // process is in-place
 
+    const auto t0 = std::chrono::steady_clock::now();
     int pos = 0;
     while (pos < kRenderSamples)
     {
@@ -269,6 +278,8 @@ RenderResult render(MarsDSP::ChronosEngine& engine,
         engine.process(io.data(), kChannels, n);
         pos += n;
     }
+    if (seconds)
+        *seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
 
     RenderResult r;
     Fnv1a64 h;
@@ -296,9 +307,15 @@ RenderResult render(MarsDSP::ChronosEngine& engine,
     const double rms = std::sqrt(sumSq / (2.0 * static_cast<double>(kRenderSamples)));
     r.rmsDb = (rms > 0.0) ? 20.0 * std::log10(rms) : -999.0;
     r.decayMs = (lastAbove >= 0) ? static_cast<double>(lastAbove) / kFs * 1000.0 : 0.0;
+    if (out)
+    {
+        out->L = std::move(outL);
+        out->R = std::move(outR);
+    }
     return r;
 }
 
+
 // File IO
 const char* kInputNames[] = { "imp", "sweep", "burst" };
 constexpr int kNumInputs = 3;
@@ -361,18 +378,69 @@ std::unordered_map<std::string, std::string> loadHashes()
     return map;
 }
 
+// --bench. Off and on alternate, best of three each, after one warm-up
+// render per configuration.
+int runBench(MarsDSP::ChronosEngine& engine, const std::array<StereoBuffer, kNumInputs>& inputs)
+{
+    g_section = "bench";
+    std::println("ADAA series fast path, off against on (process time per 10 s render)");
+    std::println("cfg input    off ms    on ms  saving  max |diff|");
+
+    double totalOff = 0.0;
+    double totalOn = 0.0;
+    double worstDiff = 0.0;
+    StereoBuffer off, on;
+    for (const Config& cfg : configs())
+    {
+        const MarsDSP::ChronosEngine::Params p = buildParams(cfg);
+        for (int inIdx = 0; inIdx < kNumInputs; ++inIdx)
+        {
+            const StereoBuffer& in = inputs[static_cast<std::size_t>(inIdx)];
+            render(engine, p, in);
+            double tOff = 1e30;
+            double tOn = 1e30;
+            for (int rep = 0; rep < 3; ++rep)
+            {
+                double t = 0.0;
+                engine.setSeriesFastPath(false);
+                render(engine, p, in, &t, &off);
+                tOff = std::min(tOff, t);
+                engine.setSeriesFastPath(true);
+                render(engine, p, in, &t, &on);
+                tOn = std::min(tOn, t);
+            }
+            double diff = 0.0;
+            for (std::size_t i = 0; i < off.L.size(); ++i)
+                diff = std::max({diff, static_cast<double>(std::fabs(off.L[i] - on.L[i])),
+                                 static_cast<double>(std::fabs(off.R[i] - on.R[i]))});
+            std::println("{:3} {:<6} {:8.1f} {:8.1f} {:6.1f}%  {:.2e}", cfg.id, kInputNames[inIdx],
+                         tOff * 1e3, tOn * 1e3, 100.0 * (1.0 - tOn / tOff), diff);
+            totalOff += tOff;
+            totalOn += tOn;
+            worstDiff = std::max(worstDiff, diff);
+        }
+    }
+    std::println("all        {:8.1f} {:8.1f} {:6.1f}%  {:.2e}", totalOff * 1e3, totalOn * 1e3,
+                 100.0 * (1.0 - totalOn / totalOff), worstDiff);
+    return 0;
+}
+
 } // namespace
 
 int main(int argc, char** argv)
 {
     bool regen = false;
+    bool bench = false;
     for (int i = 1; i < argc; ++i)
+    {
         if (std::string_view(argv[i]) == "--regen") regen = true;
+        if (std::string_view(argv[i]) == "--bench") bench = true;
+    }
 
     std::println("=== Chronos golden render harness ===");
     std::println("fs={:.0} block={} stereo samples={}  dither=0x{:08x}/0x{:08x}",
                 kFs, kBlock, kRenderSamples, kDitherL, kDitherR);
-    std::println("hashes: {}  mode: {}\n", hashesPath().c_str(), regen ? "regen" : "compare");
+    std::println("hashes: {}  mode: {}\n", hashesPath().c_str(), regen ? "regen" : (bench ? "bench" : "compare"));
 
     // Build the three fixed inputs once.
     g_section = "input generation";
@@ -385,6 +453,10 @@ int main(int argc, char** argv)
     g_section = "prepare";
     MarsDSP::ChronosEngine engine;
     engine.prepare(kFs, kBlock, kChannels);
+    // The hashes cover the full tail, below the sleep threshold too.
+    engine.setSleepEnabled(false);
+
+    if (bench) return runBench(engine, inputs);
 
     std::vector<std::string> outLines;
     outLines.reserve(configs().size() * kNumInputs);
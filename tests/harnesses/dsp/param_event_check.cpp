@@ -0,0 +1,284 @@
+// tests/harnesses/dsp/param_event_check.cpp
+// Sample-accurate parameter events on ChronosEngine.
+// 1. Events at offset 0 for every changed field match one setParams call
+//    with the same snapshot, bit for bit.
+// 2. Events at offset k match splitting the block at k and calling
+//    setParams in between, bit for bit (mono and stereo).
+// 3. Out-of-order pushes sort by offset; equal offsets keep push order.
+// 4. The queue rejects pushes past kMaxParamEvents and drains every block.
+
+#include "dsp/ChronosEngine.h"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <print>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    using Engine = MarsDSP::ChronosEngine;
+
+    constexpr double kFs = 48000.0;
+    constexpr int kBlock = 256;
+
+    const char *g_section = "(startup)";
+
+#define CHECK(cond) \
+    do { if (!(cond)) { std::println("FAIL [{}] {}:{}: {}", g_section, __FILE__, __LINE__, #cond); std::exit(1); } } while (0)
+
+#define FAIL(...) \
+    do { std::print("FAIL [{}] ", g_section); std::println(__VA_ARGS__); std::exit(1); } while (0)
+
+    Engine::Params baseParams()
+    {
+        Engine::Params p{};
+        p.delaySamples = 480.0f;
+        p.driveLin = 2.0f;
+        p.mix = 60.0f;
+        p.gainLin = 1.0f;
+        p.hpfHz = 40.0f;
+        p.lpfHz = 12000.0f;
+        p.bits = 32;
+        p.adaaOrder = 1;
+        p.feedback = 0.5f;
+        p.dampHz = 6000.0f;
+        p.loopCutHz = 60.0f;
+        p.crossFeed = 0.2f;
+        p.loopDrive = 1.5f;
+        p.loopSatOrder = 1;
+        p.diffusion = 0.4f;
+        p.diffuserSize = 0.6f;
+        p.diffModDepth = 0.3f;
+        p.diffModRateHz = 0.5f;
+        p.enableDiffuser = false;
+        p.delayModDepth = 5.0f;
+        p.delayModRateHz = 0.7f;
+        return p;
+    }
+
+    // Touches every subsystem: output smoothers, filters, quantiser, ADAA
+    // order, the feedback loop and the diffuser.
+    Engine::Params movedParams()
+    {
+        Engine::Params p = baseParams();
+        p.delaySamples = 700.0f;
+        p.driveLin = 3.5f;
+        p.mix = 35.0f;
+        p.gainLin = 0.8f;
+        p.hpfHz = 120.0f;
+        p.lpfHz = 7000.0f;
+        p.filterMode = 1;
+        p.bits = 12;
+        p.adaaOrder = 2;
+        p.feedback = 0.75f;
+        p.dampHz = 3000.0f;
+        p.loopCutHz = 150.0f;
+        p.crossFeed = 0.6f;
+        p.loopDrive = 4.0f;
+        p.loopSatOrder = 2;
+        p.diffusion = 0.7f;
+        p.diffuserSize = 0.3f;
+        p.diffModDepth = 0.8f;
+        p.diffModRateHz = 1.3f;
+        p.enableDiffuser = true;
+        p.delayModDepth = 12.0f;
+        p.delayModRateHz = 2.0f;
+        return p;
+    }
+
+    std::unique_ptr<Engine> makeEngine(int numChannels)
+    {
+        auto e = std::make_unique<Engine>();
+        e->prepare(kFs, kBlock, numChannels);
+        e->reset();
+        e->setDitherSeeds(0x12345678u, 0x9abcdef0u);
+        e->resetParams(baseParams());
+        return e;
+    }
+
+    float input(int ch, int i)
+    {
+        return 0.4f * static_cast<float>(std::sin((0.021 + 0.004 * ch) * static_cast<double>(i)))
+               + 0.1f * static_cast<float>(std::sin(0.0037 * static_cast<double>(i)));
+    }
+
+    void fill(std::vector<float> &L, std::vector<float> &R, int block)
+    {
+        for (int s = 0; s < kBlock; ++s)
+        {
+            L[static_cast<std::size_t>(s)] = input(0, block * kBlock + s);
+            R[static_cast<std::size_t>(s)] = input(1, block * kBlock + s);
+        }
+    }
+
+    void render(Engine &e, std::vector<float> &L, std::vector<float> &R, int numChannels, int start, int n)
+    {
+        std::array<float *, 2> io{L.data() + start, R.data() + start};
+        e.process(io.data(), numChannels, n);
+    }
+
+    void pushChanged(Engine &e, const Engine::Params &from, const Engine::Params &to, int offset)
+    {
+        for (int i = 0; i < Engine::kNumParamIds; ++i)
+        {
+            const auto id = static_cast<Engine::ParamId>(i);
+            const float v = Engine::getParam(to, id);
+            if (v != Engine::getParam(from, id))
+                CHECK(e.pushParamEvent(id, offset, v));
+        }
+    }
+
+    void compareBlock(const std::vector<float> &a, const std::vector<float> &b, int block, const char *what)
+    {
+        for (int s = 0; s < kBlock; ++s)
+            if (a[static_cast<std::size_t>(s)] != b[static_cast<std::size_t>(s)])
+                FAIL("{}: block {} sample {}: {} vs {}", what, block, s,
+                     static_cast<double>(a[static_cast<std::size_t>(s)]),
+                     static_cast<double>(b[static_cast<std::size_t>(s)]));
+    }
+
+    // 1. Offset-0 events vs one setParams call.
+    void testSnapshotEquivalence(int numChannels)
+    {
+        g_section = "offset 0 == setParams";
+        constexpr int kSettle = 40;
+        constexpr int kBlocks = 120;
+
+        auto a = makeEngine(numChannels);
+        auto b = makeEngine(numChannels);
+        std::vector<float> aL(kBlock), aR(kBlock), bL(kBlock), bR(kBlock);
+
+        for (int blk = 0; blk < kBlocks; ++blk)
+        {
+            if (blk == kSettle)
+            {
+                a->setParams(movedParams());
+                pushChanged(*b, baseParams(), movedParams(), 0);
+            }
+            fill(aL, aR, blk);
+            fill(bL, bR, blk);
+            render(*a, aL, aR, numChannels, 0, kBlock);
+            render(*b, bL, bR, numChannels, 0, kBlock);
+            compareBlock(aL, bL, blk, "L");
+            if (numChannels == 2) compareBlock(aR, bR, blk, "R");
+        }
+        std::println("  {} ch: changed fields at offset 0, {} blocks bit-exact vs setParams: PASS",
+                     numChannels, kBlocks);
+    }
+
+    // 2. Events inside the block vs splitting the block by hand.
+    void testSplitEquivalence(int numChannels)
+    {
+        g_section = "offset k == split block";
+        constexpr int kSettle = 30;
+        constexpr int kBlocks = 100;
+        constexpr int k1 = 37;  // not a multiple of 4
+        constexpr int k2 = 201;
+
+        Engine::Params mid = baseParams();
+        mid.mix = 90.0f;
+        mid.feedback = 0.3f;
+        mid.hpfHz = 300.0f;
+        mid.adaaOrder = 0;
+        mid.delaySamples = 333.0f;
+
+        auto a = makeEngine(numChannels);
+        auto b = makeEngine(numChannels);
+        std::vector<float> aL(kBlock), aR(kBlock), bL(kBlock), bR(kBlock);
+
+        for (int blk = 0; blk < kBlocks; ++blk)
+        {
+            fill(aL, aR, blk);
+            fill(bL, bR, blk);
+            if (blk == kSettle)
+            {
+                // Pushed out of order: the queue sorts by offset.
+                pushChanged(*a, mid, movedParams(), k2);
+                pushChanged(*a, baseParams(), mid, k1);
+                render(*a, aL, aR, numChannels, 0, kBlock);
+
+                render(*b, bL, bR, numChannels, 0, k1);
+                b->setParams(mid);
+                render(*b, bL, bR, numChannels, k1, k2 - k1);
+                b->setParams(movedParams());
+                render(*b, bL, bR, numChannels, k2, kBlock - k2);
+            }
+            else
+            {
+                render(*a, aL, aR, numChannels, 0, kBlock);
+                render(*b, bL, bR, numChannels, 0, kBlock);
+            }
+            compareBlock(aL, bL, blk, "L");
+            if (numChannels == 2) compareBlock(aR, bR, blk, "R");
+        }
+        std::println("  {} ch: events at {} and {}, {} blocks bit-exact vs split block: PASS",
+                     numChannels, k1, k2, kBlocks);
+    }
+
+    // 3. Equal offsets apply in push order; late events apply after the block.
+    void testOrdering()
+    {
+        g_section = "ordering";
+        auto e = makeEngine(2);
+        std::vector<float> L(kBlock), R(kBlock);
+        fill(L, R, 0);
+
+        CHECK(e->pushParamEvent(Engine::ParamId::Mix, 64, 20.0f));
+        CHECK(e->pushParamEvent(Engine::ParamId::Mix, 64, 80.0f));
+        CHECK(e->pushParamEvent(Engine::ParamId::Feedback, kBlock + 10, 0.1f));
+        CHECK(e->pushParamEvent(Engine::ParamId::LoopSatOrder, -5, 0.0f));
+        render(*e, L, R, 2, 0, kBlock);
+
+        CHECK(e->currentParams().mix == 80.0f);
+        CHECK(e->currentParams().feedback == 0.1f);
+        CHECK(e->currentParams().loopSatOrder == 0);
+        CHECK(e->pendingParamEvents() == 0);
+
+        // An empty block still applies its events.
+        CHECK(e->pushParamEvent(Engine::ParamId::Bits, 0, 16.0f));
+        render(*e, L, R, 2, 0, 0);
+        CHECK(e->currentParams().bits == 16);
+        CHECK(e->pendingParamEvents() == 0);
+        std::println("  push order at equal offsets, late and negative offsets, empty block: PASS");
+    }
+
+    // 4. Bounded queue.
+    void testOverflow()
+    {
+        g_section = "overflow";
+        auto e = makeEngine(1);
+        for (int i = 0; i < Engine::kMaxParamEvents; ++i)
+            CHECK(e->pushParamEvent(Engine::ParamId::GainLin, i % kBlock, 1.0f));
+        CHECK(!e->pushParamEvent(Engine::ParamId::GainLin, 0, 0.5f));
+        CHECK(!e->pushParamEvent(Engine::ParamId::Count, 0, 0.0f));
+        CHECK(e->pendingParamEvents() == Engine::kMaxParamEvents);
+
+        std::vector<float> L(kBlock), R(kBlock);
+        fill(L, R, 0);
+        render(*e, L, R, 1, 0, kBlock);
+        CHECK(e->pendingParamEvents() == 0);
+        CHECK(e->currentParams().gainLin == 1.0f);
+        for (float v: L)
+            CHECK(std::isfinite(v));
+        std::println("  {} events accepted, next push rejected, queue drained: PASS", Engine::kMaxParamEvents);
+    }
+} // namespace
+
+int main()
+{
+    std::println("=== Chronos param_event_check ===\n");
+
+    testSnapshotEquivalence(1);
+    testSnapshotEquivalence(2);
+    testSplitEquivalence(1);
+    testSplitEquivalence(2);
+    testOrdering();
+    testOverflow();
+
+    std::println("\n=== ALL PROPERTIES HELD ===");
+    return 0;
+}
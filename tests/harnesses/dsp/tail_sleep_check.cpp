@@ -0,0 +1,204 @@
+// tests/harnesses/dsp/tail_sleep_check.cpp
+// Tail-aware sleep on ChronosEngine.
+// 1. A burst followed by silence puts the engine to sleep once the
+//    feedback tail has decayed, and not before the tail horizon.
+// 2. Asleep, the output is exact zeros at 32 bits and dither alone
+//    (|out| <= 1 LSB) below 32 bits.
+// 3. After waking on new input, the output tracks an engine that never
+//    sleeps to within 1e-4, so the wake adds no step.
+// 4. A self-oscillating loop (feedback >= 1) and a disabled sleep never sleep.
+
+#include "dsp/ChronosEngine.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <print>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    using Engine = MarsDSP::ChronosEngine;
+
+    constexpr double kFs = 48000.0;
+    constexpr int kBlock = 256;
+    constexpr int kBurst = 4800;
+
+    const char *g_section = "(startup)";
+
+#define CHECK(cond) \
+    do { if (!(cond)) { std::println("FAIL [{}] {}:{}: {}", g_section, __FILE__, __LINE__, #cond); std::exit(1); } } while (0)
+
+#define FAIL(...) \
+    do { std::print("FAIL [{}] ", g_section); std::println(__VA_ARGS__); std::exit(1); } while (0)
+
+    Engine::Params makeParams(float feedback, int bits)
+    {
+        Engine::Params p{};
+        p.delaySamples = 2400.0f;
+        p.driveLin = 2.0f;
+        p.mix = 60.0f;
+        p.hpfHz = 30.0f;
+        p.lpfHz = 15000.0f;
+        p.bits = bits;
+        p.adaaOrder = 2;
+        p.feedback = feedback;
+        p.dampHz = 5000.0f;
+        p.loopDrive = 2.0f;
+        return p;
+    }
+
+    std::unique_ptr<Engine> makeEngine(const Engine::Params &p, bool sleep)
+    {
+        auto e = std::make_unique<Engine>();
+        e->prepare(kFs, kBlock, 2);
+        e->reset();
+        e->setDitherSeeds(0x2468ace0u, 0x13579bdfu);
+        e->resetParams(p);
+        e->setSleepEnabled(sleep);
+        return e;
+    }
+
+    // Burst at the start, silence, then a second onset at wakeAt.
+    float input(int ch, int i, int wakeAt)
+    {
+        const bool on = i < kBurst || i >= wakeAt;
+        if (!on) return 0.0f;
+        return 0.5f * static_cast<float>(std::sin((0.031 + 0.002 * ch) * static_cast<double>(i)));
+    }
+
+    struct Run
+    {
+        std::vector<float> L, R;
+        int sleptAt = -1;
+        int wokeAt = -1;
+    };
+
+    Run render(Engine &e, int numSamples, int wakeAt)
+    {
+        Run r;
+        r.L.resize(static_cast<std::size_t>(numSamples));
+        r.R.resize(static_cast<std::size_t>(numSamples));
+        for (int i = 0; i < numSamples; ++i)
+        {
+            r.L[static_cast<std::size_t>(i)] = input(0, i, wakeAt);
+            r.R[static_cast<std::size_t>(i)] = input(1, i, wakeAt);
+        }
+        for (int off = 0; off < numSamples; off += kBlock)
+        {
+            const bool wasAsleep = e.isAsleep();
+            std::array<float *, 2> io{r.L.data() + off, r.R.data() + off};
+            e.process(io.data(), 2, std::min(kBlock, numSamples - off));
+            if (!wasAsleep && e.isAsleep() && r.sleptAt < 0) r.sleptAt = off;
+            if (wasAsleep && !e.isAsleep() && r.wokeAt < 0) r.wokeAt = off;
+        }
+        return r;
+    }
+
+    void testSleepAndWake()
+    {
+        g_section = "sleep and wake";
+        constexpr int kN = 48000 * 8;
+        constexpr int kWakeAt = 48000 * 6 + 77;
+
+        const auto p = makeParams(0.5f, 32);
+        auto sleeper = makeEngine(p, true);
+        auto awake = makeEngine(p, false);
+        const Run a = render(*sleeper, kN, kWakeAt);
+        const Run b = render(*awake, kN, kWakeAt);
+
+        if (a.sleptAt < 0) FAIL("never slept");
+        if (b.sleptAt >= 0) FAIL("slept with sleep disabled");
+        // Two passes of the 2400-sample loop at the least.
+        if (a.sleptAt < kBurst + 2 * 2400) FAIL("slept at {}, before the tail horizon", a.sleptAt);
+        if (a.wokeAt < 0 || a.wokeAt > kWakeAt) FAIL("woke at {} for onset {}", a.wokeAt, kWakeAt);
+
+        // Bit-exact until the engine sleeps.
+        for (int i = 0; i < a.sleptAt; ++i)
+            if (a.L[static_cast<std::size_t>(i)] != b.L[static_cast<std::size_t>(i)]
+                || a.R[static_cast<std::size_t>(i)] != b.R[static_cast<std::size_t>(i)])
+                FAIL("i={} before sleep: {} vs {}", i, static_cast<double>(a.L[static_cast<std::size_t>(i)]),
+                     static_cast<double>(b.L[static_cast<std::size_t>(i)]));
+
+        // Asleep: exact zeros. The never-sleeping engine is below threshold.
+        double awakeTail = 0.0;
+        for (int i = a.sleptAt + kBlock; i < a.wokeAt; ++i)
+        {
+            CHECK(a.L[static_cast<std::size_t>(i)] == 0.0f && a.R[static_cast<std::size_t>(i)] == 0.0f);
+            awakeTail = std::max(awakeTail, static_cast<double>(std::fabs(b.L[static_cast<std::size_t>(i)])));
+        }
+
+        // After waking, the sleeper differs only by the sub-threshold residual
+        // it dropped. That is ~1e-7 almost everywhere. ADAA2's near-equal-input
+        // branch can turn it into an isolated ~3e-5 sample, hence 1e-4.
+        double maxDiff = 0.0;
+        for (int i = a.wokeAt; i < kN; ++i)
+        {
+            const auto u = static_cast<std::size_t>(i);
+            maxDiff = std::max({maxDiff, std::fabs(static_cast<double>(a.L[u]) - b.L[u]),
+                                std::fabs(static_cast<double>(a.R[u]) - b.R[u])});
+        }
+        if (maxDiff > 1e-4) FAIL("after wake: max |sleeper - awake| = {:.3} > 1e-4", maxDiff);
+
+        std::println("  slept at {} ({:.2} s into silence), woke at {} for onset {}: PASS",
+                     a.sleptAt, static_cast<double>(a.sleptAt - kBurst) / kFs, a.wokeAt, kWakeAt);
+        std::println("  asleep output exact zero (awake tail peak {:.3}), after wake max diff {:.3}: PASS",
+                     awakeTail, maxDiff);
+    }
+
+    void testDitherOnly()
+    {
+        g_section = "dither only";
+        constexpr int kN = 48000 * 4;
+        auto e = makeEngine(makeParams(0.4f, 16), true);
+        const Run r = render(*e, kN, kN);
+        if (r.sleptAt < 0) FAIL("never slept at 16 bits");
+
+        const float lsb = std::ldexp(1.0f, 1 - 16);
+        int nonZero = 0;
+        for (int i = r.sleptAt + kBlock; i < kN; ++i)
+        {
+            const auto u = static_cast<std::size_t>(i);
+            for (const float v: {r.L[u], r.R[u]})
+            {
+                if (std::fabs(v) > lsb) FAIL("i={}: asleep output {} exceeds 1 LSB", i, static_cast<double>(v));
+                nonZero += v != 0.0f;
+            }
+        }
+        CHECK(nonZero > 0);
+        std::println("  16-bit asleep output within 1 LSB, dither present ({} non-zero): PASS", nonZero);
+    }
+
+    void testNeverSleeps()
+    {
+        g_section = "never sleeps";
+        constexpr int kN = 48000 * 6;
+        {
+            auto e = makeEngine(makeParams(1.1f, 32), true);
+            const Run r = render(*e, kN, kN);
+            if (r.sleptAt >= 0) FAIL("self-oscillating loop slept at {}", r.sleptAt);
+        }
+        {
+            auto e = makeEngine(makeParams(0.2f, 32), false);
+            const Run r = render(*e, kN, kN);
+            if (r.sleptAt >= 0) FAIL("disabled sleep slept at {}", r.sleptAt);
+        }
+        std::println("  feedback 1.1 and sleep disabled stay awake: PASS");
+    }
+} // namespace
+
+int main()
+{
+    std::println("=== Chronos tail_sleep_check ===\n");
+
+    testSleepAndWake();
+    testDitherOnly();
+    testNeverSleeps();
+
+    std::println("\n=== ALL PROPERTIES HELD ===");
+    return 0;
+}
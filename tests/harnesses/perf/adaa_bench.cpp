@@ -1,11 +1,16 @@
 /**
  * Throughput microbenchmark and branch histogram for the ADAA saturators.
  * Reports ns per sample for std::tanh, ADAA1<TanhNL>, ADAA2<TanhNL>, and
- * ADAA2<AlgebraicNL>, plus the per-branch sample fractions of the ADAA2
- * branch selection over drives {0, 6, 12, 24, 40} dB. Min-of-5 reps.
+ * ADAA2<AlgebraicNL>, plus stereo: two scalar ADAA1/ADAA2 instances against
+ * StereoADAA1/StereoADAA2, per stereo sample, and processBlock over
+ * 64-sample blocks against process() per sample, and ADAA1/ADAA2 over
+ * TabulatedNL for the tanh, tube and diode curves. Then the per-branch sample
+ * fractions of the ADAA2 branch selection over drives {0, 6, 12, 24, 40} dB.
+ * Min-of-5 reps.
  * Informational only.
  */
 
+#include <array>
 #include <chrono>
 #include <cmath>
 #include <cstddef>
@@ -19,13 +24,21 @@
 #include "dsp/nonlinear/ADAA1.h"
 #include "dsp/nonlinear/ADAA2.h"
 #include "dsp/nonlinear/Nonlinearities.h"
+#include "dsp/nonlinear/StereoADAA.h"
+#include "dsp/nonlinear/TabulatedNL.h"
 
 namespace
 {
     using MarsDSP::Nonlinear::ADAA1;
     using MarsDSP::Nonlinear::ADAA2;
     using MarsDSP::Nonlinear::AlgebraicNL;
+    using MarsDSP::Nonlinear::DiodeCurve;
+    using MarsDSP::Nonlinear::StereoADAA1;
+    using MarsDSP::Nonlinear::StereoADAA2;
+    using MarsDSP::Nonlinear::TabulatedNL;
+    using MarsDSP::Nonlinear::TanhCurve;
     using MarsDSP::Nonlinear::TanhNL;
+    using MarsDSP::Nonlinear::TubeCurve;
 
     constexpr double kPi = 3.14159265358979323846;
     constexpr double kFs = 48000.0;
@@ -198,17 +211,109 @@ int main(int argc, char **argv)
         return a;
     };
 
+    // Any ADAA stage, one sample at a time.
+    auto runStage = [&]<class A>() -> double
+    {
+        double a = 0.0;
+        A s;
+        s.reset();
+        for (std::size_t i = 0; i < ops; ++i)
+        {
+            a += s.process(xs[i & mask]);
+            doNotOptimize(a);
+        }
+        return a;
+    };
+
+    // Block path: F1/F2 for 64 samples through the kernel table, then the
+    // recurrence. 64 is the engine's post-loop tile.
+    constexpr std::size_t kBlock = 64;
+    auto runBlock = [&]<class A>() -> double
+    {
+        double a = 0.0;
+        std::array<double, kBlock> y{};
+        A s;
+        s.reset();
+        for (std::size_t i = 0; i < ops; i += kBlock)
+        {
+            s.processBlock(xs.data() + (i & mask), y.data(), static_cast<int>(kBlock));
+            for (const double v: y) a += v;
+            doNotOptimize(a);
+        }
+        return a;
+    };
+
+    // Stereo: R reads the sweep at an offset, scaled, so the lanes differ.
+    constexpr std::size_t kROffset = 4099;
+    auto runScalarPair = [&]<class A>() -> double
+    {
+        double a = 0.0;
+        A sl, sr;
+        sl.reset();
+        sr.reset();
+        for (std::size_t i = 0; i < ops; ++i)
+        {
+            a += sl.process(xs[i & mask]) + sr.process(0.7 * xs[(i + kROffset) & mask]);
+            doNotOptimize(a);
+        }
+        return a;
+    };
+    auto runPacked = [&]<class A>() -> double
+    {
+        double a = 0.0;
+        A s;
+        s.reset();
+        for (std::size_t i = 0; i < ops; ++i)
+        {
+            double l = xs[i & mask];
+            double r = 0.7 * xs[(i + kROffset) & mask];
+            s.process(l, r);
+            a += l + r;
+            doNotOptimize(a);
+        }
+        return a;
+    };
+
     double sink = 0.0;
     const double nsTanh = benchNsPerOp(runStdTanh, ops, reps, sink);
     const double nsA1 = benchNsPerOp(runADAA1, ops, reps, sink);
     const double nsA2T = benchNsPerOp(runADAA2Tanh, ops, reps, sink);
     const double nsA2A = benchNsPerOp(runADAA2Alg, ops, reps, sink);
+    const double nsA1Blk = benchNsPerOp([&] { return runBlock.operator()<ADAA1<TanhNL>>(); }, ops, reps, sink);
+    const double nsA2Blk = benchNsPerOp([&] { return runBlock.operator()<ADAA2<TanhNL>>(); }, ops, reps, sink);
+    const double nsA1x2 = benchNsPerOp([&] { return runScalarPair.operator()<ADAA1<TanhNL>>(); }, ops, reps, sink);
+    const double nsA1St = benchNsPerOp([&] { return runPacked.operator()<StereoADAA1<TanhNL>>(); }, ops, reps, sink);
+    const double nsA2x2 = benchNsPerOp([&] { return runScalarPair.operator()<ADAA2<TanhNL>>(); }, ops, reps, sink);
+    const double nsA2St = benchNsPerOp([&] { return runPacked.operator()<StereoADAA2<TanhNL>>(); }, ops, reps, sink);
+
+    // Tabulated curves: the tables are built before the timer starts.
+    TabulatedNL<TanhCurve>::prepare();
+    TabulatedNL<TubeCurve>::prepare();
+    TabulatedNL<DiodeCurve>::prepare();
+    const double nsTab1T = benchNsPerOp([&] { return runStage.operator()<ADAA1<TabulatedNL<TanhCurve>>>(); }, ops, reps, sink);
+    const double nsTab2T = benchNsPerOp([&] { return runStage.operator()<ADAA2<TabulatedNL<TanhCurve>>>(); }, ops, reps, sink);
+    const double nsTab1U = benchNsPerOp([&] { return runStage.operator()<ADAA1<TabulatedNL<TubeCurve>>>(); }, ops, reps, sink);
+    const double nsTab2U = benchNsPerOp([&] { return runStage.operator()<ADAA2<TabulatedNL<TubeCurve>>>(); }, ops, reps, sink);
+    const double nsTab1D = benchNsPerOp([&] { return runStage.operator()<ADAA1<TabulatedNL<DiodeCurve>>>(); }, ops, reps, sink);
+    const double nsTab2D = benchNsPerOp([&] { return runStage.operator()<ADAA2<TabulatedNL<DiodeCurve>>>(); }, ops, reps, sink);
 
     std::vector<bench::Record> records;
     records.push_back({"std::tanh", "", nsTanh});
     records.push_back({"ADAA1<TanhNL>", "", nsA1});
     records.push_back({"ADAA2<TanhNL>", "", nsA2T});
     records.push_back({"ADAA2<AlgebraicNL>", "", nsA2A});
+    records.push_back({"ADAA1<TanhNL>", "block 64", nsA1Blk});
+    records.push_back({"ADAA2<TanhNL>", "block 64", nsA2Blk});
+    records.push_back({"ADAA1<TanhNL> x2", "stereo", nsA1x2});
+    records.push_back({"StereoADAA1<TanhNL>", "stereo", nsA1St});
+    records.push_back({"ADAA2<TanhNL> x2", "stereo", nsA2x2});
+    records.push_back({"StereoADAA2<TanhNL>", "stereo", nsA2St});
+    records.push_back({"ADAA1<Tabulated tanh>", "tabulated", nsTab1T});
+    records.push_back({"ADAA2<Tabulated tanh>", "tabulated", nsTab2T});
+    records.push_back({"ADAA1<Tabulated tube>", "tabulated", nsTab1U});
+    records.push_back({"ADAA2<Tabulated tube>", "tabulated", nsTab2U});
+    records.push_back({"ADAA1<Tabulated diode>", "tabulated", nsTab1D});
+    records.push_back({"ADAA2<Tabulated diode>", "tabulated", nsTab2D});
 
     std::println("[timing] ns/sample (min of {} reps, 48 kHz sweep at {:.0} dB):", reps, kDriveDb);
     std::println("       std::tanh (no ADAA)    : {:7.2} ns/sample", nsTanh);
@@ -216,6 +321,19 @@ int main(int argc, char **argv)
     std::println("       ADAA2<TanhNL>          : {:7.2} ns/sample  ({:.1}x vs tanh)", nsA2T, nsA2T / nsTanh);
     std::println("       ADAA2<AlgebraicNL>     : {:7.2} ns/sample  ({:.1}x vs tanh)", nsA2A, nsA2A / nsTanh);
     std::println("       ADAA2 / ADAA1          : {:.2}x\n", nsA2T / nsA1);
+    std::println("[block] processBlock, 64 samples, {} kernels:", MarsDSP::Simd::isaName(MarsDSP::Simd::activeIsa()));
+    std::println("       ADAA1<TanhNL> block    : {:7.2} ns/sample  ({:.2}x vs per-sample)", nsA1Blk, nsA1 / nsA1Blk);
+    std::println("       ADAA2<TanhNL> block    : {:7.2} ns/sample  ({:.2}x vs per-sample)\n", nsA2Blk, nsA2T / nsA2Blk);
+    std::println("[stereo] ns per stereo sample:");
+    std::println("       ADAA1<TanhNL> x2       : {:7.2}", nsA1x2);
+    std::println("       StereoADAA1<TanhNL>    : {:7.2}  ({:.2}x)", nsA1St, nsA1x2 / nsA1St);
+    std::println("       ADAA2<TanhNL> x2       : {:7.2}", nsA2x2);
+    std::println("       StereoADAA2<TanhNL>    : {:7.2}  ({:.2}x)\n", nsA2St, nsA2x2 / nsA2St);
+    std::println("[tabulated] TabulatedNL, 1024 pieces over +-16, ns/sample:");
+    std::println("       curve      ADAA1     ADAA2");
+    std::println("       tanh     {:7.2}   {:7.2}   (fitted TanhNL: {:.2}, {:.2})", nsTab1T, nsTab2T, nsA1, nsA2T);
+    std::println("       tube     {:7.2}   {:7.2}", nsTab1U, nsTab2U);
+    std::println("       diode    {:7.2}   {:7.2}\n", nsTab1D, nsTab2D);
 
     // ---- branch histogram ----
     // One sweep per drive level.  Branch selection is policy-independent
@@ -1,11 +1,19 @@
 // tests/harnesses/perf/bbd_bench.cpp
 //
 // Performance benchmark for BBD delay core (FeedbackDelay in BBD mode)
-// and BrigadeLine in isolation across various delay times.
+// and BrigadeLine in isolation across various delay times. BrigadeLine runs
+// twice: with the incremental pole rotation, and with std::pow per event.
+// A clock sweep from ClockModel::minClockHz to maxClockHz gives the
+// worst-case cost at the full event rate and in bounded-cost mode.
+// Per chip, BrigadeLine runs with each stage count in kChipStages.
+// The last row times one input and one output pole-bank event on their own.
+// FeedbackDelay runs with its stereo lines in lockstep and, as the
+// reference, apart, and once more in lockstep with the in-loop diffuser.
 
 #include "bench_util.h"
 #include "dsp/FeedbackDelay.h"
 #include "dsp/bbd/BrigadeLine.h"
+#include "dsp/bbd/ClockModel.h"
 
 #include <algorithm>
 #include <chrono>
@@ -15,6 +23,7 @@
 #include <cstring>
 #include <numbers>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace
@@ -52,6 +61,46 @@ namespace
         sinkOut = total;
         return best / static_cast<double> (ops);
     }
+
+    // One BrigadeLine<Stages> at delayMs, clocked as ClockModel<Stages> would.
+    template <int Stages>
+    double benchStages (double fs, float delayMs, const std::vector<float>& in, std::size_t reps, double& sink)
+    {
+        using Line = MarsDSP::BBD::BrigadeLine<Stages>;
+        using Clock = MarsDSP::BBD::ClockModel<Stages>;
+
+        std::vector<float> mem (Line::bbdStorageFloats (1), 0.0f);
+        Line line;
+        line.prepare (fs, mem.data());
+        line.setClockHz (Clock::clockFor (static_cast<float> (delayMs * 0.001 * fs), fs));
+
+        auto run = [&]() -> double
+        {
+            double acc = 0.0;
+            for (float u : in)
+            {
+                acc += line.process (u);
+                doNotOptimize (acc);
+            }
+            return acc;
+        };
+        return benchNsPerOp (run, in.size(), reps, sink);
+    }
+
+    template <int Stages>
+    void reportStages (double fs, const std::vector<float>& in, std::size_t reps, double& sink,
+                       std::vector<bench::Record>& records)
+    {
+        const std::size_t bytes = MarsDSP::BBD::BrigadeLine<Stages>::bbdStorageFloats (1) * sizeof (float);
+        for (float dMs : { 5.0f, 50.0f, 375.0f })
+        {
+            const double ns = benchStages<Stages> (fs, dMs, in, reps, sink);
+            const std::string cfg = std::format("stages={} delay={:.0f}ms", Stages, static_cast<double> (dMs));
+            records.push_back ({ "BrigadeLine (chip)", cfg, ns });
+            std::println("  BrigadeLine<{:>4}> ({:>5} B/channel) delay={:>3.0f}ms: {:9.3f} ns/sample",
+                         Stages, bytes, static_cast<double> (dMs), ns);
+        }
+    }
 } // namespace
 
 int main (int argc, char** argv)
@@ -81,7 +130,7 @@ int main (int argc, char** argv)
     }
 
     std::vector<bench::Record> records;
-    const std::array<float, 6> delaysMs { { 5.0f, 50.0f, 375.0f, 853.0f, 1500.0f, 5000.0f } };
+    const std::array<float, 7> delaysMs { { 2.0f, 5.0f, 50.0f, 375.0f, 853.0f, 1500.0f, 5000.0f } };
 
     std::println("=== Chronos BBD Performance Benchmark ===");
 
@@ -89,7 +138,10 @@ int main (int argc, char** argv)
     {
         const float delaySamples = static_cast<float> (dMs * 0.001 * kFs);
 
-        // 1. FeedbackDelay in BBD mode (stereo)
+        // 1. FeedbackDelay in BBD mode (stereo), with the lines in lockstep
+        //    and apart, then with the diffuser
+        for (const auto [lockstep, diffuse] : { std::pair { false, false }, std::pair { true, false },
+                                                std::pair { true, true } })
         {
             MarsDSP::Delays::FeedbackDelay fb;
             fb.prepare (kFs, kBlock, 262144);
@@ -97,9 +149,11 @@ int main (int argc, char** argv)
             p.delaySamples = delaySamples;
             p.feedback = 0.42f;
             p.satOrder = 2;
-            p.enableDiffuser = false;
+            p.enableDiffuser = diffuse;
+            p.diffusion = 0.7f;
             p.delayMode = 1; // BBD
             fb.resetParams (p);
+            fb.setBbdLockstep (lockstep);
 
             auto run = [&]() -> double
             {
@@ -117,15 +171,20 @@ int main (int argc, char** argv)
 
             const double ns = benchNsPerOp (run, kSamples, kReps, sink);
             const std::string cfg = std::format("delay={:.0f}ms", static_cast<double> (dMs));
-            records.push_back ({ "FeedbackDelay (BBD)", cfg, ns });
-            std::println("  FeedbackDelay (BBD) {}: {:7.3} ns/sample", cfg, ns);
+            const char* name = diffuse    ? "FeedbackDelay (BBD, diffuser)"
+                             : lockstep ? "FeedbackDelay (BBD)"
+                                        : "FeedbackDelay (BBD, lines apart)";
+            records.push_back ({ name, cfg, ns });
+            std::println("  {:<32} {}: {:9.3f} ns/sample", name, cfg, ns);
         }
 
-        // 2. BrigadeLine in isolation
+        // 2. BrigadeLine in isolation, exact and incremental pole rotation
+        for (bool incremental : { false, true })
         {
-            std::vector<float> mem (MarsDSP::BBD::BrigadeLine::bbdStorageFloats (1), 0.0f);
-            MarsDSP::BBD::BrigadeLine line;
+            std::vector<float> mem (MarsDSP::BBD::BrigadeLine<>::bbdStorageFloats (1), 0.0f);
+            MarsDSP::BBD::BrigadeLine<> line;
             line.prepare (kFs, mem.data());
+            line.setIncrementalPoles (incremental);
             line.setDelaySeconds (static_cast<float> (dMs * 0.001));
 
             auto run = [&]() -> double
@@ -142,11 +201,107 @@ int main (int argc, char** argv)
 
             const double ns = benchNsPerOp (run, kSamples, kReps, sink);
             const std::string cfg = std::format("delay={:.0f}ms", static_cast<double> (dMs));
-            records.push_back ({ "BrigadeLine::process", cfg, ns });
-            std::println("  BrigadeLine::process   {}: {:7.3} ns/sample", cfg, ns);
+            const char* name = incremental ? "BrigadeLine::process" : "BrigadeLine::process (pow)";
+            records.push_back ({ name, cfg, ns });
+            std::println("  {:<26} {}: {:9.3f} ns/sample", name, cfg, ns);
         }
     }
 
+    // 2b. BrigadeLine across the whole clock range, full event rate and
+    //     bounded cost. The worst cell is the figure the real-time budget
+    //     has to hold.
+    {
+        using ClockModel = MarsDSP::BBD::ClockModel<>;
+        constexpr int kClockSteps = 16;
+        constexpr std::size_t kSweepSamples = 65536;
+        const double clkMin = static_cast<double> (ClockModel::minClockHz (kFs));
+        const double clkMax = static_cast<double> (ClockModel::maxClockHz (kFs));
+
+        std::println("  BrigadeLine clock sweep ({:.0f} Hz .. {:.0f} Hz):", clkMin, clkMax);
+        double worstExact = 0.0;
+        double worstBounded = 0.0;
+        for (int c = 0; c < kClockSteps; ++c)
+        {
+            const double t = static_cast<double> (c) / static_cast<double> (kClockSteps - 1);
+            const float clk = static_cast<float> (clkMin * std::pow (clkMax / clkMin, t));
+            double nsMode[2] {};
+            for (bool bounded : { false, true })
+            {
+                std::vector<float> mem (MarsDSP::BBD::BrigadeLine<>::bbdStorageFloats (1), 0.0f);
+                MarsDSP::BBD::BrigadeLine<> line;
+                line.prepare (kFs, mem.data());
+                line.setBoundedCost (bounded);
+                line.setClockHz (clk);
+
+                auto run = [&]() -> double
+                {
+                    double acc = 0.0;
+                    for (std::size_t i = 0; i < kSweepSamples; ++i)
+                    {
+                        acc += line.process (inL[i]);
+                        doNotOptimize (acc);
+                    }
+                    return acc;
+                };
+                nsMode[bounded ? 1 : 0] = benchNsPerOp (run, kSweepSamples, 3, sink);
+            }
+            worstExact = std::max (worstExact, nsMode[0]);
+            worstBounded = std::max (worstBounded, nsMode[1]);
+            std::println("    clk={:>9.0f} Hz ({:6.2f} x fs): full {:9.3f}  bounded {:9.3f} ns/sample",
+                         static_cast<double> (clk), static_cast<double> (clk) / kFs, nsMode[0], nsMode[1]);
+        }
+        records.push_back ({ "BrigadeLine worst case", "full event rate", worstExact });
+        records.push_back ({ "BrigadeLine worst case", "bounded cost", worstBounded });
+        std::println("  BrigadeLine worst case: full {:9.3f}  bounded {:9.3f} ns/sample", worstExact, worstBounded);
+    }
+
+    // 2c. BrigadeLine per chip stage count. The same delay takes a clock
+    //     in proportion to the stage count.
+    {
+        using MarsDSP::BBD::kChipStages;
+        std::vector<float> in (inL.begin(), inL.begin() + 131072);
+        reportStages<kChipStages[0]> (kFs, in, 3, sink, records);
+        reportStages<kChipStages[1]> (kFs, in, 3, sink, records);
+        reportStages<kChipStages[2]> (kFs, in, 3, sink, records);
+        reportStages<kChipStages[3]> (kFs, in, 3, sink, records);
+    }
+
+    // 3. One input and one output event of the pole banks: the body of
+    //    BrigadeLine::readTap's loop with the buffer access taken out.
+    {
+        MarsDSP::BBD::InputPoleBank inBank (static_cast<float> (1.0 / kFs));
+        MarsDSP::BBD::OutputPoleBank outBank (static_cast<float> (1.0 / kFs));
+        inBank.set_delta (0.02f);
+        outBank.set_delta (0.02f);
+        inBank.process (0.3f);
+
+        auto run = [&]() -> double
+        {
+            double acc = 0.0;
+            MarsDSP::BBD::PoleVec xOut {};
+            for (std::size_t i = 0; i < kSamples; ++i)
+            {
+                if ((i & 1023u) == 0u)
+                {
+                    inBank.calcG (0.0f);
+                    outBank.calcG (0.01f);
+                }
+                inBank.advanceG();
+                const float v = inBank.bucketCharge (inL[i]);
+                outBank.advanceG();
+                outBank.accumulate (xOut, v);
+                acc += v;
+                doNotOptimize (acc);
+            }
+            outBank.process (xOut);
+            return acc + outBank.output();
+        };
+
+        const double ns = benchNsPerOp (run, kSamples, kReps, sink);
+        records.push_back ({ "PoleBank event pair", "step+charge+accumulate", ns });
+        std::println("  PoleBank event pair (step, charge, accumulate): {:7.3} ns/event", ns);
+    }
+
     if (!jsonPath.empty())
         bench::writeJson (jsonPath, records, provisional);
 
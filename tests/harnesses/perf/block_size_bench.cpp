@@ -0,0 +1,143 @@
+// tests/harnesses/perf/block_size_bench.cpp
+//
+// ChronosEngine cost across host block sizes. Stereo, mix 50%, ADAA2,
+// feedback 0.6 with the diffuser on, 16-bit quantiser, a continuous sine
+// input. For each block size from 64 to 4096, reports the per-block
+// scratch the engine carves (the loop output plus the post-loop tiles;
+// the delay ring is not counted) and ns per sample. Min-of-5 reps.
+// Informational only.
+
+#include "bench_util.h"
+#include "dsp/ChronosEngine.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <print>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+#if defined(__clang__) || defined(__GNUC__)
+    template <class T>
+    inline void doNotOptimize(T const &v) noexcept
+    {
+        asm volatile("" : : "r,m"(v) : "memory");
+    }
+#else
+    template <class T>
+    inline void doNotOptimize(T const &v) noexcept
+    {
+        volatile T sink = v;
+        (void) sink;
+    }
+#endif
+
+    constexpr double kFs = 48000.0;
+    constexpr int kSamples = 1 << 16;
+    constexpr int kSettle = 48000;
+    constexpr std::size_t kReps = 5;
+    constexpr std::array<int, 7> kBlocks{64, 128, 256, 512, 1024, 2048, 4096};
+
+    MarsDSP::ChronosEngine::Params benchParams()
+    {
+        MarsDSP::ChronosEngine::Params p{};
+        p.delaySamples = 9600.0f;
+        p.driveLin = 2.0f;
+        p.mix = 50.0f;
+        p.bits = 16;
+        p.adaaOrder = 2;
+        p.feedback = 0.6f;
+        p.enableDiffuser = true;
+        p.delayModDepth = 8.0f;
+        return p;
+    }
+
+    struct Result
+    {
+        double ns = 0.0;
+        std::size_t scratchBytes = 0;
+    };
+
+    Result run(int blockSize, const std::vector<float> &src, double &sink)
+    {
+        auto engine = std::make_unique<MarsDSP::ChronosEngine>();
+        engine->prepare(kFs, blockSize, 2);
+        engine->reset();
+        engine->resetParams(benchParams());
+
+        const auto blk = static_cast<std::size_t>(blockSize);
+        std::vector<float> L(blk), R(blk);
+        std::array<float *, 2> io{L.data(), R.data()};
+        auto block = [&](int off)
+        {
+            std::memcpy(L.data(), src.data() + off % kSamples, sizeof(float) * blk);
+            std::memcpy(R.data(), src.data() + off % kSamples, sizeof(float) * blk);
+            engine->process(io.data(), 2, blockSize);
+        };
+
+        for (int off = 0; off < kSettle; off += blockSize)
+            block(off);
+
+        double best = 1.0e30;
+        double acc = 0.0;
+        for (std::size_t r = 0; r < kReps; ++r)
+        {
+            const auto t0 = Clock::now();
+            for (int off = 0; off < kSamples; off += blockSize)
+            {
+                block(off);
+                acc += L[0];
+                doNotOptimize(acc);
+            }
+            const auto t1 = Clock::now();
+            best = std::min(best, std::chrono::duration<double, std::nano>(t1 - t0).count());
+        }
+        sink += acc;
+        return {best / static_cast<double>(kSamples), engine->getScratchBytes()};
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::string jsonPath;
+    bool provisional = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) jsonPath = argv[++i];
+        else if (std::strcmp(argv[i], "--provisional") == 0) provisional = true;
+    }
+
+    bench::setFtzDaz();
+
+    // Wraps cleanly at every block size: kSamples is a multiple of 4096.
+    std::vector<float> src(static_cast<std::size_t>(kSamples));
+    for (int i = 0; i < kSamples; ++i)
+        src[static_cast<std::size_t>(i)] = 0.5f * static_cast<float>(std::sin(0.0131 * static_cast<double>(i)));
+
+    std::vector<bench::Record> records;
+    double sink = 0.0;
+
+    std::println("=== Chronos block size benchmark (stereo, mix 50%, ADAA2, 16 bits) ===");
+    std::println("post-loop tile: {} samples", MarsDSP::ChronosEngine::kTile);
+    std::println("{:>6}  {:>12}  {:>10}", "block", "scratch KiB", "ns/sample");
+
+    for (const int b: kBlocks)
+    {
+        const Result r = run(b, src, sink);
+        std::println("{:>6}  {:>12.1f}  {:>10.3f}", b, static_cast<double>(r.scratchBytes) / 1024.0, r.ns);
+        records.push_back({"ChronosEngine block size", "block " + std::to_string(b), r.ns});
+    }
+
+    if (!jsonPath.empty())
+        bench::writeJson(jsonPath, records, provisional);
+
+    doNotOptimize(sink);
+    return 0;
+}
@@ -3,6 +3,8 @@
  * in ChronosEngine::process order. Reports ns per sample per stage in
  * isolation plus the full fused chain, over adaaOrder x mix x blockSize x
  * channels. Flat parameter ramps stand in for the smoothers. Min-of-5 reps.
+ * A second table times the real engine per output-saturator choice (ADAA
+ * order or oversampling factor), the CPU side of alias_check's comparison.
  * Informational only: exits non-zero on NaN or Inf in the recording pass.
  */
 
@@ -15,6 +17,7 @@
 #include "dsp/align/SaturatorAlign.h"
 #include "math/Trigonometry.h"
 
+#include <array>
 #include <chrono>
 #include <cmath>
 #include <cstdint>
@@ -124,6 +127,7 @@ namespace
         float mix; // 0..100
         int block; // samples per block
         int ch; // 1=mono, 2=stereo
+        int oversampling = 1; // engine row only: 2, 4 replace ADAA
     };
 
     // Every per-stage intermediate, recorded untimed by the same loops that are
@@ -625,6 +629,7 @@ namespace
         ep.lpfHz = static_cast<float>(kLpfHz);
         ep.bits = kBits;
         ep.adaaOrder = c.mode;
+        ep.oversampling = c.oversampling;
         eng.resetParams(ep);
 
         std::vector<float> eL(static_cast<std::size_t>(kSamples));
@@ -864,6 +869,47 @@ int main(int argc, char **argv)
                     records.emplace_back("engine", cfg, nsEngine);
                 }
 
+    // Output saturator: ADAA against oversampling, whole engine, full wet.
+    // alias_check has the matching alias floors.
+    std::println("\n[saturator] engine ns/sample at mix=100, blk=256");
+    std::println("{:>6} {:>8} {:>8}", "sat", "mono", "stereo");
+    struct SatRow
+    {
+        const char *name;
+        int mode;
+        int oversampling;
+    };
+    constexpr std::array<SatRow, 4> satRows = {{ {"ADAA1", 1, 1}, {"ADAA2", 2, 1}, {"OS2", 0, 2}, {"OS4", 0, 4} }};
+    for (const SatRow &row: satRows)
+    {
+        std::array<double, 2> nsSat{};
+        for (int ch: chans)
+        {
+            const Cfg c{row.mode, 100.0f, 256, ch, row.oversampling};
+            Bufs b;
+            b.alloc(kSamples);
+            for (int i = 0; i < kSamples; ++i)
+            {
+                const std::size_t u = static_cast<std::size_t>(i);
+                b.inL[u] = 0.5f * static_cast<float>(std::sin(2.0 * kPi * 440.0 * static_cast<double>(i) / kFs));
+                b.inR[u] = 0.5f * static_cast<float>(std::sin(2.0 * kPi * 330.0 * static_cast<double>(i) / kFs));
+            }
+            nsSat[static_cast<std::size_t>(ch - 1)] = benchEngine(c, b, driveLin, gainLin, grandSink);
+
+            const std::string cfg = std::string("sat=") + row.name + ",ch=" + std::to_string(ch);
+            records.emplace_back("engine-saturator", cfg, nsSat[static_cast<std::size_t>(ch - 1)]);
+            csv += archName();
+            csv += ",";
+            csv += row.name;
+            csv += ",100,256,";
+            csv += std::to_string(ch);
+            csv += ",engine-saturator,";
+            csv += std::to_string(nsSat[static_cast<std::size_t>(ch - 1)]);
+            csv += "\n";
+        }
+        std::println("{:>6} {:8.3} {:8.3}", row.name, nsSat[0], nsSat[1]);
+    }
+
     if (!csvPath.empty())
     {
         const std::filesystem::path p(csvPath);
@@ -0,0 +1,141 @@
+// tests/harnesses/perf/elision_bench.cpp
+//
+// Cost of a ChronosEngine instance when the wet path does not reach the
+// output. Stereo, 256-sample blocks, feedback 0.6 with the diffuser on, a
+// continuous sine input (so the engine never sleeps). Mixed at 50% (full
+// chain) against mix settled at 0% (wet stages elided; the loop runs) and
+// bypass settled on (loop and wet stages elided). Reports ns per sample.
+// Min-of-5 reps. Informational only.
+
+#include "bench_util.h"
+#include "dsp/ChronosEngine.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <print>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+#if defined(__clang__) || defined(__GNUC__)
+    template <class T>
+    inline void doNotOptimize(T const &v) noexcept
+    {
+        asm volatile("" : : "r,m"(v) : "memory");
+    }
+#else
+    template <class T>
+    inline void doNotOptimize(T const &v) noexcept
+    {
+        volatile T sink = v;
+        (void) sink;
+    }
+#endif
+
+    constexpr double kFs = 48000.0;
+    constexpr int kBlock = 256;
+    constexpr int kSamples = 1 << 16;
+    constexpr int kSettle = 48000;
+    constexpr std::size_t kReps = 5;
+
+    enum class Mode { Mixed, Dry, Bypassed };
+
+    MarsDSP::ChronosEngine::Params benchParams(Mode mode)
+    {
+        MarsDSP::ChronosEngine::Params p{};
+        p.delaySamples = 9600.0f;
+        p.driveLin = 2.0f;
+        p.mix = mode == Mode::Dry ? 0.0f : 50.0f;
+        p.bits = 24;
+        p.adaaOrder = 2;
+        p.feedback = 0.6f;
+        p.enableDiffuser = true;
+        p.delayModDepth = 8.0f;
+        return p;
+    }
+
+    double run(Mode mode, const std::vector<float> &src, double &sink)
+    {
+        auto engine = std::make_unique<MarsDSP::ChronosEngine>();
+        engine->prepare(kFs, kBlock, 2);
+        engine->reset();
+        engine->resetParams(benchParams(mode));
+        engine->setBypass(mode == Mode::Bypassed);
+
+        std::vector<float> L(kBlock), R(kBlock);
+        std::array<float *, 2> io{L.data(), R.data()};
+        auto block = [&](int off)
+        {
+            std::memcpy(L.data(), src.data() + off % kSamples, sizeof(float) * kBlock);
+            std::memcpy(R.data(), src.data() + off % kSamples, sizeof(float) * kBlock);
+            engine->process(io.data(), 2, kBlock);
+        };
+
+        // Let the bypass fade and the loop settle.
+        for (int off = 0; off < kSettle; off += kBlock)
+            block(off);
+
+        double best = 1.0e30;
+        double acc = 0.0;
+        for (std::size_t r = 0; r < kReps; ++r)
+        {
+            const auto t0 = Clock::now();
+            for (int off = 0; off < kSamples; off += kBlock)
+            {
+                block(off);
+                acc += L[0];
+                doNotOptimize(acc);
+            }
+            const auto t1 = Clock::now();
+            best = std::min(best, std::chrono::duration<double, std::nano>(t1 - t0).count());
+        }
+        sink += acc;
+        return best / static_cast<double>(kSamples);
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::string jsonPath;
+    bool provisional = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) jsonPath = argv[++i];
+        else if (std::strcmp(argv[i], "--provisional") == 0) provisional = true;
+    }
+
+    bench::setFtzDaz();
+
+    std::vector<float> src(static_cast<std::size_t>(kSamples));
+    for (int i = 0; i < kSamples; ++i)
+        src[static_cast<std::size_t>(i)] = 0.5f * static_cast<float>(std::sin(0.0131 * static_cast<double>(i)));
+
+    double sink = 0.0;
+    const double mixed = run(Mode::Mixed, src, sink);
+    const double dry = run(Mode::Dry, src, sink);
+    const double bypassed = run(Mode::Bypassed, src, sink);
+
+    std::println("=== Chronos work elision benchmark (ns/sample, stereo) ===");
+    std::println("{:<24}  {:>10}  {:>8}", "config", "ns/sample", "vs mix");
+    std::println("{:<24}  {:>10.3f}  {:>7.1f}%", "mix 50% (full chain)", mixed, 100.0);
+    std::println("{:<24}  {:>10.3f}  {:>7.1f}%", "mix 0% (dry)", dry, 100.0 * dry / mixed);
+    std::println("{:<24}  {:>10.3f}  {:>7.1f}%", "bypassed", bypassed, 100.0 * bypassed / mixed);
+
+    std::vector<bench::Record> records;
+    records.push_back({"ChronosEngine elision", "mix 50", mixed});
+    records.push_back({"ChronosEngine elision", "dry", dry});
+    records.push_back({"ChronosEngine elision", "bypassed", bypassed});
+
+    if (!jsonPath.empty())
+        bench::writeJson(jsonPath, records, provisional);
+
+    doNotOptimize(sink);
+    return 0;
+}
@@ -0,0 +1,207 @@
+// tests/harnesses/perf/engine_bank_bench.cpp
+//
+// Per-instance cost of N Chronos instances rendered as N independent
+// ChronosEngine::process calls versus N / Lanes ChronosEngineBank<Lanes>
+// batches (Lanes = 4 and 8). Stereo, 256-sample blocks, mixed per-instance
+// params (delay, drive, ADAA order, mix, cutoffs). Reports ns per sample
+// per instance as N grows. Min-of-3 reps. Informational only.
+
+#include "bench_util.h"
+#include "dsp/ChronosEngine.h"
+#include "dsp/ChronosEngineBank.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <format>
+#include <memory>
+#include <print>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+#if defined(__clang__) || defined(__GNUC__)
+    template <class T>
+    inline void doNotOptimize(T const &v) noexcept
+    {
+        asm volatile("" : : "r,m"(v) : "memory");
+    }
+#else
+    template <class T>
+    inline void doNotOptimize(T const &v) noexcept
+    {
+        volatile T sink = v;
+        (void) sink;
+    }
+#endif
+
+    template <class Fn>
+    double benchNsPerOp(Fn fn, std::size_t ops, std::size_t reps, double &sinkOut)
+    {
+        double best = 1.0e30;
+        double total = 0.0;
+        for (std::size_t r = 0; r < reps; ++r)
+        {
+            const auto t0 = Clock::now();
+            const double a = fn();
+            const auto t1 = Clock::now();
+            total += a;
+            best = std::min(best, std::chrono::duration<double, std::nano>(t1 - t0).count());
+        }
+        sinkOut = total;
+        return best / static_cast<double>(ops);
+    }
+
+    constexpr double kFs = 48000.0;
+    constexpr int kBlock = 256;
+    constexpr int kSamples = 1 << 16;
+    constexpr std::size_t kReps = 3;
+
+    MarsDSP::ChronosEngine::Params instanceParams(int i)
+    {
+        MarsDSP::ChronosEngine::Params p{};
+        p.delaySamples = 240.0f + 13.0f * static_cast<float>(i);
+        p.driveLin = 1.0f + 0.25f * static_cast<float>(i % 8);
+        p.mix = 30.0f + 5.0f * static_cast<float>(i % 10);
+        p.hpfHz = 40.0f + static_cast<float>(i % 7) * 10.0f;
+        p.lpfHz = 12000.0f - static_cast<float>(i % 5) * 500.0f;
+        p.bits = 32;
+        p.adaaOrder = 1 + i % 2;
+        p.feedback = 0.35f;
+        return p;
+    }
+
+    // One stereo buffer pair per instance, refilled from the source each block.
+    struct Io
+    {
+        std::vector<std::vector<float>> L;
+        std::vector<std::vector<float>> R;
+
+        explicit Io(int n) : L(static_cast<std::size_t>(n), std::vector<float>(kBlock)),
+                             R(static_cast<std::size_t>(n), std::vector<float>(kBlock)) {}
+    };
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::string jsonPath;
+    bool provisional = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) jsonPath = argv[++i];
+        else if (std::strcmp(argv[i], "--provisional") == 0) provisional = true;
+    }
+
+    bench::setFtzDaz();
+
+    std::vector<float> src(static_cast<std::size_t>(kSamples));
+    for (int i = 0; i < kSamples; ++i)
+        src[static_cast<std::size_t>(i)] = 0.5f * static_cast<float>(std::sin(0.0131 * static_cast<double>(i)));
+
+    std::vector<bench::Record> records;
+    double sink = 0.0;
+
+    std::println("=== Chronos engine bank benchmark (ns/sample/instance) ===");
+    std::println("{:>4}  {:>12}  {:>12}  {:>12}", "N", "engines", "bank<4>", "bank<8>");
+
+    for (const int n: {8, 16, 32, 64})
+    {
+        Io io(n);
+        const auto ops = static_cast<std::size_t>(kSamples) * static_cast<std::size_t>(n);
+
+        auto fill = [&](int off)
+        {
+            for (int i = 0; i < n; ++i)
+            {
+                std::memcpy(io.L[static_cast<std::size_t>(i)].data(), src.data() + off, sizeof(float) * kBlock);
+                std::memcpy(io.R[static_cast<std::size_t>(i)].data(), src.data() + off, sizeof(float) * kBlock);
+            }
+        };
+
+        // 1. N independent engines
+        double nsEngines = 0.0;
+        {
+            std::vector<std::unique_ptr<MarsDSP::ChronosEngine>> engines;
+            for (int i = 0; i < n; ++i)
+            {
+                engines.push_back(std::make_unique<MarsDSP::ChronosEngine>());
+                engines.back()->prepare(kFs, kBlock, 2);
+                engines.back()->resetParams(instanceParams(i));
+            }
+            auto run = [&]() -> double
+            {
+                double acc = 0.0;
+                for (int off = 0; off < kSamples; off += kBlock)
+                {
+                    fill(off);
+                    for (int i = 0; i < n; ++i)
+                    {
+                        std::array<float *, 2> ch{io.L[static_cast<std::size_t>(i)].data(),
+                                                  io.R[static_cast<std::size_t>(i)].data()};
+                        engines[static_cast<std::size_t>(i)]->process(ch.data(), 2, kBlock);
+                    }
+                    acc += io.L[0][0];
+                    doNotOptimize(acc);
+                }
+                return acc;
+            };
+            nsEngines = benchNsPerOp(run, ops, kReps, sink);
+        }
+
+        // 2. N / Lanes banks
+        auto runBanks = [&]<int Lanes>() -> double
+        {
+            using Bank = MarsDSP::ChronosEngineBank<Lanes>;
+            const int numBanks = n / Lanes;
+            std::vector<std::unique_ptr<Bank>> banks;
+            for (int b = 0; b < numBanks; ++b)
+            {
+                banks.push_back(std::make_unique<Bank>());
+                banks.back()->prepare(kFs, kBlock, 2);
+                for (int l = 0; l < Lanes; ++l)
+                    banks.back()->resetParams(l, instanceParams(b * Lanes + l));
+            }
+            std::vector<std::array<float *, 2>> chans(static_cast<std::size_t>(n));
+            std::vector<float *const *> ptrs(static_cast<std::size_t>(n));
+            for (int i = 0; i < n; ++i)
+            {
+                chans[static_cast<std::size_t>(i)] = {io.L[static_cast<std::size_t>(i)].data(),
+                                                      io.R[static_cast<std::size_t>(i)].data()};
+                ptrs[static_cast<std::size_t>(i)] = chans[static_cast<std::size_t>(i)].data();
+            }
+            auto run = [&]() -> double
+            {
+                double acc = 0.0;
+                for (int off = 0; off < kSamples; off += kBlock)
+                {
+                    fill(off);
+                    for (int b = 0; b < numBanks; ++b)
+                        banks[static_cast<std::size_t>(b)]->process(ptrs.data() + b * Lanes, 2, kBlock);
+                    acc += io.L[0][0];
+                    doNotOptimize(acc);
+                }
+                return acc;
+            };
+            return benchNsPerOp(run, ops, kReps, sink);
+        };
+
+        const double nsBank4 = runBanks.template operator()<4>();
+        const double nsBank8 = runBanks.template operator()<8>();
+
+        const std::string cfg = std::format("N={}", n);
+        records.push_back({"ChronosEngine x N", cfg, nsEngines});
+        records.push_back({"ChronosEngineBank<4>", cfg, nsBank4});
+        records.push_back({"ChronosEngineBank<8>", cfg, nsBank8});
+        std::println("{:>4}  {:>12.3f}  {:>12.3f}  {:>12.3f}", n, nsEngines, nsBank4, nsBank8);
+    }
+
+    if (!jsonPath.empty())
+        bench::writeJson(jsonPath, records, provisional);
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+// tests/harnesses/perf/idle_bench.cpp
+//
+// Cost of a ChronosEngine instance on a silent track. Stereo, 256-sample
+// blocks, feedback 0.6 with the diffuser on. A short burst rings out first,
+// then the timed region feeds silence. Compares sleep disabled (the full
+// chain runs on zeros) against the sleeping engine at 32 bits and at 16
+// bits, where the dither still runs. Reports ns per sample.
+// Min-of-5 reps. Informational only.
+
+#include "bench_util.h"
+#include "dsp/ChronosEngine.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <print>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+#if defined(__clang__) || defined(__GNUC__)
+    template <class T>
+    inline void doNotOptimize(T const &v) noexcept
+    {
+        asm volatile("" : : "r,m"(v) : "memory");
+    }
+#else
+    template <class T>
+    inline void doNotOptimize(T const &v) noexcept
+    {
+        volatile T sink = v;
+        (void) sink;
+    }
+#endif
+
+    constexpr double kFs = 48000.0;
+    constexpr int kBlock = 256;
+    constexpr int kSamples = 1 << 16;
+    constexpr int kRingOut = 48000 * 4;
+    constexpr std::size_t kReps = 5;
+
+    MarsDSP::ChronosEngine::Params idleParams(int bits)
+    {
+        MarsDSP::ChronosEngine::Params p{};
+        p.delaySamples = 9600.0f;
+        p.driveLin = 2.0f;
+        p.mix = 40.0f;
+        p.bits = bits;
+        p.adaaOrder = 2;
+        p.feedback = 0.6f;
+        p.enableDiffuser = true;
+        p.delayModDepth = 8.0f;
+        return p;
+    }
+
+    struct Result
+    {
+        double ns = 0.0;
+        bool asleep = false;
+    };
+
+    Result runIdle(bool sleep, int bits, double &sink)
+    {
+        auto engine = std::make_unique<MarsDSP::ChronosEngine>();
+        engine->prepare(kFs, kBlock, 2);
+        engine->reset();
+        engine->resetParams(idleParams(bits));
+        engine->setSleepEnabled(sleep);
+
+        std::vector<float> L(kBlock), R(kBlock);
+        std::array<float *, 2> io{L.data(), R.data()};
+
+        // Burst, then let the tail ring out.
+        for (int off = 0; off < kRingOut; off += kBlock)
+        {
+            for (int s = 0; s < kBlock; ++s)
+            {
+                const float x = off < 4800 ? 0.5f * std::sin(0.03f * static_cast<float>(off + s)) : 0.0f;
+                L[static_cast<std::size_t>(s)] = x;
+                R[static_cast<std::size_t>(s)] = x;
+            }
+            engine->process(io.data(), 2, kBlock);
+        }
+
+        double best = 1.0e30;
+        double acc = 0.0;
+        for (std::size_t r = 0; r < kReps; ++r)
+        {
+            const auto t0 = Clock::now();
+            for (int off = 0; off < kSamples; off += kBlock)
+            {
+                std::memset(L.data(), 0, sizeof(float) * kBlock);
+                std::memset(R.data(), 0, sizeof(float) * kBlock);
+                engine->process(io.data(), 2, kBlock);
+                acc += L[0];
+                doNotOptimize(acc);
+            }
+            const auto t1 = Clock::now();
+            best = std::min(best, std::chrono::duration<double, std::nano>(t1 - t0).count());
+        }
+        sink += acc;
+        return {best / static_cast<double>(kSamples), engine->isAsleep()};
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::string jsonPath;
+    bool provisional = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) jsonPath = argv[++i];
+        else if (std::strcmp(argv[i], "--provisional") == 0) provisional = true;
+    }
+
+    bench::setFtzDaz();
+
+    std::vector<bench::Record> records;
+    double sink = 0.0;
+
+    std::println("=== Chronos idle instance benchmark (ns/sample, stereo, silent input) ===");
+    std::println("{:<28}  {:>10}  {:>8}", "config", "ns/sample", "asleep");
+
+    const Result active = runIdle(false, 32, sink);
+    const Result asleep = runIdle(true, 32, sink);
+    const Result dither = runIdle(true, 16, sink);
+
+    std::println("{:<28}  {:>10.3f}  {:>8}", "sleep off (full chain)", active.ns, active.asleep);
+    std::println("{:<28}  {:>10.3f}  {:>8}", "asleep, 32 bits", asleep.ns, asleep.asleep);
+    std::println("{:<28}  {:>10.3f}  {:>8}", "asleep, 16 bits (dither)", dither.ns, dither.asleep);
+    std::println("idle cost vs full chain: {:.1f}% (32 bits), {:.1f}% (16 bits)",
+                 100.0 * asleep.ns / active.ns, 100.0 * dither.ns / active.ns);
+
+    records.push_back({"ChronosEngine idle", "sleep off", active.ns});
+    records.push_back({"ChronosEngine idle", "asleep 32-bit", asleep.ns});
+    records.push_back({"ChronosEngine idle", "asleep 16-bit", dither.ns});
+
+    if (!jsonPath.empty())
+        bench::writeJson(jsonPath, records, provisional);
+
+    doNotOptimize(sink);
+    return 0;
+}
@@ -12,6 +12,8 @@
 //   2. Tan perf  – ns/tan for std::tan, the mmTanScalar bridge SVF actually
 //                  calls, and the raw mmTan(M128) 4-lane kernel.  FAIL (regression)
 //                  if mmTanScalar is more than 5% slower than std::tan.
+//                  Also ns/tan for the dispatched tanBlock kernel on every tier
+//                  the CPU supports (informational).
 //   3. SVF perf  – SimdSVF block-ramp throughput (setCoeffForBlock +
 //                  processBlockStep, M128 stereo in lanes 0,1).  Informational
 //                  baseline (~6.3 ns/sample on arm64); not a pass/fail check.
@@ -35,6 +37,7 @@
 #include "bench_util.h"
 #include "dsp/StateVariable.h"            // mmTanScalar (anon namespace; identical to SVF's path)
 #include "math/Trigonometry.h"  // mmTan(M128), mmTan(float)
+#include "simd/Kernels.h"       // dispatched tanBlock per tier
 
 namespace
 {
@@ -244,6 +247,31 @@ int main(int argc, char **argv)
     const double nsScalar = benchNsPerOp(runMmTanScalar, scalarOps, reps, sink);
     const double nsM128 = benchNsPerOp(runMmTanM128, vecOps, reps, sink);
 
+    // Dispatched block kernel, one row per available tier.
+    constexpr std::size_t kTanBlock = 1024;
+    std::vector<float> tanOut(kTanBlock);
+    std::array<double, MarsDSP::Simd::kNumIsas> nsTier{};
+    for (int t = 0; t < MarsDSP::Simd::kNumIsas; ++t)
+    {
+        const auto isa = static_cast<MarsDSP::Simd::Isa>(t);
+        if (!MarsDSP::Simd::isaAvailable(isa)) continue;
+        const auto &k = MarsDSP::Simd::kernelsFor(isa);
+        const std::size_t blocks = vecOps / kTanBlock;
+        auto runTanBlock = [&]() -> double
+        {
+            double a = 0.0;
+            for (std::size_t b = 0; b < blocks; ++b)
+            {
+                // xs4 holds 4 * groups = 4 blocks of inputs.
+                k.tanBlock(xs4.data() + (b & 3) * kTanBlock, tanOut.data(), static_cast<int>(kTanBlock));
+                a += static_cast<double>(tanOut[b & (kTanBlock - 1)]);
+                doNotOptimize(a);
+            }
+            return a;
+        };
+        nsTier[static_cast<std::size_t>(t)] = benchNsPerOp(runTanBlock, blocks * kTanBlock, reps, sink);
+    }
+
     const bool tanPerfOk = nsScalar <= nsStdTan * kPerfRegression;
 
     std::println("[tan perf] ns/tan (min of {} reps):", reps);
@@ -252,6 +280,14 @@ int main(int argc, char **argv)
                 nsScalar, nsStdTan / nsScalar);
     std::println("       mmTan(M128) 4la : {:7.3} ns/tan  ({:.2}x vs std::tan)",
                 nsM128, nsStdTan / nsM128);
+    for (int t = 0; t < MarsDSP::Simd::kNumIsas; ++t)
+    {
+        const auto isa = static_cast<MarsDSP::Simd::Isa>(t);
+        if (!MarsDSP::Simd::isaAvailable(isa)) continue;
+        const double ns = nsTier[static_cast<std::size_t>(t)];
+        std::println("       tanBlock {:<7}: {:7.3} ns/tan  ({:.2}x vs std::tan)",
+                     MarsDSP::Simd::isaName(isa), ns, nsStdTan / ns);
+    }
     std::println("       -> {} (mmTanScalar <= {:.2}x std::tan)\n",
                 tanPerfOk ? "PASS" : "FAIL", kPerfRegression);
 
@@ -319,6 +355,12 @@ int main(int argc, char **argv)
     records.emplace_back("mmTanScalar", "", nsScalar);
     records.emplace_back("mmTan(M128)", "", nsM128);
     records.emplace_back("SimdSVF", "", nsNewSVF);
+    for (int t = 0; t < MarsDSP::Simd::kNumIsas; ++t)
+    {
+        const auto isa = static_cast<MarsDSP::Simd::Isa>(t);
+        if (MarsDSP::Simd::isaAvailable(isa))
+            records.emplace_back("tanBlock", MarsDSP::Simd::isaName(isa), nsTier[static_cast<std::size_t>(t)]);
+    }
 
     std::println("[svf perf] ns/sample, stereo HPF+LPF wet path (min of {} reps):", reps);
     std::println("       SimdSVF (block-ramp, M128 float32) : {:7.3} ns/sample  (info: ~6.3 on arm64)\n",
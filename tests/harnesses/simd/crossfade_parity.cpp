@@ -2,10 +2,14 @@
 // SIMD vs scalar crossfade parity.
 // SIMD path uses M128 mmCos/mmSin with FMADD; scalar uses float mmCos/mmSin.
 // Gate: abs err < 2e-6, equal-power invariant cos^2+sin^2 within 1e-5,
-// endpoint exactness, lane parity.
+// endpoint exactness, lane parity. Every dispatched tier (Simd::kernelsFor)
+// runs the crossfade and sin/cos/tan block kernels against the scalar
+// reference and must match the SSE4.2 tier bit for bit.
 
 #include "math/Trigonometry.h"
 #include "simd/Config.h"
+#include "simd/Dispatch.h"
+#include "simd/Kernels.h"
 
 #include <algorithm>
 #include <array>
@@ -14,6 +18,7 @@
 #include <print>
 #include <cstdlib>
 #include <numbers>
+#include <vector>
 
 namespace
 {
@@ -160,6 +165,68 @@ int main()
         std::println("4-wide block (4 different theta, lane parity): PASS");
     }
 
+    // 5. Dispatched tiers: block kernels vs scalar, and bit-exact vs SSE4.2
+    g_section = "dispatched tiers"; {
+        using namespace MarsDSP::Simd;
+        constexpr int kN = 4096 + 28; // n4 leaves a 4-wide remainder after the wide spans
+        std::vector<float> theta(kN), dry(kN), wet(kN);
+        for (int i = 0; i < kN; ++i)
+        {
+            theta[static_cast<std::size_t>(i)] = kPiHalf * static_cast<float>(i) / static_cast<float>(kN - 1);
+            dry[static_cast<std::size_t>(i)] = std::sin(0.013f * static_cast<float>(i));
+            wet[static_cast<std::size_t>(i)] = std::cos(0.029f * static_cast<float>(i));
+        }
+
+        std::vector<float> refL(kN), refR(kN), refSin(kN), refCos(kN), refTan(kN);
+        const KernelTable &base = kernelsFor(Isa::Sse42);
+        base.crossfade(theta.data(), dry.data(), wet.data(), refL.data(), wet.data(), dry.data(), refR.data(), kN);
+        base.sinBlock(theta.data(), refSin.data(), kN - 3);
+        base.cosBlock(theta.data(), refCos.data(), kN - 3);
+        base.tanBlock(theta.data(), refTan.data(), kN - 3);
+
+        for (int t = 0; t < kNumIsas; ++t)
+        {
+            const auto isa = static_cast<Isa>(t);
+            if (!isaAvailable(isa))
+            {
+                std::println("  {:<8} not available on this CPU: SKIP", isaName(isa));
+                continue;
+            }
+            const KernelTable &k = kernelsFor(isa);
+            std::vector<float> outL(kN), outR(kN), ys(kN), yc(kN), yt(kN);
+            k.crossfade(theta.data(), dry.data(), wet.data(), outL.data(), wet.data(), dry.data(), outR.data(), kN);
+            k.sinBlock(theta.data(), ys.data(), kN - 3);
+            k.cosBlock(theta.data(), yc.data(), kN - 3);
+            k.tanBlock(theta.data(), yt.data(), kN - 3);
+
+            double maxErr = 0.0;
+            for (int i = 0; i < kN; ++i)
+            {
+                const auto u = static_cast<std::size_t>(i);
+                const float sc = mmCos(theta[u]);
+                const float ss = mmSin(theta[u]);
+                const float e = std::fabs(outL[u] - (dry[u] * sc + wet[u] * ss));
+                maxErr = std::max(maxErr, static_cast<double>(e));
+                if (e > 2e-6f)
+                    FAIL("{} i={}: simd={} scalar={} err={:.3} > 2e-6", isaName(isa), i,
+                         static_cast<double>(outL[u]), static_cast<double>(dry[u] * sc + wet[u] * ss),
+                         static_cast<double>(e));
+                if (outL[u] != refL[u] || outR[u] != refR[u])
+                    FAIL("{} i={}: crossfade differs from SSE4.2 ({} vs {})", isaName(isa), i,
+                         static_cast<double>(outL[u]), static_cast<double>(refL[u]));
+                if (i < kN - 3 && (ys[u] != refSin[u] || yc[u] != refCos[u] || yt[u] != refTan[u]))
+                    FAIL("{} i={}: trig block differs from SSE4.2", isaName(isa), i);
+                if (i < kN - 3 && (std::fabs(ys[u] - ss) > 2e-6f || std::fabs(yc[u] - sc) > 2e-6f))
+                    FAIL("{} i={}: sin/cos block vs scalar: {} {} vs {} {}", isaName(isa), i,
+                         static_cast<double>(ys[u]), static_cast<double>(yc[u]),
+                         static_cast<double>(ss), static_cast<double>(sc));
+            }
+            std::println("  {:<8} crossfade max err = {:.3}, trig blocks bit-exact vs SSE4.2: PASS",
+                         isaName(isa), maxErr);
+        }
+        std::println("dispatched tiers (active: {}): PASS", isaName(activeIsa()));
+    }
+
     std::println("\n=== ALL PROPERTIES HELD ===");
     return 0;
 }
@@ -26,6 +26,7 @@
 // chunk kernel inlines and simde_mm_* lowers to native intrinsics.
 
 #include "dsp/Diffuser.h"
+#include "simd/Dispatch.h"
 
 #include <cmath>
 #include <cstdlib>
@@ -289,23 +290,38 @@ int main()
     const std::array<float, 4> modDepths { { 0.0f, 8.0f, 16.0f, 32.0f } };
     const std::array<float, 2> modRates { { 0.5f, 2.0f } };
 
-    long configs = 0;
-    for (int bs: blockSizes)
-        for (float df: diffs)
-            for (float sz: sizes)
-                for (float md: modDepths)
-                    for (float mr: modRates)
-                        for (bool stereo: {false, true})
-                        {
-                            runOne({bs, df, sz, md, mr, stereo});
-                            ++configs;
-                        }
-
-    std::println("matrix ({} configs): parity <= {:.0e} (worst {:.3e}), finite, bounded: PASS\n",
-                 configs, static_cast<double>(kTol), g_worst);
-
-    std::println("Testing size ramp unsettled parity:");
-    testSizeRampParity();
+    for (int t = 0; t < MarsDSP::Simd::kNumIsas; ++t)
+    {
+        const auto isa = static_cast<MarsDSP::Simd::Isa>(t);
+        if (!MarsDSP::Simd::isaAvailable(isa))
+        {
+            std::println("--- tier {}: not available on this CPU: SKIP ---\n", MarsDSP::Simd::isaName(isa));
+            continue;
+        }
+        MarsDSP::Simd::setIsaOverride(isa);
+        std::println("--- tier {} ---", MarsDSP::Simd::isaName(isa));
+        g_worst = 0.0;
+
+        long configs = 0;
+        for (int bs: blockSizes)
+            for (float df: diffs)
+                for (float sz: sizes)
+                    for (float md: modDepths)
+                        for (float mr: modRates)
+                            for (bool stereo: {false, true})
+                            {
+                                runOne({bs, df, sz, md, mr, stereo});
+                                ++configs;
+                            }
+
+        std::println("matrix ({} configs): parity <= {:.0e} (worst {:.3e}), finite, bounded: PASS\n",
+                     configs, static_cast<double>(kTol), g_worst);
+
+        std::println("Testing size ramp unsettled parity:");
+        testSizeRampParity();
+        std::println();
+    }
+    MarsDSP::Simd::clearIsaOverride();
 
     std::println("\n=== ALL PROPERTIES HELD ===");
     return 0;
@@ -0,0 +1,296 @@
+// tests/harnesses/simd/engine_bank_parity.cpp
+// ChronosEngineBank vs independent ChronosEngine instances.
+// Every lane gets its own Params (delay, drive, ADAA order, mix, filter
+// mode, cutoffs, gain) and its own input. With the quantiser off each lane
+// must track its scalar twin; the bank reorders the half-sample FIR sum, so
+// the gate is 2e-5 absolute rather than bit-exactness.
+// Also: quantised lanes land on their LSB grid, a non-finite lane leaves its
+// neighbours untouched, and parameter ramps and bypass follow per lane.
+
+#include "dsp/ChronosEngine.h"
+#include "dsp/ChronosEngineBank.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <print>
+#include <vector>
+
+namespace
+{
+    const char *g_section = "(startup)";
+
+#define CHECK(cond) \
+    do { if (!(cond)) { std::println("FAIL [{}] {}:{}: {}", g_section, __FILE__, __LINE__, #cond); std::exit(1); } } while (0)
+
+#define FAIL(...) \
+    do { std::print("FAIL [{}] ", g_section); std::println(__VA_ARGS__); std::exit(1); } while (0)
+
+    constexpr double kFs = 48000.0;
+    constexpr int kBlock = 256;
+    constexpr int kBlocks = 40;
+    constexpr int kN = kBlock * kBlocks;
+    constexpr double kGate = 2e-5;
+
+    MarsDSP::ChronosEngine::Params laneParams(int lane, int bits)
+    {
+        MarsDSP::ChronosEngine::Params p{};
+        p.delaySamples = 120.0f + 37.5f * static_cast<float>(lane);
+        p.driveLin = 1.0f + 0.75f * static_cast<float>(lane % 5);
+        p.mix = lane % 4 == 0 ? 100.0f : (lane % 4 == 1 ? 0.0f : 25.0f * static_cast<float>(lane % 4));
+        p.gainLin = 0.5f + 0.125f * static_cast<float>(lane);
+        p.hpfHz = 20.0f + 40.0f * static_cast<float>(lane);
+        p.lpfHz = 18000.0f - 1500.0f * static_cast<float>(lane);
+        p.filterMode = lane % 3 == 2 ? 1 : 0;
+        p.bits = bits;
+        p.adaaOrder = lane % 3;
+        p.feedback = 0.2f + 0.05f * static_cast<float>(lane);
+        p.loopSatOrder = 1 + lane % 2;
+        return p;
+    }
+
+    float inputAt(int lane, int ch, int i)
+    {
+        const double f = 0.011 + 0.0037 * lane + 0.0011 * ch;
+        return static_cast<float>(0.6 * std::sin(f * static_cast<double>(i))
+                                  + 0.2 * std::sin(0.17 * f * static_cast<double>(i) + lane));
+    }
+
+    struct Run
+    {
+        std::vector<std::vector<float>> L;
+        std::vector<std::vector<float>> R;
+    };
+
+    // Render Lanes engines and one bank with the same per-lane Params.
+    // mutate(block, lane, params) may edit a lane's Params per block.
+    template <int Lanes, class Mutate>
+    void render(int bits, Mutate mutate, Run &ref, Run &bank, int nanLane = -1)
+    {
+        ref.L.assign(Lanes, std::vector<float>(kN));
+        ref.R.assign(Lanes, std::vector<float>(kN));
+        bank.L.assign(Lanes, std::vector<float>(kN));
+        bank.R.assign(Lanes, std::vector<float>(kN));
+        for (int l = 0; l < Lanes; ++l)
+            for (int i = 0; i < kN; ++i)
+            {
+                const float x = inputAt(l, 0, i);
+                const float y = inputAt(l, 1, i);
+                ref.L[l][i] = bank.L[l][i] = x;
+                ref.R[l][i] = bank.R[l][i] = y;
+            }
+        if (nanLane >= 0)
+        {
+            bank.L[nanLane][kN / 2] = std::numeric_limits<float>::quiet_NaN();
+            bank.R[nanLane][kN / 2 + 7] = std::numeric_limits<float>::infinity();
+        }
+
+        auto engines = std::make_unique<std::array<MarsDSP::ChronosEngine, Lanes>>();
+        for (int l = 0; l < Lanes; ++l)
+        {
+            auto &e = (*engines)[l];
+            e.prepare(kFs, kBlock, 2);
+            e.resetParams(laneParams(l, bits));
+        }
+        auto b = std::make_unique<MarsDSP::ChronosEngineBank<Lanes>>();
+        b->prepare(kFs, kBlock, 2);
+        for (int l = 0; l < Lanes; ++l)
+            b->resetParams(l, laneParams(l, bits));
+
+        for (int blk = 0; blk < kBlocks; ++blk)
+        {
+            std::array<std::array<float *, 2>, Lanes> chans{};
+            std::array<float *const *, Lanes> io{};
+            for (int l = 0; l < Lanes; ++l)
+            {
+                auto p = laneParams(l, bits);
+                if (mutate(blk, l, p))
+                {
+                    (*engines)[l].setParams(p);
+                    b->setParams(l, p);
+                }
+                std::array<float *, 2> e{ref.L[l].data() + blk * kBlock, ref.R[l].data() + blk * kBlock};
+                (*engines)[l].process(e.data(), 2, kBlock);
+                chans[l] = {bank.L[l].data() + blk * kBlock, bank.R[l].data() + blk * kBlock};
+                io[l] = chans[l].data();
+            }
+            b->process(io.data(), 2, kBlock);
+        }
+    }
+
+    double maxDiff(const std::vector<float> &a, const std::vector<float> &b, int from, int to)
+    {
+        double m = 0.0;
+        for (int i = from; i < to; ++i)
+            m = std::max(m, std::fabs(static_cast<double>(a[i]) - static_cast<double>(b[i])));
+        return m;
+    }
+
+    template <int Lanes>
+    void testParity()
+    {
+        g_section = Lanes == 4 ? "parity x4" : "parity x8";
+        Run ref, bank;
+        render<Lanes>(32, [](int, int, auto &) { return false; }, ref, bank);
+        double worst = 0.0;
+        for (int l = 0; l < Lanes; ++l)
+        {
+            const double dL = maxDiff(ref.L[l], bank.L[l], 0, kN);
+            const double dR = maxDiff(ref.R[l], bank.R[l], 0, kN);
+            if (dL > kGate || dR > kGate)
+                FAIL("lane {}: max |bank - engine| L={:.3e} R={:.3e} > {:.1e}", l, dL, dR, kGate);
+            worst = std::max({worst, dL, dR});
+        }
+        std::println("{} lanes, static params (gate {:.1e}): worst {:.3e}: PASS", Lanes, kGate, worst);
+    }
+
+    template <int Lanes>
+    void testRamps()
+    {
+        g_section = Lanes == 4 ? "ramps x4" : "ramps x8";
+        // Every lane moves mix, drive, gain and cutoffs at its own block;
+        // lane 1 switches filter topology mid-run.
+        Run ref, bank;
+        auto mutate = [](int blk, int lane, MarsDSP::ChronosEngine::Params &p)
+        {
+            if (blk < 4 + lane) return false;
+            p.mix = 100.0f - p.mix * 0.5f;
+            p.driveLin *= 1.5f;
+            p.gainLin *= 0.8f;
+            p.hpfHz *= 2.0f;
+            p.lpfHz *= 0.5f;
+            if (lane == 1) p.filterMode = 1 - p.filterMode;
+            return blk == 4 + lane;
+        };
+        render<Lanes>(32, mutate, ref, bank);
+        double worst = 0.0;
+        for (int l = 0; l < Lanes; ++l)
+        {
+            const double dL = maxDiff(ref.L[l], bank.L[l], 0, kN);
+            const double dR = maxDiff(ref.R[l], bank.R[l], 0, kN);
+            if (dL > kGate || dR > kGate)
+                FAIL("lane {}: max |bank - engine| L={:.3e} R={:.3e} > {:.1e}", l, dL, dR, kGate);
+            worst = std::max({worst, dL, dR});
+        }
+        std::println("{} lanes, per-lane ramps and mode switch: worst {:.3e}: PASS", Lanes, worst);
+    }
+
+    void testQuantiser()
+    {
+        g_section = "quantiser";
+        // Lanes alternate 12-bit and 32-bit. Quantised lanes sit on their grid
+        // within TPDF reach of the unquantised twin; 32-bit lanes stay in parity.
+        constexpr int kLanes = 4;
+        // Both runs push Params every block so the lanes see the same calls.
+        Run ref, unq;
+        render<kLanes>(32, [](int, int, auto &) { return true; }, ref, unq);
+
+        Run ref12, bank12;
+        auto mutate = [](int, int lane, MarsDSP::ChronosEngine::Params &p)
+        {
+            p.bits = lane % 2 == 0 ? 12 : 32;
+            return true;
+        };
+        render<kLanes>(32, mutate, ref12, bank12);
+        const float lsb = std::ldexp(1.0f, 1 - 12);
+        for (int l = 0; l < kLanes; ++l)
+        {
+            if (l % 2 == 1)
+            {
+                const double d = maxDiff(unq.L[l], bank12.L[l], 0, kN);
+                if (d > kGate) FAIL("32-bit lane {} drifted {:.3e}", l, d);
+                continue;
+            }
+            for (int i = 0; i < kN; ++i)
+            {
+                const float q = bank12.L[l][i];
+                const float steps = q / lsb;
+                if (steps != std::round(steps))
+                    FAIL("lane {} i={}: {} is off the 12-bit grid", l, i, static_cast<double>(q));
+                if (std::fabs(q - unq.L[l][i]) > 1.5f * lsb)
+                    FAIL("lane {} i={}: |q - x| = {:.3e} > 1.5 lsb", l, i,
+                         static_cast<double>(std::fabs(q - unq.L[l][i])));
+            }
+        }
+        std::println("12-bit lanes on grid within 1.5 LSB, 32-bit lanes untouched: PASS");
+    }
+
+    void testLaneIsolation()
+    {
+        g_section = "lane isolation";
+        constexpr int kLanes = 8;
+        Run ref, bank;
+        render<kLanes>(32, [](int, int, auto &) { return false; }, ref, bank, /*nanLane=*/5);
+        for (int l = 0; l < kLanes; ++l)
+        {
+            if (l == 5) continue;
+            const double d = std::max(maxDiff(ref.L[l], bank.L[l], 0, kN), maxDiff(ref.R[l], bank.R[l], 0, kN));
+            if (d > kGate)
+                FAIL("lane {} disturbed by a non-finite input on lane 5: {:.3e}", l, d);
+        }
+        for (int i = 0; i < kN; ++i)
+            CHECK(std::isfinite(bank.L[5][i]) || i >= kN / 2);
+        std::println("non-finite input on lane 5 leaves the other 7 lanes in parity: PASS");
+    }
+
+    void testBypass()
+    {
+        g_section = "bypass";
+        // Bypass lane 2 only; it must converge on the latency-aligned input
+        // while lane 0 keeps rendering wet.
+        constexpr int kLanes = 4;
+        auto b = std::make_unique<MarsDSP::ChronosEngineBank<kLanes>>();
+        b->prepare(kFs, kBlock, 1);
+        for (int l = 0; l < kLanes; ++l)
+            b->resetParams(l, laneParams(l, 32));
+        b->setBypass(2, true);
+
+        std::vector<std::vector<float>> bufs(kLanes, std::vector<float>(kN));
+        for (int l = 0; l < kLanes; ++l)
+            for (int i = 0; i < kN; ++i)
+                bufs[l][i] = inputAt(l, 0, i);
+        for (int blk = 0; blk < kBlocks; ++blk)
+        {
+            std::array<std::array<float *, 1>, kLanes> chans{};
+            std::array<float *const *, kLanes> io{};
+            for (int l = 0; l < kLanes; ++l)
+            {
+                chans[l] = {bufs[l].data() + blk * kBlock};
+                io[l] = chans[l].data();
+            }
+            b->process(io.data(), 1, kBlock);
+        }
+        const int lat = MarsDSP::ChronosEngineBank<kLanes>::latencySamples();
+        const float g = laneParams(2, 32).gainLin;
+        double err = 0.0;
+        double wetDev = 0.0;
+        for (int i = kN / 2; i < kN; ++i)
+        {
+            err = std::max(err, std::fabs(static_cast<double>(bufs[2][i] - g * inputAt(2, 0, i - lat))));
+            wetDev = std::max(wetDev, std::fabs(static_cast<double>(bufs[0][i] - inputAt(0, 0, i - lat))));
+        }
+        if (err > 1e-6)
+            FAIL("bypassed lane 2 deviates from gain * delayed input by {:.3e}", err);
+        if (wetDev < 1e-3)
+            FAIL("lane 0 looks bypassed too (deviation {:.3e})", wetDev);
+        std::println("per-lane bypass: lane 2 nulls to {:.3e}, lane 0 stays wet: PASS", err);
+    }
+} // namespace
+
+int main()
+{
+    std::println("=== Chronos engine_bank_parity ===\n");
+    testParity<4>();
+    testParity<8>();
+    testRamps<4>();
+    testRamps<8>();
+    testQuantiser();
+    testLaneIsolation();
+    testBypass();
+    std::println("\n=== engine_bank_parity OK ===");
+    return 0;
+}
@@ -22,6 +22,9 @@
 //   6. Delay-move crossfade region (D1=30 -> D2=60); the per-sample alpha
 //      ramp is where SIMD vs scalar diverge most.
 //
+// All six sections run once per dispatch tier the CPU supports (SSE4.2,
+// AVX2, AVX-512), capping the tier with Simd::setIsaOverride.
+//
 // Conventions (matching simd_delay_check.cpp): plain main(), exit code,
 // printf, always-live CHECK/FAIL. Links SharedCode only; no JUCE. Forced
 // -O2 and -Xarch_x86_64 -mfma (see tests/CMakeLists.txt) so the SIMD kernel
@@ -29,6 +32,7 @@
 // plugin target's x86_64 slice; arm64 has FMA unconditionally.
 
 #include "dsp/SimdDelayLine.h"
+#include "simd/Dispatch.h"
 
 #include <cmath>
 #include <cstdint>
@@ -274,7 +278,21 @@ int main()
     std::println("=== Chronos SimdDelayLine SIMD-vs-scalar parity harness ===");
     std::println("sr={:.0}  tol={:.0}  (process = SIMD, processScalar = reference)\n", kSr, static_cast<double>(kTol));
 
-    int r = runAll();
+    int r = 0;
+    for (int t = 0; t < MarsDSP::Simd::kNumIsas; ++t)
+    {
+        const auto isa = static_cast<MarsDSP::Simd::Isa>(t);
+        if (!MarsDSP::Simd::isaAvailable(isa))
+        {
+            std::println("--- tier {}: not available on this CPU: SKIP ---\n", MarsDSP::Simd::isaName(isa));
+            continue;
+        }
+        MarsDSP::Simd::setIsaOverride(isa);
+        std::println("--- tier {} ---", MarsDSP::Simd::isaName(isa));
+        r |= runAll();
+        std::println();
+    }
+    MarsDSP::Simd::clearIsaOverride();
 
     std::println("\n=== {} ===", r == 0 ? "PARITY HELD (within tol)" : "PARITY FAILED");
     return r;